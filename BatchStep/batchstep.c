@@ -0,0 +1,492 @@
+// Host driver for the batch environment. It steps many batches of games
+// with random actions, as a training loop would, and reports game steps a
+// second for BatchStep and, built with AVX2, for a row kernel stepping the
+// games of a batch in lockstep.
+//
+//   gcc -O2 -mavx2 -I.. -o batchstep batchstep.c ../batch.c ../game.c
+//   ./batchstep [batches] [steps]   Default 1024 batches of BATCH_MAX games, 2000 steps
+//
+// Every step calls the step function once per batch with an action for
+// each of its games, drawn ahead from a generator of the driver's own so
+// the runs repeat exactly and the timing is the environment alone. The
+// lines, game ends and a hash of the boards are printed for each run, and
+// before timing the kernel is checked against BatchStep, the whole tBatch
+// compared after every step.
+//
+// The kernel works on sixteen games at a time, a board row or column height
+// of each in one vector, since tBatch keeps those of every game together.
+// The landing row comes from the column heights as in batch.c, all ten
+// columns compared for every game, then only the rows some piece reaches
+// are merged and tested for full, and heights are raised where the piece
+// now stands highest. Rows only move, and heights are only taken again, in
+// the rare halves where a line was cleared. Piece lookup, the generator
+// and resets stay scalar, one game at a time.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "game.h"
+#include "batch.h"
+
+#define FULL_ROW ((1 << GAME_COLS) - 1)
+#define CHECK_STEPS 200 // Steps of the kernel checked against BatchStep
+
+static unsigned long seed = 1;
+
+static int Rand(void)
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (int)((seed >> 16) & 0x7FFF);
+}
+
+typedef void (*tStep)(tBatch *batch, const unsigned char *actions, unsigned char *lines, unsigned char *done);
+
+#ifdef __AVX2__
+
+#define LANES 16 // Games in one vector
+
+// Each shape and orientation moved to the left of its box, as batch.c has
+typedef struct
+{
+    unsigned short rows[4];
+    unsigned char top;
+    unsigned char width;
+} tShape;
+
+// A shape placed by an action, moved to its column
+typedef struct
+{
+    unsigned short rows[4];
+    short top;
+} tMove;
+
+// The pieces of one step, laid out as the board rows
+typedef struct
+{
+    unsigned short rows[4][BATCH_MAX];
+    short top[BATCH_MAX];
+} tPieces;
+
+#define NO_CELL 64 // Box row of a column the piece does not fill, out of reach either way
+
+static tShape shapes[7][4];
+static tMove moves[7][BATCH_ACTIONS];
+
+static void PrepareShapes(void)
+{
+    int shape, orientation, i;
+    for(shape = 0; shape < 7; shape++)
+    {
+        for(orientation = 0; orientation < 4; orientation++)
+        {
+            int mask = shapeMasks[shape][orientation];
+            tShape *s = &shapes[shape][orientation];
+
+            int columns = 0;
+            for(i = 0; i < 4; i++)
+            {
+                columns |= (mask >> (4 * i)) & 0xF;
+            }
+            int left = 0;
+            while(!(columns & (1 << left)))
+            {
+                left++;
+            }
+            columns >>= left;
+
+            s->width = 0;
+            while(columns >> s->width)
+            {
+                s->width++;
+            }
+
+            s->top = 4;
+            for(i = 3; i >= 0; i--)
+            {
+                s->rows[i] = ((mask >> (4 * i)) & 0xF) >> left;
+                if(s->rows[i])
+                {
+                    s->top = i;
+                }
+            }
+
+            int x;
+            for(x = 0; x < GAME_COLS; x++)
+            {
+                tMove *move = &moves[shape][orientation * GAME_COLS + x];
+                int at = x + s->width > GAME_COLS ? GAME_COLS - s->width : x;
+                for(i = 0; i < 4; i++)
+                {
+                    move->rows[i] = s->rows[i] << at;
+                }
+                move->top = s->top;
+            }
+        }
+    }
+}
+
+// The game's generator on one board's state
+static int BatchRand(tBatch *batch, int game)
+{
+    batch->seed[game] = (batch->seed[game] * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (int)((batch->seed[game] >> 16) & 0x7FFF);
+}
+
+static __m256i LoadHeights(const tBatch *batch, int column, int first)
+{
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)&batch->heights[column][first]));
+}
+
+static void StoreHeights(tBatch *batch, int column, int first, __m256i heights)
+{
+    __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(heights), _mm256_extracti128_si256(heights, 1));
+    _mm_storeu_si128((__m128i *)&batch->heights[column][first], bytes);
+}
+
+// Removes the full rows of sixteen games, moving the rows above down, and
+// takes every height again
+static void Clear(tBatch *batch, int first, const __m256i *full)
+{
+    __m256i rows[GAME_ROWS];
+    __m256i below[GAME_ROWS]; // Full rows under each row
+    __m256i count = _mm256_setzero_si256();
+    int r, d;
+    for(r = GAME_ROWS - 1; r >= 0; r--)
+    {
+        rows[r] = _mm256_loadu_si256((const __m256i *)&batch->rows[r][first]);
+        below[r] = count;
+        count = _mm256_sub_epi16(count, full[r]);
+    }
+
+    // Row r ends up at r plus the full rows under it, so the row that
+    // lands at t is the one d above with d full rows under it
+    for(r = GAME_ROWS - 1; r >= 0; r--)
+    {
+        __m256i row = _mm256_setzero_si256();
+        for(d = 0; d <= 4 && r - d >= 0; d++)
+        {
+            __m256i from = _mm256_andnot_si256(full[r - d], _mm256_cmpeq_epi16(below[r - d], _mm256_set1_epi16(d)));
+            row = _mm256_or_si256(row, _mm256_and_si256(from, rows[r - d]));
+        }
+        _mm256_storeu_si256((__m256i *)&batch->rows[r][first], row);
+    }
+
+    // A column's height is the rows from its first filled one down
+    __m256i heights[GAME_COLS];
+    __m256i seen = _mm256_setzero_si256();
+    int c;
+    for(c = 0; c < GAME_COLS; c++)
+    {
+        heights[c] = _mm256_setzero_si256();
+    }
+    for(r = 0; r < GAME_ROWS; r++)
+    {
+        seen = _mm256_or_si256(seen, _mm256_loadu_si256((const __m256i *)&batch->rows[r][first]));
+        for(c = 0; c < GAME_COLS; c++)
+        {
+            __m256i bit = _mm256_set1_epi16(1 << c);
+            heights[c] = _mm256_sub_epi16(heights[c], _mm256_cmpeq_epi16(_mm256_and_si256(seen, bit), bit));
+        }
+    }
+    for(c = 0; c < GAME_COLS; c++)
+    {
+        StoreHeights(batch, c, first, heights[c]);
+    }
+}
+
+// Drops the pieces of sixteen games. Returns a mask of the games whose
+// piece did not fit below the top, and writes the lines each cleared.
+static int Drop(tBatch *batch, int first, const tPieces *pieces, unsigned short *cleared)
+{
+    __m256i p[4];
+    int i, r;
+    for(i = 0; i < 4; i++)
+    {
+        p[i] = _mm256_loadu_si256((const __m256i *)&pieces->rows[i][first]);
+    }
+
+    // For each column, the box rows of the piece's top and bottom cells in
+    // it, NO_CELL past the far end if it has none
+    __m256i pieceTop[GAME_COLS];
+    __m256i pieceBottom[GAME_COLS];
+    int c;
+    for(c = 0; c < GAME_COLS; c++)
+    {
+        __m256i bit = _mm256_set1_epi16(1 << c);
+        pieceTop[c] = _mm256_set1_epi16(NO_CELL);
+        pieceBottom[c] = _mm256_set1_epi16(-NO_CELL);
+        for(i = 0; i < 4; i++)
+        {
+            __m256i has = _mm256_cmpeq_epi16(_mm256_and_si256(p[i], bit), bit);
+            pieceTop[c] = _mm256_min_epi16(pieceTop[c], _mm256_blendv_epi8(pieceTop[c], _mm256_set1_epi16(i), has));
+            pieceBottom[c] = _mm256_blendv_epi8(pieceBottom[c], _mm256_set1_epi16(i), has);
+        }
+    }
+
+    // Dropped from above, the piece stops where the first of its columns
+    // meets the stack, as in batch.c
+    __m256i y = _mm256_set1_epi16(GAME_ROWS + NO_CELL);
+    for(c = 0; c < GAME_COLS; c++)
+    {
+        __m256i rest = _mm256_sub_epi16(_mm256_set1_epi16(GAME_ROWS - 1), LoadHeights(batch, c, first));
+        y = _mm256_min_epi16(y, _mm256_sub_epi16(rest, pieceBottom[c]));
+    }
+
+    // A piece whose top is above the board ends its game and is not placed
+    __m256i over = _mm256_cmpgt_epi16(_mm256_setzero_si256(),
+                                      _mm256_add_epi16(y, _mm256_loadu_si256((const __m256i *)&pieces->top[first])));
+    __m256i yRow[4];
+    for(i = 0; i < 4; i++)
+    {
+        p[i] = _mm256_andnot_si256(over, p[i]);
+        yRow[i] = _mm256_add_epi16(y, _mm256_set1_epi16(i));
+    }
+
+    // Only the rows some piece reaches can change
+    short ys[LANES];
+    _mm256_storeu_si256((__m256i *)ys, y);
+    int low = GAME_ROWS;
+    int high = 0;
+    for(i = 0; i < LANES; i++)
+    {
+        if(ys[i] < low)
+        {
+            low = ys[i];
+        }
+        if(ys[i] + 3 > high)
+        {
+            high = ys[i] + 3;
+        }
+    }
+    low = low < 0 ? 0 : low;
+    high = high >= GAME_ROWS ? GAME_ROWS - 1 : high;
+
+    // Merge and test those rows for full
+    __m256i full[GAME_ROWS];
+    __m256i lines = _mm256_setzero_si256();
+    __m256i any = _mm256_setzero_si256();
+    for(r = 0; r < GAME_ROWS; r++)
+    {
+        full[r] = _mm256_setzero_si256();
+    }
+    for(r = low; r <= high; r++)
+    {
+        __m256i add = _mm256_setzero_si256();
+        for(i = 0; i < 4; i++)
+        {
+            add = _mm256_or_si256(add, _mm256_and_si256(_mm256_cmpeq_epi16(yRow[i], _mm256_set1_epi16(r)), p[i]));
+        }
+
+        __m256i row = _mm256_or_si256(_mm256_loadu_si256((const __m256i *)&batch->rows[r][first]), add);
+        _mm256_storeu_si256((__m256i *)&batch->rows[r][first], row);
+        full[r] = _mm256_cmpeq_epi16(row, _mm256_set1_epi16(FULL_ROW));
+        lines = _mm256_sub_epi16(lines, full[r]);
+        any = _mm256_or_si256(any, full[r]);
+    }
+    _mm256_storeu_si256((__m256i *)cleared, lines);
+
+    // With no line cleared, a column is as high as the stack or the piece
+    // in it, whichever is higher. Games that ended are reset after.
+    if(_mm256_testz_si256(any, any))
+    {
+        __m256i floor = _mm256_sub_epi16(_mm256_set1_epi16(GAME_ROWS), y);
+        for(c = 0; c < GAME_COLS; c++)
+        {
+            __m256i piece = _mm256_sub_epi16(floor, pieceTop[c]);
+            StoreHeights(batch, c, first, _mm256_max_epi16(LoadHeights(batch, c, first), piece));
+        }
+    }
+    else
+    {
+        Clear(batch, first, full);
+    }
+
+    // A byte of mask per game
+    return _mm_movemask_epi8(_mm_packs_epi16(_mm256_castsi256_si128(over), _mm256_extracti128_si256(over, 1)));
+}
+
+// BatchStep with the rows of sixteen games at a time in a vector
+static void StepRows(tBatch *batch, const unsigned char *actions, unsigned char *lines, unsigned char *done)
+{
+    static tPieces pieces;
+    int game, i;
+    for(game = 0; game < BATCH_MAX; game++)
+    {
+        // Games past the count get no piece, so they stay as they are
+        if(game >= batch->count)
+        {
+            for(i = 0; i < 4; i++)
+            {
+                pieces.rows[i][game] = 0;
+            }
+            pieces.top[game] = 0;
+            continue;
+        }
+
+        const tMove *move = &moves[batch->shape[game]][actions[game] % BATCH_ACTIONS];
+        for(i = 0; i < 4; i++)
+        {
+            pieces.rows[i][game] = move->rows[i];
+        }
+        pieces.top[game] = move->top;
+    }
+
+    unsigned short cleared[BATCH_MAX];
+    unsigned long over = 0;
+    for(game = 0; game < batch->count; game += LANES)
+    {
+        over |= (unsigned long)Drop(batch, game, &pieces, &cleared[game]) << game;
+    }
+
+    for(game = 0; game < batch->count; game++)
+    {
+        if(over & (1UL << game))
+        {
+            lines[game] = 0;
+            done[game] = 1;
+            BatchReset(batch, game);
+            batchStats.resets++;
+            continue;
+        }
+
+        lines[game] = cleared[game];
+        done[game] = 0;
+        batchStats.lines += cleared[game];
+
+        batch->shape[game] = batch->nextShape[game];
+        batch->nextShape[game] = BatchRand(batch, game) % 7;
+        batch->pieces[game]++;
+    }
+
+    batchStats.steps += batch->count;
+}
+
+#endif
+
+static double Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Steps every batch from the same start and reports the rate
+static void Run(const char *name, tStep step, tBatch *batch, int batches, int steps, const unsigned char *actions)
+{
+    int b, s, i;
+    for(b = 0; b < batches; b++)
+    {
+        BatchInit(&batch[b], BATCH_MAX, 1 + (unsigned long)b * BATCH_MAX);
+    }
+    memset(&batchStats, 0, sizeof(batchStats));
+
+    unsigned char lines[BATCH_MAX];
+    unsigned char done[BATCH_MAX];
+    unsigned long ends = 0;
+    double start = Now();
+    for(s = 0; s < steps; s++)
+    {
+        for(b = 0; b < batches; b++)
+        {
+            // Each batch reads the actions at its own offset
+            step(&batch[b], &actions[(s + b) % steps * BATCH_MAX], lines, done);
+            for(i = 0; i < BATCH_MAX; i++)
+            {
+                ends += done[i];
+            }
+        }
+    }
+    double seconds = Now() - start;
+
+    unsigned long hash = 0;
+    for(b = 0; b < batches; b++)
+    {
+        int row, game;
+        for(row = 0; row < GAME_ROWS; row++)
+        {
+            for(game = 0; game < BATCH_MAX; game++)
+            {
+                hash = hash * 31 + batch[b].rows[row][game];
+            }
+        }
+    }
+
+    printf("%-9s %lu game steps, %lu lines, %lu game ends, hash %08lx, %.2f s, %.1fM steps/s, %.1f ns/step\n", name,
+           batchStats.steps, batchStats.lines, ends, hash & 0xFFFFFFFFUL, seconds,
+           seconds > 0 ? batchStats.steps / seconds / 1e6 : 0.0,
+           batchStats.steps ? seconds / batchStats.steps * 1e9 : 0.0);
+}
+
+#ifdef __AVX2__
+
+// Steps one batch with both and compares them whole after every step.
+// Returns the step they first differ at, -1 if none.
+static int Check(const unsigned char *actions, int steps)
+{
+    static tBatch scalar, rows;
+    BatchInit(&scalar, BATCH_MAX, 1);
+    BatchInit(&rows, BATCH_MAX, 1);
+
+    unsigned char lines[2][BATCH_MAX];
+    unsigned char done[2][BATCH_MAX];
+    int s;
+    for(s = 0; s < steps; s++)
+    {
+        BatchStep(&scalar, &actions[s * BATCH_MAX], lines[0], done[0]);
+        StepRows(&rows, &actions[s * BATCH_MAX], lines[1], done[1]);
+        if(memcmp(&scalar, &rows, sizeof(tBatch)) || memcmp(lines[0], lines[1], BATCH_MAX) ||
+           memcmp(done[0], done[1], BATCH_MAX))
+        {
+            return s;
+        }
+    }
+    return -1;
+}
+
+#endif
+
+int main(int argc, char **argv)
+{
+    int batches = argc > 1 ? atoi(argv[1]) : 1024;
+    int steps = argc > 2 ? atoi(argv[2]) : 2000;
+    if(batches < 1 || steps < 1)
+    {
+        fprintf(stderr, "batches and steps must be positive\n");
+        return 1;
+    }
+
+    tBatch *batch = malloc((size_t)batches * sizeof(tBatch));
+    unsigned char *actions = malloc((size_t)(steps > CHECK_STEPS ? steps : CHECK_STEPS) * BATCH_MAX);
+    if(!batch || !actions)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    int i;
+    for(i = 0; i < (steps > CHECK_STEPS ? steps : CHECK_STEPS) * BATCH_MAX; i++)
+    {
+        actions[i] = Rand() % BATCH_ACTIONS;
+    }
+
+    printf("%d games, %d steps\n", batches * BATCH_MAX, steps);
+    Run("BatchStep", BatchStep, batch, batches, steps, actions);
+
+#ifdef __AVX2__
+    PrepareShapes();
+    int differ = Check(actions, CHECK_STEPS);
+    if(differ >= 0)
+    {
+        printf("row kernel differs from BatchStep at step %d\n", differ);
+        return 1;
+    }
+    Run("AVX2 rows", StepRows, batch, batches, steps, actions);
+#else
+    printf("built without AVX2, no row kernel\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,69 @@
+#!/bin/sh
+# Runs the Bench build under QEMU and checks its report against the budgets
+# in bench.h.
+#
+#   BenchRun/benchrun.sh [Bench/timers.out]   From the project folder
+#
+# QEMU has no LM3S8962, so the lm3s6965evb stands in: the same core, timers,
+# SSI display and Ethernet. -icount shift=7 makes each guest instruction
+# 128 ns of virtual time, about one cycle of the 8 MHz clock the firmware
+# sets up, so SysTick counts instructions. align=off and sleep=off let the
+# run go as fast as the host can without changing what it measures.
+#
+# The firmware prints a "name cycles" line for each budget and exits with
+# a failure status if any was over. Every BENCH_BUDGET_name in bench.h must
+# have its line, at or under budget, and the exit status must be success,
+# which also covers the stack lines checked against the stack the firmware
+# measures. Set QEMU to another qemu-system-arm and BENCH_TIMEOUT to the
+# seconds allowed, 1800 by default.
+
+KERNEL=${1:-Bench/timers.out}
+QEMU=${QEMU:-qemu-system-arm}
+BENCH_TIMEOUT=${BENCH_TIMEOUT:-1800}
+HEADER=$(dirname "$0")/../bench.h
+REPORT=$(mktemp) || exit 1
+trap 'rm -f "$REPORT" "$REPORT.budgets"' EXIT
+
+if [ ! -f "$KERNEL" ]; then
+    echo "benchrun: no $KERNEL, build the Bench configuration first" >&2
+    exit 1
+fi
+
+# Semihosting output goes to stderr on some QEMU versions, keep both
+timeout "$BENCH_TIMEOUT" "$QEMU" -M lm3s6965evb -nographic -monitor none -serial null \
+    -icount shift=7,align=off,sleep=off \
+    -semihosting-config enable=on,target=native \
+    -kernel "$KERNEL" > "$REPORT" 2>&1
+STATUS=$?
+cat "$REPORT"
+
+FAIL=0
+if [ $STATUS -eq 124 ]; then
+    echo "benchrun: no result after $BENCH_TIMEOUT s" >&2
+    FAIL=1
+elif [ $STATUS -ne 0 ]; then
+    echo "benchrun: exit status $STATUS" >&2
+    FAIL=1
+fi
+
+sed -n 's/^#define BENCH_BUDGET_\([A-Z]*\) *\([0-9]*\).*/\1 \2/p' "$HEADER" | tr 'A-Z' 'a-z' > "$REPORT.budgets"
+if [ ! -s "$REPORT.budgets" ]; then
+    echo "benchrun: no budgets in $HEADER" >&2
+    FAIL=1
+fi
+
+while read -r NAME BUDGET; do
+    CYCLES=$(tr -d '\r' < "$REPORT" | awk -v name="$NAME" '$1 == name && NF == 2 { print $2 }' | tail -n 1)
+    if [ -z "$CYCLES" ]; then
+        echo "benchrun: $NAME missing from the report" >&2
+        FAIL=1
+    elif [ "$CYCLES" -gt "$BUDGET" ]; then
+        echo "benchrun: $NAME $CYCLES cycles, over its budget of $BUDGET" >&2
+        FAIL=1
+    fi
+done < "$REPORT.budgets"
+
+if [ $FAIL -eq 0 ]; then
+    echo "benchrun: every handler within budget"
+fi
+exit $FAIL
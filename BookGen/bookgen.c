@@ -0,0 +1,320 @@
+// Host tool that writes bookdata.h, the opening book for the firmware.
+//
+//   gcc -O2 -I.. -o bookgen bookgen.c ../game.c ../place.c ../eval.c ../book.c
+//   ./bookgen [games] [entries] > ../bookdata.h
+//
+// Plays the first BOOKGEN_PIECES pieces of each game, choosing every
+// placement with a two piece search: each straight drop of the current
+// piece, then the best placement of the next one by the board evaluator.
+// Boards the book can key are counted, the most frequent are kept, and a
+// seed is found for each hash bucket so every kept key gets its own slot.
+// Coverage goes to stderr.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "book.h"
+
+#define BOOKGEN_PIECES 15
+#define BOOKGEN_GAMES 20000
+#define BOOKGEN_ENTRIES 4096
+#define BOOKGEN_TABLE (1 << 20) // Distinct keys counted, a power of two
+#define BOOKGEN_SEEDS 65535     // Tried per bucket
+#define BOOKGEN_PLACEMENTS 64
+
+typedef struct
+{
+    unsigned long key;
+    unsigned long count;
+    unsigned char move; // orientation << 4 | (x + 3), as in bookMoves
+} tEntry;
+
+static tEntry table[BOOKGEN_TABLE];
+static tEntry *kept[BOOKGEN_TABLE];
+static tPlacement placements[BOOKGEN_PLACEMENTS];
+
+// book.c times its lookups, which do not matter here
+unsigned long SchedTimestamp(void)
+{
+    return 0;
+}
+
+unsigned long SchedElapsed(unsigned long from, unsigned long to)
+{
+    return 0;
+}
+
+static tEntry *Find(unsigned long key)
+{
+    unsigned long i = BookHash(key, 0x5EED) & (BOOKGEN_TABLE - 1);
+    while(table[i].count && table[i].key != key)
+    {
+        i = (i + 1) & (BOOKGEN_TABLE - 1);
+    }
+    return &table[i];
+}
+
+// Best evaluator score for the piece now in play, or 0 with *found clear
+static long BestScore(tGame *game, int *found)
+{
+    int count = PlaceFind(game, game->shape, game->orientation, game->locationX, game->locationY,
+                          placements, BOOKGEN_PLACEMENTS);
+    if(count > BOOKGEN_PLACEMENTS)
+    {
+        count = BOOKGEN_PLACEMENTS;
+    }
+
+    *found = count > 0;
+    if(!count)
+    {
+        return 0;
+    }
+
+    EvalPrepare(game);
+    long best = EvalPlacement(game->shape, &placements[0]);
+    int i;
+    for(i = 1; i < count; i++)
+    {
+        long score = EvalPlacement(game->shape, &placements[i]);
+        if(score > best)
+        {
+            best = score;
+        }
+    }
+    return best;
+}
+
+// Chooses the straight drop of the current piece that leaves the best
+// placement for the next. Returns 0 if no drop fits.
+static int Deep(tGame *game, int *bestOrientation, int *bestX)
+{
+    int chosen = 0;
+    long bestScore = 0;
+
+    int orientation, x;
+    for(orientation = 0; orientation < 4; orientation++)
+    {
+        for(x = -3; x < GAME_COLS; x++)
+        {
+            if(!GameFits(game, game->shape, orientation, x, game->locationY))
+            {
+                continue;
+            }
+
+            tGame next = *game;
+            next.orientation = orientation;
+            next.locationX = x;
+            next.buttons = 0;
+            GameStep(&next, INPUT_D);
+            GameStep(&next, 0); // Deal the next piece
+            if(next.gameover)
+            {
+                continue;
+            }
+
+            int found;
+            long score = BestScore(&next, &found);
+            if(found && (!chosen || score > bestScore))
+            {
+                chosen = 1;
+                bestScore = score;
+                *bestOrientation = orientation;
+                *bestX = x;
+            }
+        }
+    }
+
+    return chosen;
+}
+
+static int ByCount(const void *a, const void *b)
+{
+    unsigned long countA = (*(const tEntry **)a)->count;
+    unsigned long countB = (*(const tEntry **)b)->count;
+    return countA < countB ? 1 : countA > countB ? -1 : 0;
+}
+
+static int *bucketOf;
+static int *bucketSize;
+
+static int BySize(const void *a, const void *b)
+{
+    return bucketSize[*(const int *)b] - bucketSize[*(const int *)a];
+}
+
+int main(int argc, char **argv)
+{
+    int games = argc > 1 ? atoi(argv[1]) : BOOKGEN_GAMES;
+    int entries = argc > 2 ? atoi(argv[2]) : BOOKGEN_ENTRIES;
+
+    unsigned long positions = 0;
+    unsigned long keyed = 0;
+    int distinct = 0;
+
+    int seed;
+    for(seed = 1; seed <= games; seed++)
+    {
+        tGame game;
+        GameInit(&game, seed);
+        GameStep(&game, 0);
+
+        int piece;
+        for(piece = 0; piece < BOOKGEN_PIECES && !game.gameover; piece++)
+        {
+            int orientation, x;
+            if(!Deep(&game, &orientation, &x))
+            {
+                break;
+            }
+            positions++;
+
+            unsigned long key = BookKey(&game);
+            if(key != BOOK_NO_KEY)
+            {
+                tEntry *entry = Find(key);
+                if(!entry->count)
+                {
+                    if(distinct == BOOKGEN_TABLE / 2)
+                    {
+                        fprintf(stderr, "too many distinct boards\n");
+                        return 1;
+                    }
+                    entry->key = key;
+                    entry->move = (orientation << 4) | (x + 3);
+                    kept[distinct++] = entry;
+                }
+                entry->count++;
+                keyed++;
+            }
+
+            game.orientation = orientation;
+            game.locationX = x;
+            game.buttons = 0;
+            GameStep(&game, INPUT_D);
+            GameStep(&game, 0);
+        }
+    }
+
+    qsort(kept, distinct, sizeof(kept[0]), ByCount);
+    if(entries > distinct)
+    {
+        entries = distinct;
+    }
+
+    unsigned long covered = 0;
+    int i;
+    for(i = 0; i < entries; i++)
+    {
+        covered += kept[i]->count;
+    }
+
+    fprintf(stderr, "%lu positions, %lu keyed, %d distinct, %d kept covering %.1f%% of positions\n",
+            positions, keyed, distinct, entries, positions ? 100.0 * covered / positions : 0.0);
+
+    // Hash and displace, largest buckets first while the table is empty
+    int buckets = (entries + 2) / 3;
+    if(!buckets)
+    {
+        buckets = 1;
+    }
+    bucketOf = malloc(entries * sizeof(int));
+    bucketSize = calloc(buckets, sizeof(int));
+    int *order = malloc(buckets * sizeof(int));
+    unsigned short *seeds = calloc(buckets, sizeof(unsigned short));
+    tEntry **slots = calloc(entries ? entries : 1, sizeof(tEntry *));
+    int *members = malloc(entries * sizeof(int));
+    int *taken = malloc(entries * sizeof(int));
+
+    for(i = 0; i < entries; i++)
+    {
+        bucketOf[i] = BookHash(kept[i]->key, 0) % buckets;
+        bucketSize[bucketOf[i]]++;
+    }
+    for(i = 0; i < buckets; i++)
+    {
+        order[i] = i;
+    }
+    qsort(order, buckets, sizeof(int), BySize);
+
+    int b;
+    for(b = 0; b < buckets && bucketSize[order[b]]; b++)
+    {
+        int bucket = order[b];
+        int size = 0;
+        for(i = 0; i < entries; i++)
+        {
+            if(bucketOf[i] == bucket)
+            {
+                members[size++] = i;
+            }
+        }
+
+        unsigned long s;
+        for(s = 0; s < BOOKGEN_SEEDS; s++)
+        {
+            int k;
+            for(k = 0; k < size; k++)
+            {
+                taken[k] = BookHash(kept[members[k]]->key, s + 1) % entries;
+                int j;
+                for(j = 0; j < k && taken[j] != taken[k]; j++)
+                {
+                }
+                if(slots[taken[k]] || j < k)
+                {
+                    break;
+                }
+            }
+            if(k == size)
+            {
+                break;
+            }
+        }
+        if(s == BOOKGEN_SEEDS)
+        {
+            fprintf(stderr, "no seed places bucket %d, try another entry count\n", bucket);
+            return 1;
+        }
+
+        seeds[bucket] = s;
+        for(i = 0; i < size; i++)
+        {
+            slots[taken[i]] = kept[members[i]];
+        }
+    }
+
+    printf("#ifndef __BOOKDATA_H__\n#define __BOOKDATA_H__\n\n");
+    printf("// Generated by BookGen from %d games of %d pieces, do not edit. The\n", games, BOOKGEN_PIECES);
+    printf("// entries cover %.1f%% of the placements in those openings. Keys and moves\n",
+           positions ? 100.0 * covered / positions : 0.0);
+    printf("// are laid out as in book.c, moves as orientation << 4 | (x + 3).\n\n");
+    printf("#if GAME_COLS == 10\n\n");
+    printf("#define BOOK_ENTRIES %d\n#define BOOK_BUCKETS %d\n\n", entries, buckets);
+
+    printf("static const unsigned long bookKeys[BOOK_ENTRIES] =\n{");
+    for(i = 0; i < entries; i++)
+    {
+        printf("%s0x%08lX%s", i % 6 ? " " : "\n    ", slots[i]->key, i + 1 < entries ? "," : "");
+    }
+    printf("\n};\n\n");
+
+    printf("static const unsigned char bookMoves[BOOK_ENTRIES] =\n{");
+    for(i = 0; i < entries; i++)
+    {
+        printf("%s0x%02X%s", i % 12 ? " " : "\n    ", slots[i]->move, i + 1 < entries ? "," : "");
+    }
+    printf("\n};\n\n");
+
+    printf("static const unsigned short bookSeeds[BOOK_BUCKETS] =\n{");
+    for(i = 0; i < buckets; i++)
+    {
+        printf("%s%u%s", i % 12 ? " " : "\n    ", seeds[i], i + 1 < buckets ? "," : "");
+    }
+    printf("\n};\n\n");
+
+    printf("#else\n\n#define BOOK_ENTRIES 0 // Generated for ten columns only\n\n#endif\n\n#endif\n");
+    return 0;
+}
@@ -0,0 +1,269 @@
+// Host batch scoring for the board evaluator, with a benchmark against the
+// scalar EvalNetwork the firmware runs.
+//
+//   gcc -O2 -mavx2 -I.. -o evalbatch evalbatch.c ../eval.c ../place.c ../game.c
+//   ./evalbatch [boards]   Default 200000 boards
+//
+// The boards are the ones EvalChoose looks at in greedy games: every
+// placement of every piece, as EvalFeaturesIn measures them. Each is
+// scored by EvalNetwork, then again by the batch kernel, and the scores
+// must agree exactly. The time to measure the boards is reported as well,
+// since that is most of what scoring a placement costs.
+//
+// The batch holds the inputs of many boards as pairs of shorts packed in a
+// word, a row of words per input pair with one column per board. With
+// AVX2, each _mm256_madd_epi16 does two inputs of eight boards against a
+// pair of weights, the 32 bit sums the M3 works in. Without it, the batch
+// is unpacked and scored by EvalNetwork, so results are the same either
+// way. The weights must be the ones evalgen makes, with sums that fit a
+// 32 bit long.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "evalweights.h"
+
+#define EVAL_PAIRS ((EVAL_INPUTS + 1) / 2)
+#define EVAL_LANES 8          // Boards in one AVX2 vector
+#define EVAL_PLACEMENTS 64    // More than any piece has on an open board
+#define EVAL_REPEATS 20       // Passes over the boards for each timing
+
+typedef struct
+{
+    int count;
+    int size;                 // Columns allocated, a multiple of EVAL_LANES
+    unsigned int *pairs;      // [EVAL_PAIRS][size], input 2p low, 2p + 1 high
+} tEvalBatch;
+
+static void BatchPut(tEvalBatch *batch, int board, const int *features)
+{
+    int p;
+    for(p = 0; p < EVAL_PAIRS; p++)
+    {
+        int high = 2 * p + 1 < EVAL_INPUTS ? features[2 * p + 1] : 0;
+        batch->pairs[p * batch->size + board] = (unsigned short)features[2 * p] | (unsigned int)high << 16;
+    }
+}
+
+#ifdef __AVX2__
+
+// Weight pairs laid out as the inputs are, one broadcast word per pair
+static unsigned int w1Pairs[EVAL_HIDDEN][EVAL_PAIRS];
+static unsigned int linearPairs[EVAL_PAIRS];
+
+static unsigned int Pair(const short *weights, int p)
+{
+    int high = 2 * p + 1 < EVAL_INPUTS ? weights[2 * p + 1] : 0;
+    return (unsigned short)weights[2 * p] | (unsigned int)high << 16;
+}
+
+static void PairWeights(void)
+{
+    int k, p;
+    for(p = 0; p < EVAL_PAIRS; p++)
+    {
+        linearPairs[p] = Pair(evalLinear, p);
+        for(k = 0; k < EVAL_HIDDEN; k++)
+        {
+            w1Pairs[k][p] = Pair(evalW1[k], p);
+        }
+    }
+}
+
+static void BatchScore(const tEvalBatch *batch, long *scores)
+{
+    int b, k, p;
+    for(b = 0; b < batch->count; b += EVAL_LANES)
+    {
+        __m256i inputs[EVAL_PAIRS];
+        for(p = 0; p < EVAL_PAIRS; p++)
+        {
+            inputs[p] = _mm256_loadu_si256((const __m256i *)&batch->pairs[p * batch->size + b]);
+        }
+
+        __m256i out = _mm256_set1_epi32(evalB2);
+        for(p = 0; p < EVAL_PAIRS; p++)
+        {
+            out = _mm256_add_epi32(out, _mm256_madd_epi16(inputs[p], _mm256_set1_epi32(linearPairs[p])));
+        }
+
+        __m256i hidden = _mm256_setzero_si256();
+        for(k = 0; k < EVAL_HIDDEN; k++)
+        {
+            __m256i sum = _mm256_set1_epi32(evalB1[k]);
+            for(p = 0; p < EVAL_PAIRS; p++)
+            {
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(inputs[p], _mm256_set1_epi32(w1Pairs[k][p])));
+            }
+            sum = _mm256_srai_epi32(_mm256_max_epi32(sum, _mm256_setzero_si256()), EVAL_SHIFT1);
+            hidden = _mm256_add_epi32(hidden, _mm256_mullo_epi32(sum, _mm256_set1_epi32(evalW2[k])));
+        }
+        out = _mm256_add_epi32(out, _mm256_srai_epi32(hidden, EVAL_SHIFT2));
+
+        int lanes[EVAL_LANES];
+        _mm256_storeu_si256((__m256i *)lanes, out);
+        int n = batch->count - b < EVAL_LANES ? batch->count - b : EVAL_LANES;
+        int i;
+        for(i = 0; i < n; i++)
+        {
+            scores[b + i] = lanes[i];
+        }
+    }
+}
+
+#define BATCH_PATH "AVX2"
+
+#else
+
+static void BatchGet(const tEvalBatch *batch, int board, int *features)
+{
+    int i;
+    for(i = 0; i < EVAL_INPUTS; i++)
+    {
+        features[i] = (short)(batch->pairs[i / 2 * batch->size + board] >> (16 * (i & 1)));
+    }
+}
+
+static void PairWeights(void)
+{
+}
+
+static void BatchScore(const tEvalBatch *batch, long *scores)
+{
+    int features[EVAL_INPUTS];
+    int b;
+    for(b = 0; b < batch->count; b++)
+    {
+        BatchGet(batch, b, features);
+        scores[b] = EvalNetwork(features);
+    }
+}
+
+#define BATCH_PATH "scalar, built without AVX2"
+
+#endif
+
+static double Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+    int count = argc > 1 ? atoi(argv[1]) : 200000;
+    if(count < 1)
+    {
+        count = 200000;
+    }
+
+    tEvalBatch batch;
+    batch.count = count;
+    batch.size = (count + EVAL_LANES - 1) / EVAL_LANES * EVAL_LANES;
+    batch.pairs = calloc((size_t)EVAL_PAIRS * batch.size, sizeof(unsigned int));
+    int (*features)[EVAL_INPUTS] = malloc((size_t)count * sizeof(*features));
+    long *scalar = malloc((size_t)count * sizeof(long));
+    long *batched = malloc((size_t)count * sizeof(long));
+    if(!batch.pairs || !features || !scalar || !batched)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    PairWeights();
+
+    // Collect the boards from greedy games, timing the measuring alone
+    static tGame game;
+    static tPlacement placements[EVAL_PLACEMENTS];
+    tEvalBoard board;
+    tEvalStats stats;
+    board.stats = &stats;
+    double measure = 0;
+    int n = 0;
+    unsigned long seed = 1;
+    GameInit(&game, seed);
+    GameStep(&game, 0);
+    while(n < count)
+    {
+        int found = PlaceFind(&game, game.shape, game.orientation, game.locationX, game.locationY, placements,
+                              EVAL_PLACEMENTS);
+        if(game.gameover || !found)
+        {
+            GameInit(&game, ++seed);
+            GameStep(&game, 0);
+            continue;
+        }
+        if(found > EVAL_PLACEMENTS)
+        {
+            found = EVAL_PLACEMENTS;
+        }
+
+        double start = Now();
+        EvalPrepareIn(&board, &game);
+        int i;
+        for(i = 0; i < found && n < count; i++)
+        {
+            EvalFeaturesIn(&board, game.shape, &placements[i], features[n++]);
+        }
+        measure += Now() - start;
+
+        const tPlacement *placement = &placements[EvalChoose(&game, game.shape, placements, found)];
+        game.orientation = placement->orientation;
+        game.locationX = placement->x;
+        game.locationY = placement->y;
+        game.buttons = 0;
+        GameStep(&game, INPUT_D);
+        GameStep(&game, 0);
+    }
+
+    int i, r;
+    for(i = 0; i < count; i++)
+    {
+        BatchPut(&batch, i, features[i]);
+    }
+
+    double start = Now();
+    for(r = 0; r < EVAL_REPEATS; r++)
+    {
+        for(i = 0; i < count; i++)
+        {
+            scalar[i] = EvalNetwork(features[i]);
+        }
+    }
+    double scalarTime = (Now() - start) / EVAL_REPEATS;
+
+    start = Now();
+    for(r = 0; r < EVAL_REPEATS; r++)
+    {
+        BatchScore(&batch, batched);
+    }
+    double batchTime = (Now() - start) / EVAL_REPEATS;
+
+    int bad = 0;
+    for(i = 0; i < count; i++)
+    {
+        if(scalar[i] != batched[i])
+        {
+            if(!bad)
+            {
+                printf("board %d: scalar %ld, batch %ld\n", i, scalar[i], batched[i]);
+            }
+            bad++;
+        }
+    }
+
+    printf("%d boards from %lu games, %d inputs, %d hidden\n", count, seed, EVAL_INPUTS, EVAL_HIDDEN);
+    printf("measure        %6.1f ns/board, %6.1fM boards/s\n", measure / count * 1e9, count / measure / 1e6);
+    printf("scalar network %6.1f ns/board, %6.1fM boards/s\n", scalarTime / count * 1e9, count / scalarTime / 1e6);
+    printf("batch network  %6.1f ns/board, %6.1fM boards/s, %.1fx, %s\n", batchTime / count * 1e9,
+           count / batchTime / 1e6, scalarTime / batchTime, BATCH_PATH);
+    printf("%s\n", bad ? "scores differ" : "all scores match");
+    return bad != 0;
+}
@@ -0,0 +1,365 @@
+// Host tool that writes evalweights.h, the board evaluator's weights.
+//
+//   gcc -O2 -o evalgen evalgen.c -lm
+//   ./evalgen [columns=network.txt ...] > ../evalweights.h
+//
+// Every supported board width gets the seed network, which reproduces the
+// hand-tuned linear score exactly, unless a trained network is given for
+// it. A network file holds whitespace separated numbers, # to the end of a
+// line is a comment, in the order the evaluator uses them: the hidden
+// weights row by row, hidden biases, output weights, linear weights and the
+// output bias, all in output units of one per unit of score. They are
+// quantised to shorts with power of two scales, the shifts chosen so the
+// products fit a long on the target.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OUT_SCALE 16384 // Output units per unit of score
+#define MAX_COLS 10
+#define MAX_INPUTS (MAX_COLS + 3)
+#define MAX_HIDDEN (2 * (MAX_COLS - 1))
+#define PER_LINE 9
+
+// The hand-tuned linear score
+#define SEED_HEIGHT (-0.51)
+#define SEED_HOLE (-0.36)
+#define SEED_LINE 0.76
+#define SEED_BUMP (-0.18)
+
+static const int widths[] = { 10, 6 };
+#define WIDTHS (int)(sizeof(widths) / sizeof(widths[0]))
+
+typedef struct
+{
+    int cols;
+    int inputs;
+    int hidden;
+    double w1[MAX_HIDDEN][MAX_INPUTS];
+    double b1[MAX_HIDDEN];
+    double w2[MAX_HIDDEN];
+    double linear[MAX_INPUTS];
+    double b2;
+} tNetwork;
+
+typedef struct
+{
+    int shift1;
+    int shift2;
+    long w1[MAX_HIDDEN][MAX_INPUTS];
+    long b1[MAX_HIDDEN];
+    long w2[MAX_HIDDEN];
+    long linear[MAX_INPUTS];
+    long b2;
+} tQuantised;
+
+static const char *files[WIDTHS];
+
+// Inputs are the column heights, holes, row transitions and lines. Each
+// bumpiness step between neighbouring columns takes two hidden units,
+// relu(a - b) + relu(b - a).
+static void Seed(tNetwork *net)
+{
+    int i;
+    for(i = 0; i < net->cols - 1; i++)
+    {
+        net->w1[2 * i][i] = 1;
+        net->w1[2 * i][i + 1] = -1;
+        net->w1[2 * i + 1][i] = -1;
+        net->w1[2 * i + 1][i + 1] = 1;
+    }
+    for(i = 0; i < net->hidden; i++)
+    {
+        net->w2[i] = SEED_BUMP;
+    }
+    for(i = 0; i < net->cols; i++)
+    {
+        net->linear[i] = SEED_HEIGHT;
+    }
+    net->linear[net->cols] = SEED_HOLE;
+    net->linear[net->cols + 2] = SEED_LINE;
+}
+
+static double ReadNumber(FILE *file, const char *name)
+{
+    int c;
+    while((c = fgetc(file)) != EOF)
+    {
+        if(c == '#')
+        {
+            while((c = fgetc(file)) != EOF && c != '\n')
+            {
+            }
+        }
+        else if(!strchr(" \t\r\n", c))
+        {
+            ungetc(c, file);
+            double value;
+            if(fscanf(file, "%lf", &value) == 1)
+            {
+                return value;
+            }
+            break;
+        }
+    }
+
+    fprintf(stderr, "%s: too few numbers\n", name);
+    exit(1);
+}
+
+static void Load(tNetwork *net, const char *name)
+{
+    FILE *file = fopen(name, "r");
+    if(!file)
+    {
+        fprintf(stderr, "cannot open %s\n", name);
+        exit(1);
+    }
+
+    int i, k;
+    for(k = 0; k < net->hidden; k++)
+    {
+        for(i = 0; i < net->inputs; i++)
+        {
+            net->w1[k][i] = ReadNumber(file, name);
+        }
+    }
+    for(k = 0; k < net->hidden; k++)
+    {
+        net->b1[k] = ReadNumber(file, name);
+    }
+    for(k = 0; k < net->hidden; k++)
+    {
+        net->w2[k] = ReadNumber(file, name);
+    }
+    for(i = 0; i < net->inputs; i++)
+    {
+        net->linear[i] = ReadNumber(file, name);
+    }
+    net->b2 = ReadNumber(file, name);
+    fclose(file);
+}
+
+static long Round(double value)
+{
+    long rounded = lround(value);
+    if(rounded < -32768 || rounded > 32767)
+    {
+        fprintf(stderr, "weight %g does not fit a short\n", value);
+        exit(1);
+    }
+    return rounded;
+}
+
+// Largest input values: heights up to the tallest board, holes and
+// transitions as Measure caps them, and lines
+#define MAX_HEIGHT 40
+#define MAX_COUNT 127
+#define MAX_LINES 4
+
+static double InputMax(const tNetwork *net, int i)
+{
+    return i < net->cols ? MAX_HEIGHT : i < net->cols + 2 ? MAX_COUNT : MAX_LINES;
+}
+
+// Scales every weight for the shifts chosen so far
+static void Scale(const tNetwork *net, tQuantised *q, int scale1)
+{
+    double scale2 = ldexp(OUT_SCALE, q->shift1 + q->shift2 - scale1);
+    int i, k;
+    for(k = 0; k < net->hidden; k++)
+    {
+        for(i = 0; i < net->inputs; i++)
+        {
+            q->w1[k][i] = Round(ldexp(net->w1[k][i], scale1));
+        }
+        q->b1[k] = Round(ldexp(net->b1[k], scale1));
+        q->w2[k] = Round(net->w2[k] * scale2);
+    }
+    for(i = 0; i < net->inputs; i++)
+    {
+        q->linear[i] = Round(net->linear[i] * OUT_SCALE);
+    }
+    q->b2 = lround(net->b2 * OUT_SCALE);
+}
+
+// Returns 1 if no input can overflow a 32 bit sum in Network
+static int Fits(const tNetwork *net, const tQuantised *q)
+{
+    double hidden = 0;
+    double out = labs(q->b2);
+    int i, k;
+    for(k = 0; k < net->hidden; k++)
+    {
+        double sum = labs(q->b1[k]);
+        for(i = 0; i < net->inputs; i++)
+        {
+            sum += labs(q->w1[k][i]) * InputMax(net, i);
+        }
+        hidden += floor(ldexp(sum, -q->shift1)) * labs(q->w2[k]);
+    }
+    for(i = 0; i < net->inputs; i++)
+    {
+        out += labs(q->linear[i]) * InputMax(net, i);
+    }
+    return hidden < 2147483648.0 && out + ldexp(hidden, -q->shift2) < 2147483648.0;
+}
+
+// A first layer of whole numbers is kept exact with no shifts, as the seed
+// network is, so the book BookGen built on it stays valid. Anything else is
+// scaled by the largest power of two that fits, and half that scale is
+// shifted back out after the ReLU. The output weights take what remains of
+// OUT_SCALE, with as many bits below it as fit. Precision is then given
+// back, output weights first, until no input can overflow.
+static void Quantise(const tNetwork *net, tQuantised *q)
+{
+    double most1 = 0;
+    double most2 = 0;
+    int whole = 1;
+    int i, k;
+    for(k = 0; k < net->hidden; k++)
+    {
+        for(i = 0; i < net->inputs; i++)
+        {
+            most1 = fmax(most1, fabs(net->w1[k][i]));
+            whole &= net->w1[k][i] == floor(net->w1[k][i]);
+        }
+        most1 = fmax(most1, fabs(net->b1[k]));
+        whole &= net->b1[k] == floor(net->b1[k]);
+        most2 = fmax(most2, fabs(net->w2[k]));
+    }
+
+    int scale1 = 0;
+    while(!whole && most1 > 0 && scale1 < 12 && most1 * (1 << (scale1 + 1)) <= 32767)
+    {
+        scale1++;
+    }
+    q->shift1 = scale1 / 2;
+
+    q->shift2 = 0;
+    while(!whole && most2 > 0 && q->shift2 < 16 &&
+          most2 * ldexp(OUT_SCALE, q->shift1 + q->shift2 + 1 - scale1) <= 32767)
+    {
+        q->shift2++;
+    }
+
+    Scale(net, q, scale1);
+    while(!Fits(net, q))
+    {
+        if(q->shift2 > 0)
+        {
+            q->shift2--;
+        }
+        else if(q->shift1 < scale1)
+        {
+            q->shift1++;
+        }
+        else
+        {
+            fprintf(stderr, "network for %d columns can overflow\n", net->cols);
+            exit(1);
+        }
+        Scale(net, q, scale1);
+    }
+}
+
+// Prints count values PER_LINE to a line
+static void PrintList(const char *type, const char *name, const long *values, int count)
+{
+    printf("static const %s %s[%s] =\n{\n", type, name, !strcmp(name, "evalLinear") ? "EVAL_INPUTS" : "EVAL_HIDDEN");
+    int i;
+    for(i = 0; i < count; i++)
+    {
+        printf("%s%ld%s", i % PER_LINE ? " " : "    ", values[i],
+               i == count - 1 ? "\n" : i % PER_LINE == PER_LINE - 1 ? ",\n" : ",");
+    }
+    printf("};\n\n");
+}
+
+static void PrintNetwork(const tQuantised *q, const tNetwork *net)
+{
+    printf("#define EVAL_SHIFT1 %d\n", q->shift1);
+    printf("#define EVAL_SHIFT2 %d\n\n", q->shift2);
+
+    printf("static const short evalW1[EVAL_HIDDEN][EVAL_INPUTS] =\n{\n");
+    int i, k;
+    for(k = 0; k < net->hidden; k++)
+    {
+        printf("    {");
+        for(i = 0; i < net->inputs; i++)
+        {
+            printf("%s%3ld", i ? "," : "", q->w1[k][i]);
+        }
+        printf(" }%s\n", k < net->hidden - 1 ? "," : "");
+    }
+    printf("};\n\n");
+
+    PrintList("short", "evalB1", q->b1, net->hidden);
+    PrintList("short", "evalW2", q->w2, net->hidden);
+    PrintList("short", "evalLinear", q->linear, net->inputs);
+    printf("static const long evalB2 = %ld;\n\n", q->b2);
+}
+
+static tNetwork net;
+static tQuantised quantised;
+
+int main(int argc, char **argv)
+{
+    int i, w;
+    for(i = 1; i < argc; i++)
+    {
+        int cols = atoi(argv[i]);
+        const char *name = strchr(argv[i], '=');
+        for(w = 0; w < WIDTHS && widths[w] != cols; w++)
+        {
+        }
+        if(w == WIDTHS || !name)
+        {
+            fprintf(stderr, "usage: evalgen [columns=network.txt ...], columns 10 or 6\n");
+            return 1;
+        }
+        files[w] = name + 1;
+    }
+
+    printf("#ifndef __EVALWEIGHTS_H__\n"
+           "#define __EVALWEIGHTS_H__\n\n"
+           "// Generated by EvalGen/evalgen.c, do not edit. Board widths without a\n"
+           "// trained network get the seed weights, set so the network reproduces the\n"
+           "// hand-tuned linear score: -0.51 per cell of aggregate height, -0.36 per\n"
+           "// hole, +0.76 per line cleared, and -0.18 per cell of bumpiness, the height\n"
+           "// step between neighbouring columns. Each step takes two hidden units,\n"
+           "// relu(a - b) + relu(b - a).\n"
+           "//\n"
+           "// Inputs are plain integers, so any input scale is folded into the weights.\n"
+           "// Hidden sums are shifted right by EVAL_SHIFT1 after the ReLU and their\n"
+           "// weighted total by EVAL_SHIFT2 before it joins the linear term. The output\n"
+           "// is in units of 1/16384 and only meaningful relative to other boards.\n\n");
+
+    for(w = 0; w < WIDTHS; w++)
+    {
+        memset(&net, 0, sizeof(net));
+        net.cols = widths[w];
+        net.inputs = net.cols + 3;
+        net.hidden = 2 * (net.cols - 1);
+        if(files[w])
+        {
+            Load(&net, files[w]);
+        }
+        else
+        {
+            Seed(&net);
+        }
+        Quantise(&net, &quantised);
+
+        printf("#%s GAME_COLS == %d%s\n\n", w ? "elif" : "if", net.cols, files[w] ? " // Trained" : "");
+        PrintNetwork(&quantised, &net);
+    }
+
+    printf("#else\n"
+           "#error No evaluator weights for this board width\n"
+           "#endif\n\n"
+           "#endif\n");
+    return 0;
+}
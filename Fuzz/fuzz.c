@@ -0,0 +1,721 @@
+// Host harness that plays the same inputs through the game engine and a
+// reference engine written the way the original one in timers.c was: one
+// int per cell, full scans for collisions and full rows, and pieces rotated
+// from the original shape matrices. After every step the two must agree on
+// the piece, counters, score and game over; after every lock on GameHash as
+// well, and GameCheck must pass.
+//
+//   gcc -O2 -I.. -o fuzz fuzz.c ../game.c
+//   ./fuzz [files...]     Plays each file, or stdin, as one input (AFL: @@)
+//   ./fuzz -r [count]     Plays random games and reports steps per second
+//
+// Random games steer most pieces to a good place and drop them, so lines
+// clear and games run for a hundred pieces or more, with random held
+// masks, combinations, soft drops, gaps and garbage in between. A failing
+// game is written to fuzz-crash.bin, an input the first form replays.
+//
+// Each board variant needs its own build, with -DBOARD_VARIANT=1 or 2 as
+// the firmware takes it; garbage lines push the buffered board's stack up
+// into its hidden rows.
+//
+//   gcc -O2 -I.. -DBOARD_VARIANT=1 -o fuzz_buffered fuzz.c ../game.c
+//   gcc -O2 -I.. -DBOARD_VARIANT=2 -o fuzz_sprint fuzz.c ../game.c
+//
+//   clang -O2 -g -fsanitize=fuzzer,address -DFUZZ_LIBFUZZER -I.. -o fuzz fuzz.c ../game.c
+//   ./fuzz corpus/
+//
+// An input is a 4 byte seed, then one byte per entry: below 0xE0 the low
+// five bits are the button mask, held for 1 + 4 * (byte >> 5) ticks so
+// gravity is reached without huge inputs; 0xE0 and above queue 1 to 4
+// garbage lines. A mismatch prints the step and aborts.
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "game.h"
+
+#define FUZZ_MAX_INPUT 65536
+#define FUZZ_TAPS_MAX 16 // Taps towards a pose before dropping anyway
+#define FUZZ_CRASH_FILE "fuzz-crash.bin"
+#define HASH_BASIS 2166136261UL
+
+// The original shape matrices, each in its own n by n box
+static const int matrixSizes[7] = { 2, 4, 3, 3, 3, 3, 3 };
+static const int matrices[7][16] =
+{
+    { 1, 1, 1, 1 },
+    { 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0 },
+    { 0, 1, 1, 1, 1, 0, 0, 0, 0 },
+    { 1, 1, 0, 0, 1, 1, 0, 0, 0 },
+    { 1, 0, 0, 1, 0, 0, 1, 1, 0 },
+    { 0, 1, 0, 0, 1, 0, 1, 1, 0 },
+    { 1, 1, 1, 0, 1, 0, 0, 0, 0 }
+};
+
+static const int garbageLines[5] = { 0, 0, 1, 2, 4 };
+
+// Every shape and orientation as a 4x4 matrix, rotated clockwise in its box
+static int pieces[7][4][4][4];
+
+typedef struct
+{
+    int grid[GAME_ROWS][GAME_COLS]; // Shades as GAME_CELL reads them
+    int shape;
+    int nextShape;
+    int orientation;
+    int x;
+    int y;
+    int score;
+    int tetris;
+    int gameover;
+    int dropCounter;
+    int buttons;
+    unsigned long seed;
+    int garbageIn;
+    int garbageOut;
+    unsigned long locks;
+} tRef;
+
+static void PreparePieces(void)
+{
+    int shape, orientation, i, j;
+    for(shape = 0; shape < 7; shape++)
+    {
+        int n = matrixSizes[shape];
+        int m[4][4];
+        memset(m, 0, sizeof(m));
+        for(i = 0; i < n; i++)
+        {
+            for(j = 0; j < n; j++)
+            {
+                m[i][j] = matrices[shape][i * n + j];
+            }
+        }
+
+        for(orientation = 0; orientation < 4; orientation++)
+        {
+            memcpy(pieces[shape][orientation], m, sizeof(m));
+
+            int r[4][4];
+            memset(r, 0, sizeof(r));
+            for(i = 0; i < n; i++)
+            {
+                for(j = 0; j < n; j++)
+                {
+                    r[i][j] = m[n - 1 - j][i];
+                }
+            }
+            memcpy(m, r, sizeof(m));
+        }
+    }
+}
+
+static int RefRand(tRef *ref)
+{
+    ref->seed = (ref->seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (int)((ref->seed >> 16) & 0x7FFF);
+}
+
+static int RefFits(tRef *ref, int orientation, int x, int y)
+{
+    int i, j;
+    for(i = 0; i < 4; i++)
+    {
+        for(j = 0; j < 4; j++)
+        {
+            if(!pieces[ref->shape][orientation][i][j])
+            {
+                continue;
+            }
+            if(y + i < 0 || y + i >= GAME_ROWS || x + j < 0 || x + j >= GAME_COLS || ref->grid[y + i][x + j])
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int RefMove(tRef *ref, int x, int y)
+{
+    if(RefFits(ref, ref->orientation, x, y))
+    {
+        ref->x = x;
+        ref->y = y;
+        return 1;
+    }
+    return 0;
+}
+
+static void RefGarbage(tRef *ref, int numLines)
+{
+    int hole = RefRand(ref) % GAME_COLS;
+
+    int i, j;
+    for(i = 0; i < numLines; i++)
+    {
+        for(j = 0; j < GAME_COLS; j++)
+        {
+            if(ref->grid[i][j])
+            {
+                ref->gameover = 1;
+            }
+        }
+    }
+
+    for(i = 0; i < GAME_ROWS; i++)
+    {
+        for(j = 0; j < GAME_COLS; j++)
+        {
+            ref->grid[i][j] = i + numLines < GAME_ROWS ? ref->grid[i + numLines][j] : (j != hole ? GAME_CELL_GARBAGE : 0);
+        }
+    }
+}
+
+static void RefLock(tRef *ref)
+{
+    if(!RefFits(ref, ref->orientation, ref->x, ref->y))
+    {
+        ref->gameover = 1;
+        return;
+    }
+
+    int i, j, k;
+    for(i = 0; i < 4; i++)
+    {
+        for(j = 0; j < 4; j++)
+        {
+            if(pieces[ref->shape][ref->orientation][i][j])
+            {
+                ref->grid[ref->y + i][ref->x + j] = ref->shape + 1;
+            }
+        }
+    }
+
+    int lines = 0;
+    for(i = GAME_ROWS - 1; i >= 0; i--)
+    {
+        int full = 1;
+        for(j = 0; j < GAME_COLS; j++)
+        {
+            full &= ref->grid[i][j] != 0;
+        }
+        if(!full)
+        {
+            continue;
+        }
+
+        for(k = i; k > 0; k--)
+        {
+            memcpy(ref->grid[k], ref->grid[k - 1], sizeof(ref->grid[k]));
+        }
+        memset(ref->grid[0], 0, sizeof(ref->grid[0]));
+        lines++;
+        i++;
+    }
+
+    if(lines == 0)
+    {
+        ref->score += 10;
+    }
+    else if(lines == 4)
+    {
+        ref->score += ref->tetris ? 1200 : 800;
+        ref->tetris = 1;
+    }
+    else
+    {
+        ref->tetris = 0;
+        ref->score += lines * 100;
+    }
+    ref->locks++;
+
+    int sent = garbageLines[lines];
+    int cancelled = sent < ref->garbageIn ? sent : ref->garbageIn;
+    ref->garbageIn -= cancelled;
+    ref->garbageOut += sent - cancelled;
+    if(ref->garbageIn)
+    {
+        RefGarbage(ref, ref->garbageIn > GAME_ROWS - 1 ? GAME_ROWS - 1 : ref->garbageIn);
+        ref->garbageIn = 0;
+    }
+
+    ref->shape = -1;
+}
+
+static void RefInit(tRef *ref, unsigned long seed)
+{
+    memset(ref, 0, sizeof(tRef));
+    ref->shape = -1;
+    ref->nextShape = -1;
+    ref->seed = seed;
+}
+
+static void RefStep(tRef *ref, int input)
+{
+    if(ref->garbageIn > GAME_GARBAGE_MAX)
+    {
+        ref->garbageIn = GAME_GARBAGE_MAX;
+    }
+
+    if(ref->gameover)
+    {
+        return;
+    }
+
+    if(ref->shape < 0)
+    {
+        int r = RefRand(ref);
+        if(ref->nextShape < 0)
+        {
+            ref->nextShape = r % 7;
+        }
+        ref->shape = ref->nextShape;
+        ref->nextShape = r % 7;
+        ref->orientation = 0;
+        if(!RefMove(ref, GAME_SPAWN_X, GAME_SPAWN_Y))
+        {
+            ref->x = GAME_SPAWN_X;
+            ref->y = GAME_SPAWN_Y;
+            ref->gameover = 1;
+            return;
+        }
+    }
+
+    int pressed = input & ~ref->buttons;
+    int released = ~input & ref->buttons;
+    if(!(input & (input - 1)))
+    {
+        if((released & INPUT_RR) && RefFits(ref, (ref->orientation + 1) & 3, ref->x, ref->y))
+        {
+            ref->orientation = (ref->orientation + 1) & 3;
+            ref->seed = ref->dropCounter;
+        }
+        if(((pressed & INPUT_L) || ((input & INPUT_L) && ref->dropCounter % 10 == 0)) && RefMove(ref, ref->x - 1, ref->y))
+        {
+            ref->seed = ref->dropCounter;
+        }
+        if(((pressed & INPUT_R) || ((input & INPUT_R) && ref->dropCounter % 10 == 0)) && RefMove(ref, ref->x + 1, ref->y))
+        {
+            ref->seed = ref->dropCounter;
+        }
+        if(input & INPUT_U)
+        {
+            RefMove(ref, ref->x, ref->y + 1);
+        }
+        if(pressed & INPUT_D)
+        {
+            while(RefMove(ref, ref->x, ref->y + 1))
+            {
+            }
+            RefLock(ref);
+            ref->dropCounter = 0;
+        }
+    }
+
+    ref->buttons = input;
+
+    if(++ref->dropCounter == GAME_DROP_TICKS)
+    {
+        if(ref->shape >= 0 && !RefMove(ref, ref->x, ref->y + 1))
+        {
+            RefLock(ref);
+        }
+        ref->dropCounter = 0;
+    }
+}
+
+static void Write32(unsigned char *buf, unsigned long value)
+{
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+    buf[2] = (value >> 16) & 0xFF;
+    buf[3] = (value >> 24) & 0xFF;
+}
+
+// FNV-1a over a snapshot laid out as GameSave does
+static unsigned long RefHash(const tRef *ref)
+{
+    unsigned char buf[GAME_SNAPSHOT_SIZE];
+
+    int i, j;
+    for(i = 0; i < GAME_ROWS; i++)
+    {
+        for(j = 0; j < GAME_COLS; j += 2)
+        {
+            buf[i * GAME_ROW_BYTES + j / 2] = ref->grid[i][j] | (ref->grid[i][j + 1] << 4);
+        }
+    }
+
+    unsigned char *tail = &buf[GAME_BOARD_BYTES];
+    tail[0] = ref->shape + 1;
+    tail[1] = ref->nextShape + 1;
+    tail[2] = ref->orientation;
+    tail[3] = (unsigned char)ref->x;
+    tail[4] = (unsigned char)ref->y;
+    tail[5] = ref->dropCounter;
+    tail[6] = ref->buttons;
+    tail[7] = (ref->tetris ? 1 : 0) | (ref->gameover ? 2 : 0);
+    tail[8] = ref->garbageIn;
+    tail[9] = ref->garbageOut;
+    Write32(&tail[10], ref->score);
+    Write32(&tail[14], ref->seed);
+
+    unsigned long hash = HASH_BASIS;
+    for(i = 0; i < GAME_SNAPSHOT_SIZE; i++)
+    {
+        hash = ((hash ^ buf[i]) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    return hash;
+}
+
+static tGame game;
+static tRef ref;
+static unsigned long long steps = 0;
+static unsigned long tick;
+static unsigned long hashedLocks; // Locks up to which the grids were compared
+
+static unsigned char input[FUZZ_MAX_INPUT];
+static size_t recorded = 0; // Bytes of a random input played so far, kept for replay
+
+static void Fail(const char *what, int mask)
+{
+    fprintf(stderr, "%s differs at tick %lu, input 0x%02X: score %d/%d, game over %d/%d\n",
+            what, tick, mask, game.score, ref.score, game.gameover, ref.gameover);
+    if(recorded)
+    {
+        FILE *file = fopen(FUZZ_CRASH_FILE, "wb");
+        if(file)
+        {
+            fwrite(input, 1, recorded, file);
+            fclose(file);
+            fprintf(stderr, "input written to %s\n", FUZZ_CRASH_FILE);
+        }
+    }
+    abort();
+}
+
+// Compares the engines after a step. The piece, counters and score are
+// compared every step, and agreeing with the reference keeps the piece
+// where it fits. The grid and its metrics only change when a piece locks,
+// so GameCheck and the snapshot hashes, grids included, run once the lock
+// counts move and at game over; a grid that changed without a lock still
+// shows at the next one.
+static void Compare(int mask)
+{
+    if(game.score != ref.score)
+    {
+        Fail("score", mask);
+    }
+    if(game.gameover != ref.gameover)
+    {
+        Fail("game over", mask);
+    }
+    if(game.locks != ref.locks)
+    {
+        Fail("lock count", mask);
+    }
+    if(game.shape != ref.shape || game.nextShape != ref.nextShape || game.orientation != ref.orientation ||
+       game.locationX != ref.x || game.locationY != ref.y)
+    {
+        Fail("piece", mask);
+    }
+    if(game.dropCounter != ref.dropCounter || game.buttons != ref.buttons || game.seed != ref.seed ||
+       !game.tetris != !ref.tetris || game.garbageIn != ref.garbageIn || game.garbageOut != ref.garbageOut)
+    {
+        Fail("state", mask);
+    }
+
+    if(game.locks == hashedLocks && !game.gameover)
+    {
+        return;
+    }
+    hashedLocks = game.locks;
+
+    int check = GameCheck(&game);
+    if(check != GAME_OK)
+    {
+        fprintf(stderr, "GameCheck %d: ", check);
+        Fail("invariant", mask);
+    }
+    if(GameHash(&game, HASH_BASIS) != RefHash(&ref))
+    {
+        Fail("hash", mask);
+    }
+}
+
+static void Start(unsigned long seed)
+{
+    GameInit(&game, seed);
+    RefInit(&ref, seed);
+    tick = 0;
+    hashedLocks = 0;
+}
+
+// Plays one input entry through both engines, aborting on the first difference
+static void PlayEntry(unsigned char entry)
+{
+    if(entry >= 0xE0)
+    {
+        int lines = 1 + (entry & 3);
+        game.garbageIn += lines;
+        ref.garbageIn += lines;
+        return;
+    }
+
+    int mask = entry & 0x1F;
+    int hold = 1 + 4 * (entry >> 5);
+    while(hold-- && !game.gameover)
+    {
+        GameStep(&game, mask);
+        RefStep(&ref, mask);
+        tick++;
+        steps++;
+        Compare(mask);
+    }
+}
+
+static unsigned long Read32(const unsigned char *buf)
+{
+    return buf[0] | (buf[1] << 8) | ((unsigned long)buf[2] << 16) | ((unsigned long)buf[3] << 24);
+}
+
+// Plays one input, a seed and then the entries, as the format above
+static void Play(const unsigned char *data, size_t size)
+{
+    unsigned long seed = 1;
+    if(size >= 4)
+    {
+        seed = Read32(data);
+        data += 4;
+        size -= 4;
+    }
+
+    Start(seed);
+    size_t i;
+    for(i = 0; i < size && !game.gameover; i++)
+    {
+        PlayEntry(data[i]);
+    }
+}
+
+#ifdef FUZZ_LIBFUZZER
+
+int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size)
+{
+    static int prepared = 0;
+    if(!prepared)
+    {
+        PreparePieces();
+        prepared = 1;
+    }
+    Play(data, size);
+    return 0;
+}
+
+#else
+
+static int targetOrientation; // Pose chosen for the piece in play
+static int targetX;
+static int taps;                 // Taps made towards it
+static unsigned long plannedSpawns;
+
+// Scores the board a pose leaves, with the weights of the well known
+// four feature player: stack height, lines cleared, holes and bumpiness
+static int PoseScore(int orientation, int x, int y)
+{
+    static tGame after;
+    memcpy(&after, &game, sizeof(tGame));
+    after.orientation = orientation;
+    after.locationX = x;
+    after.locationY = y;
+    after.buttons = 0;
+    after.garbageIn = 0;
+    GameStep(&after, INPUT_D);
+
+    int height = 0;
+    int holes = 0;
+    int bumps = 0;
+    int j;
+    for(j = 0; j < GAME_COLS; j++)
+    {
+        height += after.heights[j];
+        holes += after.holes[j];
+        if(j)
+        {
+            bumps += abs(after.heights[j] - after.heights[j - 1]);
+        }
+    }
+    return 76 * after.lastLock.lines - 51 * height - 36 * holes - 18 * bumps;
+}
+
+// Plans the piece just dealt into the best place any of its poses reaches
+// from the spawn column, reached by taps of rotate and the sides and a hard
+// drop.
+// Filling low spots without covering holes clears lines, so games run long
+// enough to reach deep stacks, garbage and the hidden rows. Every few
+// pieces a pose is picked at random instead.
+static void PlanPiece(void)
+{
+    int bestOrientation = 0;
+    int bestX = game.locationX;
+    int bestScore = INT_MIN;
+    int random = rand() % 16 == 0;
+    int orientation, x;
+    for(orientation = 0; orientation < 4; orientation++)
+    {
+        for(x = -3; x < GAME_COLS; x++)
+        {
+            if(!GameFits(&game, game.shape, orientation, x, game.locationY))
+            {
+                continue;
+            }
+            int y = game.locationY + GameDropDistanceAt(&game, game.shape, orientation, x, game.locationY);
+            int score = random ? rand() : PoseScore(orientation, x, y);
+            if(score > bestScore)
+            {
+                bestScore = score;
+                bestOrientation = orientation;
+                bestX = x;
+            }
+        }
+    }
+
+    targetOrientation = bestOrientation;
+    targetX = bestX;
+    taps = 0;
+}
+
+// Next tap towards the chosen pose, from wherever the piece is now, so
+// the random entries in between only delay it. Rotation turns on release,
+// so a held button is let go first. A pose the piece cannot reach, with
+// rotation blocked, ends in a drop where it is.
+static unsigned char Steer(void)
+{
+    if(game.buttons)
+    {
+        return 0;
+    }
+    if(taps++ < FUZZ_TAPS_MAX)
+    {
+        if(game.orientation != targetOrientation)
+        {
+            return INPUT_RR;
+        }
+        if(game.locationX != targetX)
+        {
+            return game.locationX < targetX ? INPUT_R : INPUT_L;
+        }
+    }
+    return INPUT_D;
+}
+
+// Next entry of a random input, made while it plays. Mostly the planned
+// taps, with button masks held for random durations, combinations the game
+// ignores, soft drops, gaps and the odd garbage queue mixed in.
+static unsigned char RandomEntry(void)
+{
+    if(game.shape < 0)
+    {
+        return 0; // The next step deals a piece
+    }
+    if(game.spawns != plannedSpawns)
+    {
+        plannedSpawns = game.spawns;
+        PlanPiece();
+    }
+
+    int r = rand();
+    int hold = (r >> 7) % 7 << 5; // 0xE0 and above is garbage
+    switch(r % 128)
+    {
+    case 0:
+        return r >> 7 & 7 ? hold : 0xE0 | (r >> 10 & 3); // Gap, or now and then garbage
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+        return hold | (r >> 10 & 0x1F); // Any mask
+    case 5:
+    case 6:
+        return hold | (INPUT_L | INPUT_R) << (r >> 10 & 1); // Combination
+    case 7:
+    case 8:
+        return hold | INPUT_U; // Soft drop
+    case 9:
+    case 10:
+        return hold; // Gap
+    default:
+        return Steer();
+    }
+}
+
+// Plays one random game until it ends or the input buffer fills. The
+// entries are recorded as they are made, so a failing game is written out
+// for replay as an ordinary input.
+static void PlayRandom(void)
+{
+    unsigned long seed = (unsigned long)rand() << 16 ^ rand();
+    Write32(input, seed);
+    recorded = 4;
+
+    Start(seed);
+    plannedSpawns = 0;
+    while(!game.gameover && recorded < FUZZ_MAX_INPUT)
+    {
+        unsigned char entry = RandomEntry();
+        input[recorded++] = entry;
+        PlayEntry(entry);
+    }
+}
+
+static size_t ReadInput(FILE *file)
+{
+    return fread(input, 1, sizeof(input), file);
+}
+
+int main(int argc, char **argv)
+{
+    PreparePieces();
+
+    if(argc > 1 && !strcmp(argv[1], "-r"))
+    {
+        int count = argc > 2 ? atoi(argv[2]) : 1000;
+        unsigned long long locks = 0;
+        clock_t start = clock();
+        int i;
+        for(i = 0; i < count; i++)
+        {
+            PlayRandom();
+            locks += game.locks;
+        }
+        double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf("%d games, %llu steps, %llu pieces, %.0f steps/s\n", count, steps, locks,
+               seconds > 0 ? steps / seconds : 0.0);
+        return 0;
+    }
+
+    if(argc == 1)
+    {
+        Play(input, ReadInput(stdin));
+    }
+
+    int i;
+    for(i = 1; i < argc; i++)
+    {
+        FILE *file = fopen(argv[i], "rb");
+        if(!file)
+        {
+            fprintf(stderr, "cannot open %s\n", argv[i]);
+            return 1;
+        }
+        Play(input, ReadInput(file));
+        fclose(file);
+    }
+    printf("%llu steps, no differences\n", steps);
+    return 0;
+}
+
+#endif
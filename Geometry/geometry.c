@@ -0,0 +1,292 @@
+// Host benchmark of the compile-time board geometry against the generic
+// loops it replaced, where the board size and cell size were variables
+// read at run time.
+//
+//   gcc -O2 -I.. -o geometry geometry.c ../game.c ../render.c ../frame.c ../anim.c -x c ../graphics.cpp
+//   ./geometry
+//
+// Build with -DBOARD_VARIANT=1 or 2 for the other boards. Each kernel runs
+// over the same random boards both ways: collision tests of every pose of
+// every shape (GameFits), filled-column masks of every row (GameRowBits)
+// and drawing the board into a frame (RenderBoard). The results must match
+// before the times mean anything, so the counts and frames are compared
+// first. The target compiler unrolls further than gcc does here, so this
+// shows the direction rather than the figure on the board.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "game.h"
+#include "frame.h"
+#include "graphics.h"
+#include "render.h"
+
+#define GEOMETRY_BOARDS 32
+#define GEOMETRY_ROUNDS 200
+
+// Board geometry as it was before the variants, variables the compiler
+// cannot fold. Not static, so nothing can assume the values set in main.
+typedef struct
+{
+    int cols;
+    int rows;
+    int hidden;
+    int rowBytes;
+    int cellSize;
+} tGeometry;
+
+tGeometry geometry;
+
+static tGame boards[GEOMETRY_BOARDS];
+static unsigned char frames[2][FRAME_BYTES];
+
+// The generic kernels are kept out of line like the ones in game.c and
+// render.c, which the benchmark reaches through a call into another file
+
+static int GenericCell(const unsigned char *grid, int x, int y)
+{
+    return (grid[y * geometry.rowBytes + (x >> 1)] >> ((x & 1) << 2)) & 0xF;
+}
+
+__attribute__((noinline))
+static int GenericFits(const unsigned char *grid, int mask, int newX, int newY)
+{
+    int i, j;
+    for(i = 0; i < 4; i++)
+    {
+        for(j = 0; j < 4; j++)
+        {
+            if(mask & (1 << (i * 4 + j)))
+            {
+                int thisY = newY + i;
+                if(thisY < 0 || thisY > geometry.rows - 1)
+                {
+                    return 0;
+                }
+
+                int thisX = newX + j;
+                if(thisX < 0 || thisX > geometry.cols - 1)
+                {
+                    return 0;
+                }
+
+                if(GenericCell(grid, thisX, thisY))
+                {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    return 1;
+}
+
+__attribute__((noinline))
+static unsigned short GenericRowBits(const unsigned char *grid, int row)
+{
+    unsigned short bits = 0;
+    int j;
+    for(j = 0; j < geometry.cols; j++)
+    {
+        if(GenericCell(grid, j, row))
+        {
+            bits |= 1 << j;
+        }
+    }
+    return bits;
+}
+
+__attribute__((noinline))
+static void GenericDrawBoard(unsigned char *frame, const unsigned char *grid, int x, int y)
+{
+    int i, j;
+    for(i = 0; i < geometry.rows - geometry.hidden; i++)
+    {
+        for(j = 0; j < geometry.cols; j++)
+        {
+            int cell = GenericCell(grid, j, geometry.hidden + i);
+            FrameImageDraw(frame, cell ? shades[cell - 1] : clear,
+                           x + geometry.cellSize * j, y + geometry.cellSize * i,
+                           geometry.cellSize, geometry.cellSize);
+        }
+    }
+}
+
+// Random stacks up to three quarters of the visible rows, each cell a shade
+static void MakeBoards(void)
+{
+    int b, i, j;
+    for(b = 0; b < GEOMETRY_BOARDS; b++)
+    {
+        tGame *game = &boards[b];
+        GameInit(game, b + 1);
+
+        int top = GAME_ROWS - 1 - rand() % (GAME_VISIBLE_ROWS * 3 / 4);
+        for(i = top; i < GAME_ROWS; i++)
+        {
+            for(j = 0; j < GAME_COLS; j++)
+            {
+                if(rand() % 4)
+                {
+                    game->grid[i][j >> 1] |= (1 + rand() % GAME_CELL_GARBAGE) << ((j & 1) << 2);
+                }
+            }
+        }
+    }
+}
+
+static unsigned long FitsSpecialised(void)
+{
+    unsigned long fits = 0;
+    int b, shape, orientation, x, y;
+    for(b = 0; b < GEOMETRY_BOARDS; b++)
+    {
+        for(shape = 0; shape < 7; shape++)
+        {
+            for(orientation = 0; orientation < 4; orientation++)
+            {
+                for(y = -3; y < GAME_ROWS; y++)
+                {
+                    for(x = -3; x < GAME_COLS; x++)
+                    {
+                        fits += GameFits(&boards[b], shape, orientation, x, y);
+                    }
+                }
+            }
+        }
+    }
+    return fits;
+}
+
+static unsigned long FitsGeneric(void)
+{
+    unsigned long fits = 0;
+    int b, shape, orientation, x, y;
+    for(b = 0; b < GEOMETRY_BOARDS; b++)
+    {
+        const unsigned char *grid = (const unsigned char *)boards[b].grid;
+        for(shape = 0; shape < 7; shape++)
+        {
+            for(orientation = 0; orientation < 4; orientation++)
+            {
+                int mask = shapeMasks[shape][orientation];
+                for(y = -3; y < geometry.rows; y++)
+                {
+                    for(x = -3; x < geometry.cols; x++)
+                    {
+                        fits += GenericFits(grid, mask, x, y);
+                    }
+                }
+            }
+        }
+    }
+    return fits;
+}
+
+static unsigned long RowsSpecialised(void)
+{
+    unsigned long sum = 0;
+    int b, i;
+    for(b = 0; b < GEOMETRY_BOARDS; b++)
+    {
+        for(i = 0; i < GAME_ROWS; i++)
+        {
+            sum = sum * 31 + GameRowBits(&boards[b], i);
+        }
+    }
+    return sum;
+}
+
+static unsigned long RowsGeneric(void)
+{
+    unsigned long sum = 0;
+    int b, i;
+    for(b = 0; b < GEOMETRY_BOARDS; b++)
+    {
+        const unsigned char *grid = (const unsigned char *)boards[b].grid;
+        for(i = 0; i < geometry.rows; i++)
+        {
+            sum = sum * 31 + GenericRowBits(grid, i);
+        }
+    }
+    return sum;
+}
+
+// Boards have no piece in play or dealt, so RenderBoard draws only the grid
+static unsigned long DrawSpecialised(void)
+{
+    int b;
+    for(b = 0; b < GEOMETRY_BOARDS; b++)
+    {
+        RenderBoard(frames[0], &boards[b], &singleView);
+    }
+    return frames[0][FRAME_BYTES / 2];
+}
+
+static unsigned long DrawGeneric(void)
+{
+    int b;
+    for(b = 0; b < GEOMETRY_BOARDS; b++)
+    {
+        GenericDrawBoard(frames[1], (const unsigned char *)boards[b].grid, BOARD_X, BOARD_Y);
+    }
+    return frames[1][FRAME_BYTES / 2];
+}
+
+static double Time(unsigned long (*kernel)(void), unsigned long *result)
+{
+    clock_t start = clock();
+    int round;
+    for(round = 0; round < GEOMETRY_ROUNDS; round++)
+    {
+        *result += kernel();
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static int Compare(const char *name, unsigned long (*specialised)(void), unsigned long (*generic)(void), unsigned long calls)
+{
+    unsigned long a = specialised();
+    unsigned long b = generic();
+    if(a != b)
+    {
+        printf("%s: results differ, %lu and %lu\n", name, a, b);
+        return 1;
+    }
+
+    unsigned long sink = 0;
+    double fixed = Time(specialised, &sink);
+    double variable = Time(generic, &sink);
+    calls *= (unsigned long)GEOMETRY_ROUNDS * GEOMETRY_BOARDS;
+    printf("%-6s %8.2f ns/call specialised %8.2f ns/call generic, %.2fx (%lu)\n", name,
+           fixed * 1e9 / calls, variable * 1e9 / calls, fixed > 0 ? variable / fixed : 0.0, sink & 1);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    geometry.cols = GAME_COLS;
+    geometry.rows = GAME_ROWS;
+    geometry.hidden = GAME_HIDDEN_ROWS;
+    geometry.rowBytes = GAME_ROW_BYTES;
+    geometry.cellSize = CELL_SIZE;
+
+    srand(1);
+    MakeBoards();
+
+    int bad = 0;
+    DrawSpecialised();
+    DrawGeneric();
+    if(memcmp(frames[0], frames[1], FRAME_BYTES))
+    {
+        printf("draw: frames differ\n");
+        bad = 1;
+    }
+
+    printf("%dx%d board, %d hidden rows\n", GAME_COLS, GAME_ROWS, GAME_HIDDEN_ROWS);
+    bad += Compare("fits", FitsSpecialised, FitsGeneric, 28UL * (GAME_ROWS + 3) * (GAME_COLS + 3));
+    bad += Compare("rows", RowsSpecialised, RowsGeneric, GAME_ROWS);
+    bad += Compare("draw", DrawSpecialised, DrawGeneric, 1);
+    return bad != 0;
+}
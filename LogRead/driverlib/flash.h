@@ -0,0 +1,10 @@
+#ifndef __FLASH_H__
+#define __FLASH_H__
+
+// Host stand-in for the log reader's -g mode, which keeps the region in
+// memory and writes it out when it fills
+extern long FlashProgram(unsigned long *pulData, unsigned long ulAddress, unsigned long ulCount);
+extern long FlashErase(unsigned long ulAddress);
+extern void FlashUsecSet(unsigned long ulClocks);
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+
+// Host stand-in for the log reader's -g mode
+
+typedef unsigned char tBoolean;
+
+#endif
@@ -0,0 +1,853 @@
+// Host tool that decodes game logs from dumps of their flash region and
+// sums them up.
+//
+//   gcc -O2 -pthread -I. -I.. -o logread logread.c ../gamelog.c ../game.c ../place.c ../eval.c
+//   ./logread [-s] [-t threads] [dump.bin]   Dumps of GAMELOG_SIZE bytes from GAMELOG_BASE, back to back
+//   ./logread -g [regions] > dump.bin        Writes regions of logged self-play games
+//
+// The file is memory mapped, or read from stdin if none is given, and may
+// hold any number of regions, each a log of its own. Without -s the tool
+// prints one line per piece: "piece shape x y orientation lines score
+// height", and the report goes to stderr. With -s only the report is
+// printed.
+//
+// Reading takes two passes, each shared out over the threads, default 4.
+// First every region is walked from header to header, as GameLogInit
+// walks it, and every footer must index the blocks written since the one
+// before it. That leaves a list of the blocks, which is then cut into a
+// run of blocks per thread, each decoded and summed on its own. A game
+// that spans two runs is joined up after. Every column must unpack to
+// exactly one value per record. Listing pieces takes one thread so they
+// print in order. Problems go to stderr and make the exit status 1.
+//
+// A game starts at a block whose first piece is 0, or at the start of a
+// region. The report gives score and length percentiles over the games,
+// how many pieces cleared each number of lines, stack height percentiles
+// over the pieces, and per shape the droughts: the pieces dealt between
+// two of that shape in the same game.
+//
+// -g plays games with the board evaluator, a placement in eight picked at
+// random so they end, and logs them through gamelog.c into a region in
+// memory. A region is written out when it fills, the game in play cut
+// short there, as the board would leave it.
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "gamelog.h"
+
+#define LOG_COLUMNS 7
+#define LOG_HEADER 12
+#define LOG_RECORD_BYTES 8
+#define LOG_SLACK 16      // Bytes Unpack may write past a column
+#define LOG_THREADS 64
+#define LOG_LINES 5       // 0 to 4 lines cleared
+#define LOG_HEIGHTS 256
+#define LOG_DROUGHTS 256  // Drought lengths counted one by one, longer ones in the last
+#define LOG_PLACEMENTS 64 // More than any piece has on an open board
+#define LOG_GAME_PIECES 5000 // Longest game -g plays
+
+// Bytes per record in each column, in file order, as gamelog.c writes them
+static const unsigned char columnWidth[LOG_COLUMNS] = { 1, 1, 1, 1, 1, 2, 1 };
+
+static const unsigned char *map;
+static unsigned long long mapSize;
+static unsigned long regions;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static int errors = 0;
+
+// Blocks found in one share of the regions, as file offsets
+typedef struct
+{
+    unsigned long long *blocks;
+    unsigned long count;
+    unsigned long size;
+    unsigned long footers;
+    unsigned long long used; // Bytes of the regions in use
+    unsigned long from;      // Regions [from, to)
+    unsigned long to;
+    pthread_t thread;
+} tIndex;
+
+// Part of one game. Piece numbers are those of the log, counted from the
+// start of the game.
+typedef struct
+{
+    int active;
+    int continues;      // Began before the run that holds it
+    unsigned long score;
+    unsigned long pieces;
+    long first[7];      // First and last of each shape in this part, -1 if none
+    long last[7];
+} tPart;
+
+typedef struct
+{
+    unsigned long *scores; // Of each finished game
+    unsigned long *pieces;
+    unsigned long games;
+    unsigned long size;
+    unsigned long records;
+    unsigned long lines[LOG_LINES];
+    unsigned long shapes[8];    // The last for values that are not a shape
+    unsigned long heights[LOG_HEIGHTS];
+    unsigned long droughts[7][LOG_DROUGHTS];
+    unsigned long longest[7];
+} tSums;
+
+// One thread's run of blocks
+typedef struct
+{
+    unsigned long from; // Blocks [from, to) of the list
+    unsigned long to;
+    int listing;
+    unsigned char *columns;
+    tPart head; // The game the run began inside, once it has ended
+    tPart game; // The game in play at the end of the run
+    tSums sums;
+    pthread_t thread;
+} tRun;
+
+static tIndex indexes[LOG_THREADS];
+static tRun runs[LOG_THREADS];
+static unsigned long long *blocks; // Every block, in file order
+static unsigned long blockCount;
+
+static unsigned long Read16(const unsigned char *buf)
+{
+    return buf[0] | (buf[1] << 8);
+}
+
+static unsigned long Read32(const unsigned char *buf)
+{
+    return Read16(buf) | (Read16(buf + 2) << 16);
+}
+
+static void Problem(unsigned long long offset, const char *what)
+{
+    pthread_mutex_lock(&lock);
+    fprintf(stderr, "0x%05llX: %s\n", offset, what);
+    errors++;
+    pthread_mutex_unlock(&lock);
+}
+
+static int Grow(void **array, unsigned long *size, unsigned long count, size_t item)
+{
+    if(count < *size)
+    {
+        return 1;
+    }
+
+    unsigned long size2 = *size ? 2 * *size : 1024;
+    void *grown = realloc(*array, size2 * item);
+    if(!grown)
+    {
+        return 0;
+    }
+    *array = grown;
+    *size = size2;
+    return 1;
+}
+
+// Reverses Pack. Returns the unpacked length, or -1 if the input overruns.
+// Short literals and runs are copied LOG_SLACK bytes at a time, which may
+// write past the end of the column into out's slack; the column after is
+// unpacked over it.
+static int Unpack(const unsigned char *in, int length, unsigned char *out, int max)
+{
+    int count = 0;
+    int i = 0;
+    while(i < length)
+    {
+        int control = in[i++];
+        if(control < 128)
+        {
+            int literal = control + 1;
+            if(i + literal > length || count + literal > max)
+            {
+                return -1;
+            }
+            if(i + LOG_SLACK <= length)
+            {
+                memcpy(&out[count], &in[i], LOG_SLACK);
+                if(literal > LOG_SLACK)
+                {
+                    memcpy(&out[count + LOG_SLACK], &in[i + LOG_SLACK], literal - LOG_SLACK);
+                }
+            }
+            else
+            {
+                memcpy(&out[count], &in[i], literal);
+            }
+            count += literal;
+            i += literal;
+        }
+        else if(control > 128)
+        {
+            int run = 257 - control;
+            if(i >= length || count + run > max)
+            {
+                return -1;
+            }
+            memset(&out[count], in[i++], run <= LOG_SLACK ? LOG_SLACK : run);
+            count += run;
+        }
+    }
+    return count;
+}
+
+// Checks a footer against the blocks written since the last one
+static void Footer(unsigned long long at, const unsigned char *data, unsigned long bytes,
+                   const unsigned long *pendingOffset, const unsigned long *pendingFirst, int pending)
+{
+    unsigned long entries = Read16(&data[6]);
+    if(bytes != 8 + 8 * entries)
+    {
+        Problem(at, "footer length does not match its entries");
+        entries = (bytes - 8) / 8;
+    }
+    if((int)entries != pending)
+    {
+        Problem(at, "footer does not index every block before it");
+    }
+
+    unsigned long e;
+    for(e = 0; e < entries && (int)e < pending; e++)
+    {
+        if(Read32(&data[8 + 8 * e]) != pendingOffset[e] || Read32(&data[12 + 8 * e]) != pendingFirst[e])
+        {
+            Problem(at, "footer entry does not match its block");
+        }
+    }
+}
+
+// Walks one region, adding its blocks to the list
+static void Walk(tIndex *index, unsigned long region)
+{
+    unsigned long long base = (unsigned long long)region * GAMELOG_SIZE;
+    unsigned long length = mapSize - base < GAMELOG_SIZE ? (unsigned long)(mapSize - base) : GAMELOG_SIZE;
+
+    // Blocks written since the last footer
+    unsigned long pendingOffset[GAMELOG_INDEX_ENTRIES];
+    unsigned long pendingFirst[GAMELOG_INDEX_ENTRIES];
+    int pending = 0;
+
+    unsigned long offset = 0;
+    while(offset + 8 <= length)
+    {
+        const unsigned char *data = &map[base + offset];
+        unsigned long magic = Read32(data);
+        unsigned long bytes = Read16(&data[4]);
+        if(magic == 0xFFFFFFFF)
+        {
+            break; // Erased, the end of the log
+        }
+        if((magic != GAMELOG_BLOCK_MAGIC && magic != GAMELOG_INDEX_MAGIC) || bytes < 8 || (bytes & 3) ||
+           offset + bytes > length || (magic == GAMELOG_BLOCK_MAGIC && bytes < LOG_HEADER))
+        {
+            Problem(base + offset, "not a block or footer, the rest of the region is skipped");
+            break;
+        }
+
+        if(magic == GAMELOG_BLOCK_MAGIC)
+        {
+            if(pending == GAMELOG_INDEX_ENTRIES)
+            {
+                Problem(base + offset, "more blocks than one footer indexes");
+            }
+            else
+            {
+                pendingOffset[pending] = offset;
+                pendingFirst[pending] = Read32(&data[8]);
+                pending++;
+            }
+
+            if(!Grow((void **)&index->blocks, &index->size, index->count, sizeof(unsigned long long)))
+            {
+                Problem(base + offset, "out of memory for the block list");
+                break;
+            }
+            index->blocks[index->count++] = base + offset;
+        }
+        else
+        {
+            Footer(base + offset, data, bytes, pendingOffset, pendingFirst, pending);
+            pending = 0;
+            index->footers++;
+        }
+        offset += bytes;
+    }
+
+    if(pending)
+    {
+        Problem(base + offset, "blocks at the end have no footer, the game did not end");
+    }
+    index->used += offset;
+}
+
+static void *IndexRegions(void *arg)
+{
+    tIndex *index = arg;
+    unsigned long region;
+    for(region = index->from; region < index->to; region++)
+    {
+        Walk(index, region);
+    }
+    return 0;
+}
+
+static void Finish(tSums *sums, const tPart *part)
+{
+    unsigned long size = sums->size;
+    if(!Grow((void **)&sums->scores, &sums->size, sums->games, sizeof(unsigned long)) ||
+       (sums->size != size && !Grow((void **)&sums->pieces, &size, sums->games, sizeof(unsigned long))))
+    {
+        Problem(0, "out of memory for the game list");
+        return;
+    }
+    sums->scores[sums->games] = part->score;
+    sums->pieces[sums->games] = part->pieces;
+    sums->games++;
+}
+
+static void Drought(tSums *sums, int shape, unsigned long length)
+{
+    sums->droughts[shape][length < LOG_DROUGHTS ? length : LOG_DROUGHTS - 1]++;
+    if(length > sums->longest[shape])
+    {
+        sums->longest[shape] = length;
+    }
+}
+
+static void Begin(tPart *part, int continues)
+{
+    memset(part, 0, sizeof(tPart));
+    memset(part->first, 0xFF, sizeof(part->first));
+    memset(part->last, 0xFF, sizeof(part->last));
+    part->active = 1;
+    part->continues = continues;
+}
+
+// Ends the game in play in a run. The one the run began inside is kept
+// to be joined to the rest of it.
+static void End(tRun *run)
+{
+    if(!run->game.active)
+    {
+        return;
+    }
+
+    if(run->game.continues)
+    {
+        run->head = run->game;
+    }
+    else
+    {
+        Finish(&run->sums, &run->game);
+    }
+    run->game.active = 0;
+}
+
+// Decodes the block at position i of the list into a run's sums
+static void Block(tRun *run, unsigned long i)
+{
+    unsigned long long at = blocks[i];
+    const unsigned char *data = &map[at];
+    unsigned long bytes = Read16(&data[4]);
+    unsigned long records = Read16(&data[6]);
+    unsigned long first = Read32(&data[8]);
+    unsigned char *columns = run->columns;
+
+    unsigned long length = LOG_HEADER;
+    unsigned long start = 0;
+    int c;
+    for(c = 0; c < LOG_COLUMNS; c++)
+    {
+        unsigned long packed = length + 2 <= bytes ? Read16(&data[length]) : bytes;
+        if(length + 2 + packed > bytes ||
+           Unpack(&data[length + 2], packed, &columns[start * records], columnWidth[c] * records) !=
+               (int)(columnWidth[c] * records))
+        {
+            Problem(at, "column does not unpack to one value per record");
+            return;
+        }
+        length += 2 + packed;
+        start += columnWidth[c];
+    }
+    if(((length + 3) & ~3UL) != bytes)
+    {
+        Problem(at, "block length does not match its columns");
+    }
+
+    // A game starts at piece 0 and at the start of a region
+    if(!first || i == 0 || blocks[i - 1] / GAMELOG_SIZE != at / GAMELOG_SIZE)
+    {
+        End(run);
+        Begin(&run->game, 0);
+    }
+    else if(!run->game.active)
+    {
+        Begin(&run->game, 1);
+    }
+
+    tSums *sums = &run->sums;
+    tPart *game = &run->game;
+    const unsigned char *shapes = columns;
+    const unsigned char *lines = &columns[4 * records];
+    const unsigned char *scores = &columns[5 * records];
+    const unsigned char *heights = &columns[7 * records];
+    unsigned long r;
+    for(r = 0; r < records; r++)
+    {
+        long piece = first + r;
+        int shape = shapes[r];
+        if(shape < 7)
+        {
+            if(game->last[shape] >= 0)
+            {
+                Drought(sums, shape, piece - game->last[shape] - 1);
+            }
+            else
+            {
+                game->first[shape] = piece;
+            }
+            game->last[shape] = piece;
+            sums->shapes[shape]++;
+        }
+        else
+        {
+            sums->shapes[7]++;
+        }
+
+        unsigned long score = Read16(&scores[2 * r]);
+        game->score += score;
+        sums->lines[lines[r] < LOG_LINES ? lines[r] : LOG_LINES - 1]++;
+        sums->heights[heights[r]]++;
+
+        if(run->listing)
+        {
+            printf("%lu %c %d %d %u %u %lu %u\n", first + r, shape < 7 ? "OISZLJT"[shape] : '?',
+                   (signed char)columns[1 * records + r], (signed char)columns[2 * records + r],
+                   columns[3 * records + r], lines[r], score, heights[r]);
+        }
+    }
+    game->pieces += records;
+    sums->records += records;
+}
+
+static void *DecodeRun(void *arg)
+{
+    tRun *run = arg;
+    unsigned long i;
+    for(i = run->from; i < run->to; i++)
+    {
+        Block(run, i);
+    }
+    return 0;
+}
+
+// Adds the next part of the game in play, joining the droughts across it
+static void Join(tSums *sums, tPart *game, const tPart *part)
+{
+    if(!game->active)
+    {
+        *game = *part;
+        return;
+    }
+
+    int s;
+    for(s = 0; s < 7; s++)
+    {
+        if(part->first[s] >= 0 && game->last[s] >= 0)
+        {
+            Drought(sums, s, part->first[s] - game->last[s] - 1);
+        }
+        if(part->last[s] >= 0)
+        {
+            game->last[s] = part->last[s];
+        }
+    }
+    game->score += part->score;
+    game->pieces += part->pieces;
+}
+
+static void Add(tSums *total, const tSums *sums)
+{
+    unsigned long i, s;
+    for(i = 0; i < sums->games; i++)
+    {
+        tPart part;
+        part.score = sums->scores[i];
+        part.pieces = sums->pieces[i];
+        Finish(total, &part);
+    }
+    total->records += sums->records;
+    for(i = 0; i < LOG_LINES; i++)
+    {
+        total->lines[i] += sums->lines[i];
+    }
+    for(i = 0; i < 8; i++)
+    {
+        total->shapes[i] += sums->shapes[i];
+    }
+    for(i = 0; i < LOG_HEIGHTS; i++)
+    {
+        total->heights[i] += sums->heights[i];
+    }
+    for(s = 0; s < 7; s++)
+    {
+        for(i = 0; i < LOG_DROUGHTS; i++)
+        {
+            total->droughts[s][i] += sums->droughts[s][i];
+        }
+        if(sums->longest[s] > total->longest[s])
+        {
+            total->longest[s] = sums->longest[s];
+        }
+    }
+}
+
+static int CompareLong(const void *a, const void *b)
+{
+    unsigned long x = *(const unsigned long *)a;
+    unsigned long y = *(const unsigned long *)b;
+    return x < y ? -1 : x > y;
+}
+
+static unsigned long Percentile(const unsigned long *sorted, unsigned long count, int percent)
+{
+    return count ? sorted[(count - 1) * percent / 100] : 0;
+}
+
+// Value below which percent of a histogram's counts fall
+static int HistogramPercentile(const unsigned long *counts, int bins, int percent)
+{
+    unsigned long long total = 0;
+    int i;
+    for(i = 0; i < bins; i++)
+    {
+        total += counts[i];
+    }
+
+    unsigned long long seen = 0;
+    for(i = 0; i < bins; i++)
+    {
+        seen += counts[i];
+        if(total && seen * 100 >= total * percent)
+        {
+            return i;
+        }
+    }
+    return 0;
+}
+
+static void Report(FILE *out, tSums *total)
+{
+    qsort(total->scores, total->games, sizeof(unsigned long), CompareLong);
+    qsort(total->pieces, total->games, sizeof(unsigned long), CompareLong);
+    unsigned long g = total->games;
+    fprintf(out, "%lu games: score p50 %lu, p90 %lu, p99 %lu, max %lu; pieces p50 %lu, p90 %lu, p99 %lu, max %lu\n",
+            g, Percentile(total->scores, g, 50), Percentile(total->scores, g, 90), Percentile(total->scores, g, 99),
+            Percentile(total->scores, g, 100), Percentile(total->pieces, g, 50), Percentile(total->pieces, g, 90),
+            Percentile(total->pieces, g, 99), Percentile(total->pieces, g, 100));
+
+    fprintf(out, "lines cleared per piece:");
+    int i;
+    for(i = 0; i < LOG_LINES; i++)
+    {
+        fprintf(out, " %d %lu (%.2f%%)%s", i, total->lines[i],
+                total->records ? 100.0 * total->lines[i] / total->records : 0.0, i < LOG_LINES - 1 ? "," : "\n");
+    }
+
+    fprintf(out, "stack height: p50 %d, p90 %d, p99 %d\n", HistogramPercentile(total->heights, LOG_HEIGHTS, 50),
+            HistogramPercentile(total->heights, LOG_HEIGHTS, 90), HistogramPercentile(total->heights, LOG_HEIGHTS, 99));
+
+    fprintf(out, "droughts, pieces between two of a shape:\n");
+    int s;
+    for(s = 0; s < 7; s++)
+    {
+        unsigned long count = 0;
+        double sum = 0;
+        for(i = 0; i < LOG_DROUGHTS; i++)
+        {
+            count += total->droughts[s][i];
+            sum += (double)i * total->droughts[s][i];
+        }
+        fprintf(out, "  %c %lu dealt, %lu droughts, mean %.2f, p99 %d, longest %lu\n", "OISZLJT"[s], total->shapes[s],
+                count, count ? sum / count : 0.0, HistogramPercentile(total->droughts[s], LOG_DROUGHTS, 99),
+                total->longest[s]);
+    }
+    if(total->shapes[7])
+    {
+        fprintf(out, "  %lu pieces with no shape\n", total->shapes[7]);
+    }
+}
+
+static double Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Maps the file, or reads stdin. Returns 0 on failure.
+static int Open(const char *name)
+{
+    if(!name)
+    {
+        unsigned char *buf = 0;
+        unsigned long size = 0;
+        unsigned long count = 0;
+        size_t got;
+        do
+        {
+            if(!Grow((void **)&buf, &size, count + 1, 1))
+            {
+                fprintf(stderr, "out of memory\n");
+                return 0;
+            }
+            got = fread(&buf[count], 1, size - count, stdin);
+            count += got;
+        } while(got);
+        map = buf;
+        mapSize = count;
+        return 1;
+    }
+
+    int file = open(name, O_RDONLY);
+    struct stat info;
+    if(file < 0 || fstat(file, &info))
+    {
+        fprintf(stderr, "cannot open %s\n", name);
+        return 0;
+    }
+
+    mapSize = info.st_size;
+    if(mapSize)
+    {
+        void *mapped = mmap(0, mapSize, PROT_READ, MAP_PRIVATE, file, 0);
+        if(mapped == MAP_FAILED)
+        {
+            fprintf(stderr, "cannot map %s\n", name);
+            return 0;
+        }
+        madvise(mapped, mapSize, MADV_SEQUENTIAL);
+        map = mapped;
+    }
+    close(file);
+    return 1;
+}
+
+// The region -g logs into, and the flash calls gamelog.c makes on it
+static unsigned char region[GAMELOG_SIZE];
+
+unsigned long g_ulSystemClock = 50000000;
+
+long FlashProgram(unsigned long *pulData, unsigned long ulAddress, unsigned long ulCount)
+{
+    memcpy(&region[ulAddress - GAMELOG_BASE], pulData, ulCount);
+    return 0;
+}
+
+long FlashErase(unsigned long ulAddress)
+{
+    memset(&region[ulAddress - GAMELOG_BASE], 0xFF, 0x400);
+    return 0;
+}
+
+void FlashUsecSet(unsigned long ulClocks)
+{
+    (void)ulClocks;
+}
+
+static void Generate(unsigned long count)
+{
+    static tGame game;
+    static tPlacement placements[LOG_PLACEMENTS];
+    unsigned long seed = 0;
+
+    GameLogErase();
+    while(count)
+    {
+        GameInit(&game, ++seed);
+        GameStep(&game, 0);
+        while(!game.gameover && game.locks < LOG_GAME_PIECES && !gameLogStats.dropped)
+        {
+            int found = PlaceFind(&game, game.shape, game.orientation, game.locationX, game.locationY, placements,
+                                  LOG_PLACEMENTS);
+            if(!found)
+            {
+                break;
+            }
+            if(found > LOG_PLACEMENTS)
+            {
+                found = LOG_PLACEMENTS;
+            }
+
+            int pick = rand() % 8 ? EvalChoose(&game, game.shape, placements, found) : rand() % found;
+            game.orientation = placements[pick].orientation;
+            game.locationX = placements[pick].x;
+            game.locationY = placements[pick].y;
+            game.buttons = 0;
+            GameStep(&game, INPUT_D);
+            GameStep(&game, 0);
+            GameLogAppend(&game.lastLock);
+        }
+        GameLogFlush();
+
+        if(gameLogStats.dropped)
+        {
+            fwrite(region, 1, GAMELOG_SIZE, stdout);
+            GameLogErase();
+            memset(&gameLogStats, 0, sizeof(gameLogStats));
+            count--;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int quiet = 0;
+    int threads = 4;
+    int arg = 1;
+    if(arg < argc && !strcmp(argv[arg], "-g"))
+    {
+        srand(1);
+        Generate(arg + 1 < argc ? strtoul(argv[arg + 1], 0, 10) : 16);
+        return 0;
+    }
+    while(arg < argc && argv[arg][0] == '-')
+    {
+        if(!strcmp(argv[arg], "-s"))
+        {
+            quiet = 1;
+            arg++;
+        }
+        else if(!strcmp(argv[arg], "-t") && arg + 1 < argc)
+        {
+            threads = atoi(argv[arg + 1]);
+            arg += 2;
+        }
+        else
+        {
+            fprintf(stderr, "unknown option %s\n", argv[arg]);
+            return 1;
+        }
+    }
+    if(threads < 1 || threads > LOG_THREADS)
+    {
+        threads = 4;
+    }
+    if(!quiet)
+    {
+        threads = 1; // Pieces are listed in order
+    }
+
+    double start = Now();
+    if(!Open(arg < argc ? argv[arg] : 0))
+    {
+        return 1;
+    }
+    regions = (mapSize + GAMELOG_SIZE - 1) / GAMELOG_SIZE;
+
+    // Walk the regions, a share per thread, then list the blocks in order
+    int t;
+    for(t = 0; t < threads; t++)
+    {
+        tIndex *index = &indexes[t];
+        index->from = regions * t / threads;
+        index->to = regions * (t + 1) / threads;
+        pthread_create(&index->thread, 0, IndexRegions, index);
+    }
+    unsigned long footers = 0;
+    unsigned long long used = 0;
+    for(t = 0; t < threads; t++)
+    {
+        pthread_join(indexes[t].thread, 0);
+        blockCount += indexes[t].count;
+        footers += indexes[t].footers;
+        used += indexes[t].used;
+    }
+    blocks = malloc((blockCount ? blockCount : 1) * sizeof(unsigned long long));
+    if(!blocks)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    unsigned long n = 0;
+    for(t = 0; t < threads; t++)
+    {
+        memcpy(&blocks[n], indexes[t].blocks, indexes[t].count * sizeof(unsigned long long));
+        n += indexes[t].count;
+        free(indexes[t].blocks);
+    }
+
+    // Decode a run of blocks per thread
+    for(t = 0; t < threads; t++)
+    {
+        tRun *run = &runs[t];
+        run->from = blockCount * t / threads;
+        run->to = blockCount * (t + 1) / threads;
+        run->listing = !quiet;
+        run->columns = malloc(LOG_RECORD_BYTES * 0x10000 + LOG_SLACK);
+        if(!run->columns)
+        {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        pthread_create(&run->thread, 0, DecodeRun, run);
+    }
+
+    // Join the games that span two runs, in order
+    static tSums total;
+    tPart game;
+    game.active = 0;
+    for(t = 0; t < threads; t++)
+    {
+        tRun *run = &runs[t];
+        pthread_join(run->thread, 0);
+        Add(&total, &run->sums);
+
+        if(run->head.active)
+        {
+            Join(&total, &game, &run->head);
+            Finish(&total, &game);
+            game = run->game;
+        }
+        else if(run->game.active && run->game.continues)
+        {
+            Join(&total, &game, &run->game);
+        }
+        else if(run->game.active)
+        {
+            if(game.active)
+            {
+                Finish(&total, &game);
+            }
+            game = run->game;
+        }
+    }
+    if(game.active)
+    {
+        Finish(&total, &game);
+    }
+    double seconds = Now() - start;
+
+    FILE *out = quiet ? stdout : stderr;
+    fprintf(out, "%lu records in %lu blocks, %lu footers, %llu bytes used%s\n", total.records, blockCount, footers,
+            used, errors ? "" : ", no problems");
+    Report(out, &total);
+    fprintf(out, "%lu regions, %.1f MB in %.3f s, %.0f MB/s on %d threads\n", regions, mapSize / 1e6, seconds,
+            seconds > 0 ? mapSize / 1e6 / seconds : 0.0, threads);
+    return errors != 0;
+}
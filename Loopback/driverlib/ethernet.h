@@ -0,0 +1,17 @@
+#ifndef __ETHERNET_H__
+#define __ETHERNET_H__
+
+// Host stand-in for the loopback driver, the base is the port number.
+// Packets go through the delay queue in loopback.c.
+#define ETH_CFG_TX_DPLXEN 0x00000010
+#define ETH_CFG_TX_CRCEN  0x00000004
+#define ETH_CFG_TX_PADEN  0x00000002
+
+extern void EthernetInitExpClk(unsigned long ulBase, unsigned long ulEthClk);
+extern void EthernetConfigSet(unsigned long ulBase, unsigned long ulConfig);
+extern void EthernetMACAddrSet(unsigned long ulBase, unsigned char *pucMACAddr);
+extern void EthernetEnable(unsigned long ulBase);
+extern long EthernetPacketGetNonBlocking(unsigned long ulBase, unsigned char *pucBuf, long lBufLen);
+extern long EthernetPacketPutNonBlocking(unsigned long ulBase, unsigned char *pucBuf, long lBufLen);
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef __FLASH_H__
+#define __FLASH_H__
+
+// Host stand-in for the loopback driver, the user registers hold the MAC
+// address of the port being opened
+extern long FlashUserGet(unsigned long *pulUser0, unsigned long *pulUser1);
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef __SYSCTL_H__
+#define __SYSCTL_H__
+
+// Host stand-in for the loopback driver
+#define SYSCTL_PERIPH_ETH 0x10000001
+
+extern void SysCtlPeripheralEnable(unsigned long ulPeripheral);
+extern void SysCtlPeripheralReset(unsigned long ulPeripheral);
+extern unsigned long SysCtlClockGet(void);
+
+#endif
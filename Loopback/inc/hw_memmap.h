@@ -0,0 +1,10 @@
+#ifndef __HW_MEMMAP_H__
+#define __HW_MEMMAP_H__
+
+// Host stand-in for the loopback driver. Each copy of net.c sets ETH_BASE
+// to its own port number before including it.
+#ifndef ETH_BASE
+#define ETH_BASE 0
+#endif
+
+#endif
@@ -0,0 +1,280 @@
+// Host loopback for versus play. Two copies of net.c, built as players A
+// and B by neta.c and netb.c, run the rollback session against each other
+// with game.c, and the Ethernet driver is replaced by a delay queue that
+// can hold, reorder and drop packets.
+//
+//   gcc -O2 -I. -I.. -o loopback loopback.c neta.c netb.c ../game.c
+//   ./loopback [ticks] [delay] [jitter] [loss percent] [seed]
+//
+// Each player holds random buttons for ticks, then both idle for
+// LOOP_FLUSH ticks over a link with no delay. The inputs each side
+// actually simulated are replayed into a pair of reference games stepped
+// in lockstep, which must match both boards on both sides. Any desync
+// either side detected from the hashes in its packets also fails the run.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "game.h"
+#include "net.h"
+
+#define LOOP_QUEUE 256     // Packets in flight
+#define LOOP_PACKET 64     // Largest packet, as net.c's buffer
+#define LOOP_FLUSH 200     // Idle ticks at the end
+#define LOOP_MAX_TICKS 100000
+#define LOOP_HASH_BASIS 2166136261UL
+
+extern tNetStats netStatsA, netStatsB;
+extern void NetInitA(void);
+extern void NetInitB(void);
+extern int NetStepA(int input);
+extern int NetStepB(int input);
+extern int NetStateA(void);
+extern int NetStateB(void);
+extern tGame *NetLocalGameA(void);
+extern tGame *NetLocalGameB(void);
+extern tGame *NetRemoteGameA(void);
+extern tGame *NetRemoteGameB(void);
+
+static const unsigned char macs[2][6] =
+{
+    { 0x00, 0x1A, 0xB6, 0x00, 0x00, 0x01 },
+    { 0x00, 0x1A, 0xB6, 0x00, 0x00, 0x02 }
+};
+
+typedef struct
+{
+    int port;             // Destination
+    unsigned long due;    // Tick it arrives
+    unsigned long order;  // Send order, to break ties
+    long length;
+    unsigned char data[LOOP_PACKET];
+} tLoopPacket;
+
+static tLoopPacket queue[LOOP_QUEUE];
+static int queued = 0;
+static unsigned long sent = 0;
+static unsigned long dropped = 0;
+static unsigned long now = 0;
+static int opening;     // Port whose MAC address FlashUserGet returns
+static int delay = 3;
+static int jitter = 2;
+static int loss = 5;
+static unsigned long seed = 1;
+
+static unsigned char recorded[2][LOOP_MAX_TICKS + LOOP_FLUSH];
+static unsigned long frames[2];
+static tGame reference[2];
+
+static int LoopRand(void)
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (int)((seed >> 16) & 0x7FFF);
+}
+
+// Driver stand-ins, the base address is the port
+
+void SysCtlPeripheralEnable(unsigned long peripheral)
+{
+}
+
+void SysCtlPeripheralReset(unsigned long peripheral)
+{
+}
+
+unsigned long SysCtlClockGet(void)
+{
+    return 8000000;
+}
+
+void EthernetInitExpClk(unsigned long base, unsigned long clock)
+{
+}
+
+void EthernetConfigSet(unsigned long base, unsigned long config)
+{
+}
+
+void EthernetMACAddrSet(unsigned long base, unsigned char *address)
+{
+}
+
+void EthernetEnable(unsigned long base)
+{
+}
+
+long FlashUserGet(unsigned long *user0, unsigned long *user1)
+{
+    const unsigned char *mac = macs[opening];
+    *user0 = mac[0] | (mac[1] << 8) | ((unsigned long)mac[2] << 16);
+    *user1 = mac[3] | (mac[4] << 8) | ((unsigned long)mac[5] << 16);
+    return 0;
+}
+
+// Queues a packet for the other port, or loses it
+long EthernetPacketPutNonBlocking(unsigned long base, unsigned char *data, long length)
+{
+    if(queued == LOOP_QUEUE || length > LOOP_PACKET || LoopRand() % 100 < loss)
+    {
+        dropped++;
+        return length;
+    }
+
+    tLoopPacket *packet = &queue[queued++];
+    packet->port = !base;
+    packet->due = now + delay + (jitter ? LoopRand() % (jitter + 1) : 0);
+    packet->order = sent++;
+    packet->length = length;
+    memcpy(packet->data, data, length);
+    return length;
+}
+
+// Takes the earliest packet due at the port, 0 if none
+long EthernetPacketGetNonBlocking(unsigned long base, unsigned char *data, long length)
+{
+    int best = -1;
+    int i;
+    for(i = 0; i < queued; i++)
+    {
+        if(queue[i].port == (int)base && queue[i].due <= now &&
+           (best < 0 || queue[i].due < queue[best].due ||
+            (queue[i].due == queue[best].due && queue[i].order < queue[best].order)))
+        {
+            best = i;
+        }
+    }
+    if(best < 0)
+    {
+        return 0;
+    }
+
+    long got = queue[best].length < length ? queue[best].length : length;
+    memcpy(data, queue[best].data, got);
+    queue[best] = queue[--queued];
+    return got;
+}
+
+// Random buttons, held for a while like a player would, with few enough
+// hard drops that games last
+static int NextInput(int *held)
+{
+    if(LoopRand() % 8 == 0)
+    {
+        int button = LoopRand() % 16;
+        *held = button < 4 ? INPUT_U << button : button == 4 ? INPUT_D : 0;
+    }
+    return *held;
+}
+
+// Steps one player and records the input if its board simulated a tick
+static void Step(int player, int input)
+{
+    tNetStats *stats = player ? &netStatsB : &netStatsA;
+    unsigned long stalls = stats->stalls;
+    if(player)
+    {
+        NetStepB(input);
+    }
+    else
+    {
+        NetStepA(input);
+    }
+
+    int running = (player ? NetStateB() : NetStateA()) == NET_RUNNING;
+    if(running && stats->stalls == stalls)
+    {
+        recorded[player][frames[player]++] = input;
+    }
+}
+
+static void StepReference(unsigned long t)
+{
+    GameStep(&reference[0], t < frames[0] ? recorded[0][t] : 0);
+    GameStep(&reference[1], t < frames[1] ? recorded[1][t] : 0);
+
+    reference[0].garbageIn += reference[1].garbageOut;
+    reference[1].garbageIn += reference[0].garbageOut;
+    reference[0].garbageOut = 0;
+    reference[1].garbageOut = 0;
+}
+
+// Returns 1 if a side's boards match the reference, player 0 first
+static int Matches(tGame *board0, tGame *board1)
+{
+    return GameHash(board0, LOOP_HASH_BASIS) == GameHash(&reference[0], LOOP_HASH_BASIS) &&
+           GameHash(board1, LOOP_HASH_BASIS) == GameHash(&reference[1], LOOP_HASH_BASIS);
+}
+
+static void Report(const char *name, const tNetStats *stats, unsigned long frame)
+{
+    printf("%s: %lu ticks simulated, %lu rollbacks, %lu resimulated, deepest %lu, %lu stalls, "
+           "%lu desyncs, %lu sent, %lu received\n", name, frame, stats->rollbacks, stats->resimulated,
+           stats->maxRollback, stats->stalls, stats->desyncs, stats->txPackets, stats->rxPackets);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long ticks = argc > 1 ? strtoul(argv[1], 0, 0) : 10000;
+    delay = argc > 2 ? atoi(argv[2]) : delay;
+    jitter = argc > 3 ? atoi(argv[3]) : jitter;
+    loss = argc > 4 ? atoi(argv[4]) : loss;
+    seed = argc > 5 ? strtoul(argv[5], 0, 0) : seed;
+    if(ticks > LOOP_MAX_TICKS)
+    {
+        ticks = LOOP_MAX_TICKS;
+    }
+
+    opening = 0;
+    NetInitA();
+    opening = 1;
+    NetInitB();
+
+    int held[2] = { 0, 0 };
+    for(now = 0; now < ticks + LOOP_FLUSH; now++)
+    {
+        if(now == ticks)
+        {
+            delay = 0;
+            jitter = 0;
+            loss = 0;
+        }
+        Step(0, now < ticks ? NextInput(&held[0]) : 0);
+        Step(1, now < ticks ? NextInput(&held[1]) : 0);
+    }
+
+    // Both sides derive the seed from the pair of addresses, as net.c does
+    unsigned long gameSeed = 0;
+    int i;
+    for(i = 0; i < 6; i++)
+    {
+        gameSeed = gameSeed * 31 + (macs[0][i] ^ macs[1][i]);
+    }
+    GameInit(&reference[0], gameSeed);
+    GameInit(&reference[1], gameSeed);
+
+    // A has the lower address, so it is player 0 on both sides
+    int agree = 1;
+    unsigned long last = frames[0] > frames[1] ? frames[0] : frames[1];
+    unsigned long t;
+    for(t = 0; t <= last; t++)
+    {
+        if(t == frames[0] && !Matches(NetLocalGameA(), NetRemoteGameA()))
+        {
+            printf("A differs from the reference at tick %lu\n", t);
+            agree = 0;
+        }
+        if(t == frames[1] && !Matches(NetRemoteGameB(), NetLocalGameB()))
+        {
+            printf("B differs from the reference at tick %lu\n", t);
+            agree = 0;
+        }
+        StepReference(t);
+    }
+
+    Report("A", &netStatsA, frames[0]);
+    Report("B", &netStatsB, frames[1]);
+    printf("%lu packets lost, scores %d and %d%s\n", dropped, reference[0].score, reference[1].score,
+           agree ? ", both sides match the reference" : "");
+
+    return agree && !netStatsA.desyncs && !netStatsB.desyncs ? 0 : 1;
+}
@@ -0,0 +1,11 @@
+// net.c as player A of the loopback, on port 0
+#define ETH_BASE 0
+#define netStats netStatsA
+#define NetOpen NetOpenA
+#define NetInit NetInitA
+#define NetStep NetStepA
+#define NetState NetStateA
+#define NetLocalGame NetLocalGameA
+#define NetRemoteGame NetRemoteGameA
+
+#include "../net.c"
@@ -0,0 +1,11 @@
+// net.c as player B of the loopback, on port 1
+#define ETH_BASE 1
+#define netStats netStatsB
+#define NetOpen NetOpenB
+#define NetInit NetInitB
+#define NetStep NetStepB
+#define NetState NetStateB
+#define NetLocalGame NetLocalGameB
+#define NetRemoteGame NetRemoteGameB
+
+#include "../net.c"
@@ -0,0 +1,298 @@
+// Host runner for the perfect clear solver over a fixed problem set. Each
+// problem is split into parts by root move with PcSolvePart's scheme, and
+// worker threads take parts from a shared counter, each with its own
+// search state through PcSolveIn.
+//
+//   gcc -O2 -pthread -I.. -o perfectclear perfectclear.c ../pc.c ../game.c
+//   ./perfectclear [threads] [problems.txt]   Checks the results and times them
+//   ./perfectclear -g [count] > problems.txt   Draws a new set
+//
+// The set is timed on one thread as PcSolve runs it, then on the threads
+// asked for, default 4, with four parts a thread per problem so the work
+// spreads evenly. Every part runs to its end, there is no way to stop a
+// search early. A problem is solved if any part found a clear, in the
+// fewest pieces any part found, which is what PcSolve finds on its own.
+//
+// A problem line is the four window rows top first, separated by /, # for
+// filled, then the queue and the pieces in the solution, 0 for none.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "game.h"
+#include "pc.h"
+
+#define PERFECT_PROBLEMS 256
+#define PERFECT_THREADS 64
+#define PERFECT_PARTS 4        // Parts per thread and problem
+#define PERFECT_QUEUE 10       // Pieces queued in a drawn problem
+#define PERFECT_DRAW_LIMIT 400000 // Nodes a drawn problem may take on one thread
+
+typedef struct
+{
+    char rows[PC_ROWS][GAME_COLS + 1];
+    unsigned char queue[PC_MAX_PIECES];
+    int count;
+    int expected; // Pieces in the solution
+    tGame game;
+} tProblem;
+
+typedef struct
+{
+    tPcSearch search;
+    tPcStats stats;
+    tGame game;
+    tPcMove solution[PC_MAX_PIECES];
+    pthread_t thread;
+} tWorker;
+
+static const char *const shapeNames = "OISZLJT";
+
+static tProblem problems[PERFECT_PROBLEMS];
+static int problemCount;
+
+static tWorker workers[PERFECT_THREADS];
+static int results[PERFECT_PROBLEMS][PERFECT_THREADS * PERFECT_PARTS];
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static int nextItem; // Next problem and part to hand out
+static int parts;    // Parts per problem in this run
+
+static void Load(tProblem *problem)
+{
+    unsigned char buf[GAME_SNAPSHOT_SIZE];
+    GameInit(&problem->game, 1);
+    GameSave(&problem->game, buf);
+
+    int i, j;
+    for(i = 0; i < PC_ROWS; i++)
+    {
+        for(j = 0; j < GAME_COLS; j++)
+        {
+            if(problem->rows[i][j] == '#')
+            {
+                buf[(GAME_ROWS - PC_ROWS + i) * GAME_ROW_BYTES + j / 2] |= GAME_CELL_GARBAGE << ((j & 1) << 2);
+            }
+        }
+    }
+    GameRestore(&problem->game, buf);
+}
+
+static int Read(const char *name)
+{
+    FILE *file = fopen(name, "r");
+    if(!file)
+    {
+        fprintf(stderr, "cannot open %s\n", name);
+        return 0;
+    }
+
+    char line[256];
+    char rows[64];
+    char queue[PC_MAX_PIECES + 2];
+    problemCount = 0;
+    while(problemCount < PERFECT_PROBLEMS && fgets(line, sizeof(line), file))
+    {
+        tProblem *problem = &problems[problemCount];
+        if(line[0] == '#' || sscanf(line, "%63s %13s %d", rows, queue, &problem->expected) != 3)
+        {
+            continue;
+        }
+
+        int i;
+        const char *row = rows;
+        for(i = 0; i < PC_ROWS; i++)
+        {
+            memcpy(problem->rows[i], row, GAME_COLS);
+            problem->rows[i][GAME_COLS] = 0;
+            row += GAME_COLS + 1;
+        }
+
+        problem->count = strlen(queue);
+        if(problem->count > PC_MAX_PIECES)
+        {
+            problem->count = PC_MAX_PIECES;
+        }
+        for(i = 0; i < problem->count; i++)
+        {
+            problem->queue[i] = strchr(shapeNames, queue[i]) - shapeNames;
+        }
+
+        Load(problem);
+        problemCount++;
+    }
+    fclose(file);
+    return problemCount;
+}
+
+static void *Work(void *arg)
+{
+    tWorker *worker = arg;
+    worker->search.stats = &worker->stats;
+    while(1)
+    {
+        pthread_mutex_lock(&lock);
+        int item = nextItem++;
+        pthread_mutex_unlock(&lock);
+        if(item >= problemCount * parts)
+        {
+            return 0;
+        }
+
+        tProblem *problem = &problems[item / parts];
+        worker->game = problem->game;
+        results[item / parts][item % parts] = PcSolveIn(&worker->search, &worker->game, problem->queue,
+                                                        problem->count, item % parts, parts, worker->solution);
+    }
+}
+
+static double Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Runs the set on threads threads and checks the results. Returns the
+// number that differ from the expected ones.
+static int Run(int threads)
+{
+    parts = threads == 1 ? 1 : threads * PERFECT_PARTS;
+    nextItem = 0;
+
+    double start = Now();
+    int i;
+    for(i = 0; i < threads; i++)
+    {
+        memset(&workers[i].stats, 0, sizeof(tPcStats));
+        pthread_create(&workers[i].thread, 0, Work, &workers[i]);
+    }
+    for(i = 0; i < threads; i++)
+    {
+        pthread_join(workers[i].thread, 0);
+    }
+    double seconds = Now() - start;
+
+    unsigned long nodes = 0;
+    for(i = 0; i < threads; i++)
+    {
+        nodes += workers[i].stats.nodes;
+    }
+
+    int solved = 0;
+    int bad = 0;
+    for(i = 0; i < problemCount; i++)
+    {
+        int best = 0;
+        int part;
+        for(part = 0; part < parts; part++)
+        {
+            if(results[i][part] > 0 && (!best || results[i][part] < best))
+            {
+                best = results[i][part];
+            }
+        }
+        solved += best > 0;
+        if(best != problems[i].expected)
+        {
+            printf("problem %d: %d pieces, expected %d\n", i + 1, best, problems[i].expected);
+            bad++;
+        }
+    }
+
+    printf("%2d threads, %3d parts: %d problems, %d solved, %lu nodes, %.3f s, %.1f problems/s, %.0f nodes/s%s\n",
+           threads, parts, problemCount, solved, nodes, seconds, seconds > 0 ? problemCount / seconds : 0.0,
+           seconds > 0 ? nodes / seconds : 0.0, bad ? "" : ", all results match");
+    return bad;
+}
+
+// Drops a few random pieces onto the empty board for the start of a
+// problem, then draws a queue. Problems one thread takes too long over are
+// drawn again.
+static void Draw(int count)
+{
+    tPcMove solution[PC_MAX_PIECES];
+    tPcSearch *search = &workers[0].search;
+    search->stats = &workers[0].stats;
+    pcNodeLimit = PERFECT_DRAW_LIMIT;
+
+    printf("# window rows top first, queue, pieces in the solution, from perfectclear -g\n");
+    int n = 0;
+    while(n < count)
+    {
+        tGame game;
+        GameInit(&game, rand());
+        int pieces = rand() % 4;
+        int i, j;
+        for(i = 0; i < pieces; i++)
+        {
+            GameStep(&game, 0);
+            game.orientation = rand() % 4;
+            game.locationX = rand() % GAME_COLS - 1;
+            if(!GameFits(&game, game.shape, game.orientation, game.locationX, game.locationY))
+            {
+                continue;
+            }
+            game.buttons = 0;
+            GameStep(&game, INPUT_D);
+        }
+
+        unsigned char queue[PERFECT_QUEUE];
+        for(i = 0; i < PERFECT_QUEUE; i++)
+        {
+            queue[i] = rand() % 7;
+        }
+
+        tGame copy = game;
+        int result = PcSolveIn(search, &copy, queue, PERFECT_QUEUE, 0, 1, solution);
+        if(result < 0 || game.gameover || GameRowBits(&game, GAME_ROWS - PC_ROWS - 1))
+        {
+            continue;
+        }
+
+        for(i = 0; i < PC_ROWS; i++)
+        {
+            unsigned short bits = GameRowBits(&game, GAME_ROWS - PC_ROWS + i);
+            for(j = 0; j < GAME_COLS; j++)
+            {
+                putchar(bits & (1 << j) ? '#' : '.');
+            }
+            putchar(i < PC_ROWS - 1 ? '/' : ' ');
+        }
+        for(i = 0; i < PERFECT_QUEUE; i++)
+        {
+            putchar(shapeNames[queue[i]]);
+        }
+        printf(" %d\n", result);
+        n++;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if(argc > 1 && !strcmp(argv[1], "-g"))
+    {
+        srand(1);
+        Draw(argc > 2 ? atoi(argv[2]) : 64);
+        return 0;
+    }
+
+    int threads = argc > 1 ? atoi(argv[1]) : 4;
+    if(threads < 1 || threads > PERFECT_THREADS)
+    {
+        threads = 4;
+    }
+    if(!Read(argc > 2 ? argv[2] : "problems.txt"))
+    {
+        return 1;
+    }
+
+    int bad = Run(1);
+    if(threads > 1)
+    {
+        bad += Run(threads);
+    }
+    return bad != 0;
+}
@@ -0,0 +1,260 @@
+// Host tool that counts the placements PlaceFind reaches over a fixed suite
+// of boards, perft style, and times the search.
+//
+//   gcc -O2 -I.. -o perft perft.c ../game.c ../place.c
+//   ./perft [expected.txt]   Checks the counts, then reports placements/s
+//   ./perft -w > expected.txt
+//
+// Each board is searched from the spawn pose of every shape. The counts
+// are the lock positions found, the poses visited and the presses of all
+// the shortest paths together, so a change in movement, collision or the
+// search itself shows up as a different line. Every path is also walked
+// back from PlacePath with GameFits to check it ends where it claims.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "game.h"
+#include "place.h"
+
+#if GAME_COLS != 10
+#error The perft suite is drawn for ten columns
+#endif
+
+#define PERFT_BOARDS 8
+#define PERFT_HEIGHT 12   // Rows drawn per board, from the floor up
+#define PERFT_ROUNDS 200  // Suite repeats timed
+#define PERFT_PLACEMENTS 256
+
+typedef struct
+{
+    const char *name;
+    const char *rows[PERFT_HEIGHT]; // Bottom row first, # filled
+} tPerftBoard;
+
+static const tPerftBoard boards[PERFT_BOARDS] =
+{
+    { "empty", { 0 } },
+    { "well", { "#########.", "#########.", "#########.", "#########." } },
+    { "tslot", { "####.#####", "###...####", "####......" } },
+    { "tuck", { "#####..###", "##.......#", "##.....###", "#####....." } },
+    { "cave", { "##........", "##........", "#######...", "#.........", "#.........", "########.." } },
+    { "jagged", { "#.##.###.#", "##.####.##", ".###.#####", "#.#..##.#.", "..#...#...", "..#.......", "..#......." } },
+    { "tower", { "###....###", "###....###", "###....###", "###....###", "###....###", "###....###",
+                 "###....###", "###....###", "##......##", "#........#" } },
+    { "garbage", { "#########.", "#.########", "####.#####", "########.#", "##.#######", "######.###",
+                   ".#########", "#######.##" } }
+};
+
+typedef struct
+{
+    unsigned long placements;
+    unsigned long nodes;
+    unsigned long presses;
+} tPerftCount;
+
+static tGame game;
+static tPlacement placements[PERFT_PLACEMENTS];
+static unsigned char moves[PERFT_PLACEMENTS];
+static tPerftCount counts[PERFT_BOARDS][7];
+
+static const char *const shapeNames = "OISZLJT";
+
+static void Load(const tPerftBoard *board)
+{
+    unsigned char buf[GAME_SNAPSHOT_SIZE];
+    GameInit(&game, 1);
+    GameSave(&game, buf);
+
+    int i, j;
+    for(i = 0; i < PERFT_HEIGHT && board->rows[i]; i++)
+    {
+        for(j = 0; j < GAME_COLS; j++)
+        {
+            if(board->rows[i][j] == '#')
+            {
+                buf[(GAME_ROWS - 1 - i) * GAME_ROW_BYTES + j / 2] |= GAME_CELL_GARBAGE << ((j & 1) << 2);
+            }
+        }
+    }
+    GameRestore(&game, buf);
+}
+
+// Walks a path from the spawn pose, returns 1 if every move fits and it
+// ends on the placement
+static int Walk(int shape, const tPlacement *placement)
+{
+    int length = PlacePath(placement, moves, PERFT_PLACEMENTS);
+    if(length != placement->presses || length > PERFT_PLACEMENTS)
+    {
+        return 0;
+    }
+
+    int x = GAME_SPAWN_X;
+    int y = GAME_SPAWN_Y;
+    int orientation = 0;
+    int i;
+    for(i = 0; i < length; i++)
+    {
+        switch(moves[i])
+        {
+        case MOVE_LEFT:
+            x--;
+            break;
+        case MOVE_RIGHT:
+            x++;
+            break;
+        case MOVE_ROTATE:
+            orientation = (orientation + 1) & 3;
+            break;
+        case MOVE_DOWN:
+            y++;
+            break;
+        case MOVE_DROP:
+            y += GameDropDistanceAt(&game, shape, orientation, x, y);
+            break;
+        }
+        if(!GameFits(&game, shape, orientation, x, y))
+        {
+            return 0;
+        }
+    }
+
+    return x == placement->x && y == placement->y && orientation == placement->orientation &&
+           !GameFits(&game, shape, orientation, x, y + 1);
+}
+
+// Searches every board and shape once, checking the paths if asked
+static int Suite(int walk)
+{
+    int bad = 0;
+    int b, shape;
+    for(b = 0; b < PERFT_BOARDS; b++)
+    {
+        Load(&boards[b]);
+        for(shape = 0; shape < 7; shape++)
+        {
+            tPerftCount *count = &counts[b][shape];
+            unsigned long nodes = placeStats.nodes;
+            int found = PlaceFind(&game, shape, 0, GAME_SPAWN_X, GAME_SPAWN_Y, placements, PERFT_PLACEMENTS);
+
+            count->placements = found;
+            count->nodes = placeStats.nodes - nodes;
+            count->presses = 0;
+            int i;
+            for(i = 0; i < found && i < PERFT_PLACEMENTS; i++)
+            {
+                count->presses += placements[i].presses;
+                if(walk && !Walk(shape, &placements[i]))
+                {
+                    fprintf(stderr, "%s %c: path to placement %d does not lead there\n",
+                            boards[b].name, shapeNames[shape], i);
+                    bad++;
+                }
+            }
+        }
+    }
+    return bad;
+}
+
+// Compares the counts with lines of "board shape placements nodes presses"
+static int Check(const char *name)
+{
+    FILE *file = fopen(name, "r");
+    if(!file)
+    {
+        fprintf(stderr, "cannot open %s\n", name);
+        return 1;
+    }
+
+    int bad = 0;
+    int lines = 0;
+    char line[128];
+    while(fgets(line, sizeof(line), file))
+    {
+        char board[32];
+        char shape;
+        tPerftCount expected;
+        if(line[0] == '#' || sscanf(line, "%31s %c %lu %lu %lu", board, &shape,
+                                    &expected.placements, &expected.nodes, &expected.presses) != 5)
+        {
+            continue;
+        }
+
+        int b;
+        for(b = 0; b < PERFT_BOARDS && strcmp(boards[b].name, board); b++)
+        {
+        }
+        const char *s = strchr(shapeNames, shape);
+        if(b == PERFT_BOARDS || !s)
+        {
+            fprintf(stderr, "unknown board %s %c\n", board, shape);
+            bad++;
+            continue;
+        }
+
+        const tPerftCount *count = &counts[b][s - shapeNames];
+        if(count->placements != expected.placements || count->nodes != expected.nodes ||
+           count->presses != expected.presses)
+        {
+            fprintf(stderr, "%s %c: %lu %lu %lu, expected %lu %lu %lu\n", board, shape, count->placements,
+                    count->nodes, count->presses, expected.placements, expected.nodes, expected.presses);
+            bad++;
+        }
+        lines++;
+    }
+    fclose(file);
+
+    if(lines != PERFT_BOARDS * 7)
+    {
+        fprintf(stderr, "%d of %d counts checked\n", lines, PERFT_BOARDS * 7);
+        bad++;
+    }
+    return bad;
+}
+
+static void Write(void)
+{
+    printf("# board shape placements nodes presses, from perft -w\n");
+    int b, shape;
+    for(b = 0; b < PERFT_BOARDS; b++)
+    {
+        for(shape = 0; shape < 7; shape++)
+        {
+            const tPerftCount *count = &counts[b][shape];
+            printf("%s %c %lu %lu %lu\n", boards[b].name, shapeNames[shape], count->placements,
+                   count->nodes, count->presses);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int bad = Suite(1);
+
+    if(argc > 1 && !strcmp(argv[1], "-w"))
+    {
+        Write();
+        return bad != 0;
+    }
+    bad += Check(argc > 1 ? argv[1] : "expected.txt");
+
+    unsigned long placed = placeStats.placements;
+    unsigned long nodes = placeStats.nodes;
+    clock_t start = clock();
+    int round;
+    for(round = 0; round < PERFT_ROUNDS; round++)
+    {
+        Suite(0);
+    }
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    placed = placeStats.placements - placed;
+    nodes = placeStats.nodes - nodes;
+
+    printf("%lu searches, %lu placements, %lu nodes, %.0f placements/s, %.0f nodes/s%s\n",
+           (unsigned long)PERFT_ROUNDS * PERFT_BOARDS * 7, placed, nodes,
+           seconds > 0 ? placed / seconds : 0.0, seconds > 0 ? nodes / seconds : 0.0,
+           bad ? "" : ", all counts match");
+    return bad != 0;
+}
@@ -0,0 +1,283 @@
+// Host self-play generator for training data. Worker threads each play
+// games with the board evaluator and fill their own shard with samples in
+// the layout selfplay.h gives, the same records the board streams over
+// Ethernet. Workers hand full batches to a single writer thread through a
+// bounded queue, and wait when it is full, so the disk sets the pace
+// rather than memory.
+//
+//   gcc -O2 -pthread -I.. -o selfplay selfplay.c ../game.c ../place.c ../eval.c
+//   ./selfplay [threads] [samples] [directory]   Default 4 threads, 1000000 samples, .
+//
+// Shards are shard-00.bin and up, one per worker, each a run of
+// SELFPLAY_SAMPLE_SIZE byte records; a game ends with its final snapshot
+// flagged game over and 0xFF placement bytes. Each worker has its own
+// PlaceFindIn search and EvalChooseIn board, so nothing is shared but the
+// queue. Workers play seeds of their own and number their games from 0.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "selfplay.h"
+
+#define SELFPLAY_THREADS 64
+#define SELFPLAY_PLACEMENTS 64 // More than any piece has on an open board
+#define SELFPLAY_BATCH 4096    // Samples per write
+#define SELFPLAY_SLOTS 8       // Batches the writer queue holds
+
+typedef struct
+{
+    int worker;
+    int count;
+    unsigned char samples[SELFPLAY_BATCH][SELFPLAY_SAMPLE_SIZE];
+} tBatch;
+
+typedef struct
+{
+    tPlaceSearch search;
+    tPlaceStats placeStats;
+    tEvalBoard board;
+    tEvalStats evalStats;
+    tGame game;
+    tPlacement placements[SELFPLAY_PLACEMENTS];
+    tBatch batch;
+    unsigned long seed;
+    unsigned long quota;  // Samples still to make
+    unsigned long games;
+    unsigned short pieces; // Placed in the current game
+    FILE *shard;
+    pthread_t thread;
+} tWorker;
+
+static tWorker workers[SELFPLAY_THREADS];
+
+// Writer queue of full batches, free-running head and tail
+static tBatch slots[SELFPLAY_SLOTS];
+static unsigned long slotHead;
+static unsigned long slotTail;
+static int producers; // Workers still running
+static unsigned long waits; // Times a worker found the queue full
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t notFull = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t notEmpty = PTHREAD_COND_INITIALIZER;
+
+// Copies a batch into the queue, waiting while it is full
+static void Push(const tBatch *batch)
+{
+    pthread_mutex_lock(&lock);
+    if(slotHead - slotTail == SELFPLAY_SLOTS)
+    {
+        waits++;
+    }
+    while(slotHead - slotTail == SELFPLAY_SLOTS)
+    {
+        pthread_cond_wait(&notFull, &lock);
+    }
+    pthread_mutex_unlock(&lock);
+
+    // Only this worker writes the head slot until the head moves on
+    tBatch *slot = &slots[slotHead % SELFPLAY_SLOTS];
+    memcpy(slot, batch, sizeof(tBatch) - sizeof(batch->samples) + batch->count * SELFPLAY_SAMPLE_SIZE);
+
+    pthread_mutex_lock(&lock);
+    slotHead++;
+    pthread_cond_signal(&notEmpty);
+    pthread_mutex_unlock(&lock);
+}
+
+static void NewGame(tWorker *worker)
+{
+    worker->seed = worker->seed * 1103515245UL + 12345UL;
+    GameInit(&worker->game, worker->seed);
+    GameStep(&worker->game, 0); // Deal the first piece
+    worker->pieces = 0;
+}
+
+// Snapshot of the game as the next sample, the caller fills the rest
+static unsigned char *Reserve(tWorker *worker)
+{
+    unsigned char *sample = worker->batch.samples[worker->batch.count];
+    GameSave(&worker->game, sample);
+
+    unsigned char *tail = &sample[GAME_SNAPSHOT_SIZE];
+    tail[4] = worker->games & 0xFF;
+    tail[5] = (worker->games >> 8) & 0xFF;
+    tail[6] = worker->pieces & 0xFF;
+    tail[7] = worker->pieces >> 8;
+    return tail;
+}
+
+// Places one piece, or ends the game, as SelfPlayRun does on the board
+static void Play(tWorker *worker)
+{
+    tGame *game = &worker->game;
+    int count = 0;
+    if(!game->gameover)
+    {
+        count = PlaceFindIn(&worker->search, game, game->shape, game->orientation, game->locationX,
+                            game->locationY, worker->placements, SELFPLAY_PLACEMENTS);
+        if(count > SELFPLAY_PLACEMENTS)
+        {
+            count = SELFPLAY_PLACEMENTS;
+        }
+    }
+
+    unsigned char *tail = Reserve(worker);
+    worker->batch.count++;
+    worker->quota--;
+
+    if(!count)
+    {
+        memset(tail, 0xFF, 4);
+        worker->games++;
+        NewGame(worker);
+        return;
+    }
+
+    const tPlacement *placement =
+        &worker->placements[EvalChooseIn(&worker->board, game, game->shape, worker->placements, count)];
+    tail[0] = (unsigned char)placement->x;
+    tail[1] = placement->y;
+    tail[2] = placement->orientation;
+
+    game->orientation = placement->orientation;
+    game->locationX = placement->x;
+    game->locationY = placement->y;
+    game->buttons = 0;
+    GameStep(game, INPUT_D);
+    GameStep(game, 0);
+
+    tail[3] = game->lastLock.lines;
+    worker->pieces++;
+}
+
+static void *Produce(void *arg)
+{
+    tWorker *worker = arg;
+    NewGame(worker);
+    while(worker->quota)
+    {
+        Play(worker);
+        if(worker->batch.count == SELFPLAY_BATCH || !worker->quota)
+        {
+            Push(&worker->batch);
+            worker->batch.count = 0;
+        }
+    }
+
+    pthread_mutex_lock(&lock);
+    producers--;
+    pthread_cond_signal(&notEmpty);
+    pthread_mutex_unlock(&lock);
+    return 0;
+}
+
+// Writes batches to their shards until every worker is done and the
+// queue is empty. Returns 0 if a write failed.
+static int Write(void)
+{
+    int ok = 1;
+    while(1)
+    {
+        pthread_mutex_lock(&lock);
+        while(slotHead == slotTail && producers)
+        {
+            pthread_cond_wait(&notEmpty, &lock);
+        }
+        if(slotHead == slotTail)
+        {
+            pthread_mutex_unlock(&lock);
+            return ok;
+        }
+        pthread_mutex_unlock(&lock);
+
+        // The tail slot stays put until the tail moves on
+        tBatch *slot = &slots[slotTail % SELFPLAY_SLOTS];
+        tWorker *worker = &workers[slot->worker];
+        if(fwrite(slot->samples, SELFPLAY_SAMPLE_SIZE, slot->count, worker->shard) != (size_t)slot->count)
+        {
+            ok = 0;
+        }
+
+        pthread_mutex_lock(&lock);
+        slotTail++;
+        pthread_cond_signal(&notFull);
+        pthread_mutex_unlock(&lock);
+    }
+}
+
+static double Now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+    int threads = argc > 1 ? atoi(argv[1]) : 4;
+    unsigned long samples = argc > 2 ? strtoul(argv[2], 0, 10) : 1000000;
+    const char *directory = argc > 3 ? argv[3] : ".";
+    if(threads < 1 || threads > SELFPLAY_THREADS)
+    {
+        fprintf(stderr, "1 to %d threads\n", SELFPLAY_THREADS);
+        return 1;
+    }
+
+    int i;
+    for(i = 0; i < threads; i++)
+    {
+        tWorker *worker = &workers[i];
+        char name[256];
+        snprintf(name, sizeof(name), "%s/shard-%02d.bin", directory, i);
+        worker->shard = fopen(name, "wb");
+        if(!worker->shard)
+        {
+            fprintf(stderr, "cannot create %s\n", name);
+            return 1;
+        }
+
+        worker->search.stats = &worker->placeStats;
+        worker->board.stats = &worker->evalStats;
+        worker->batch.worker = i;
+        worker->seed = 1 + i;
+        worker->quota = samples / threads + (i < samples % threads);
+    }
+
+    double start = Now();
+    producers = threads;
+    for(i = 0; i < threads; i++)
+    {
+        pthread_create(&workers[i].thread, 0, Produce, &workers[i]);
+    }
+    int ok = Write();
+    for(i = 0; i < threads; i++)
+    {
+        pthread_join(workers[i].thread, 0);
+    }
+    double seconds = Now() - start;
+
+    unsigned long games = 0;
+    for(i = 0; i < threads; i++)
+    {
+        games += workers[i].games;
+        if(fclose(workers[i].shard))
+        {
+            ok = 0;
+        }
+    }
+    if(!ok)
+    {
+        fprintf(stderr, "writing the shards failed\n");
+        return 1;
+    }
+
+    printf("%d threads: %lu samples of %d bytes, %lu games, %.2f s, %.0f samples/s, %.1f MB/s, %lu waits for the writer\n",
+           threads, samples, SELFPLAY_SAMPLE_SIZE, games, seconds, seconds > 0 ? samples / seconds : 0.0,
+           seconds > 0 ? samples * (double)SELFPLAY_SAMPLE_SIZE / seconds / 1e6 : 0.0, waits);
+    return 0;
+}
@@ -0,0 +1,10 @@
+#ifndef __FLASH_H__
+#define __FLASH_H__
+
+// Host stand-in for the stack measurement, programming and erasing do
+// nothing so the game log runs its packing without a flash behind it
+extern long FlashProgram(unsigned long *pulData, unsigned long ulAddress, unsigned long ulCount);
+extern long FlashErase(unsigned long ulAddress);
+extern void FlashUsecSet(unsigned long ulClocks);
+
+#endif
@@ -0,0 +1,270 @@
+// Host tool that measures how deep each of the firmware's deep call paths
+// goes on the stack, to size --stack_size and __STACK_TOP from data.
+//
+//   gcc -O2 -Wl,-z,now -I. -I.. -o stack stack.c ../game.c ../place.c ../eval.c ../think.c
+//       ../pc.c ../events.c ../anim.c ../gamelog.c ../render.c ../frame.c -x c ../graphics.cpp
+//   ./stack
+//
+// -z now binds the library calls at load. Bound lazily, the first call to
+// memcpy and the like saves the vector registers on the measured stack.
+//
+// Each path runs on its own painted stack, the way memmap.c paints the
+// target's, and the lowest overwritten byte is its depth. The depth of an
+// empty path, the context switch itself, is taken off. The paths are those
+// the main loop tasks run; the interrupt handlers only read a register or
+// two and queue a byte, and are allowed for separately in timers_ccs.cmd.
+//
+// x86-64 frames are larger than Thumb-2 ones: pointers and saved registers
+// are eight bytes and frames are kept 16 byte aligned. The figures are an
+// upper bound for the target, which the benchmark build checks against
+// memStats on the board itself.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "think.h"
+#include "pc.h"
+#include "events.h"
+#include "anim.h"
+#include "gamelog.h"
+#include "frame.h"
+#include "render.h"
+
+#define STACK_SIZE 65536
+#define STACK_PAINT 0xA5
+#define STACK_GAMES 20
+#define STACK_PLACEMENTS 256
+
+// What the firmware modules expect from timers.c and the driver library
+unsigned long g_ulSystemClock = 8000000;
+unsigned char g_pucFrame[6144];
+unsigned long SchedTimestamp(void) { static unsigned long now; return now += 100; }
+unsigned long SchedElapsed(unsigned long from, unsigned long to) { return to - from; }
+long FlashProgram(unsigned long *pulData, unsigned long ulAddress, unsigned long ulCount) { return 0; }
+long FlashErase(unsigned long ulAddress) { return 0; }
+void FlashUsecSet(unsigned long ulClocks) { }
+
+static unsigned char stack[STACK_SIZE];
+static ucontext_t caller;
+static ucontext_t path;
+
+static tGame game;
+static tPlacement placements[STACK_PLACEMENTS];
+static unsigned char moves[STACK_PLACEMENTS];
+static tPcMove solution[PC_MAX_PIECES];
+static unsigned char previous[FRAME_BYTES];
+static unsigned char encoded[FRAME_DELTA_MAX];
+
+// Plays a decision for the piece in play and drops it, as selfplay.c does
+static void Place(int choice)
+{
+    game.orientation = placements[choice].orientation;
+    game.locationX = placements[choice].x;
+    game.locationY = placements[choice].y;
+    game.buttons = 0;
+    GameStep(&game, INPUT_D);
+    GameStep(&game, 0);
+}
+
+static void Nothing(void)
+{
+}
+
+// Game task: steps with every button, garbage queued, and the invariant
+// check the Debug build asserts after each step
+static void Step(void)
+{
+    int g;
+    for(g = 0; g < STACK_GAMES; g++)
+    {
+        GameInit(&game, g + 1);
+        unsigned long tick;
+        for(tick = 0; !game.gameover && tick < 20000; tick++)
+        {
+            GameStep(&game, (tick * 7 + g) % 3 ? 1 << (tick % 5) : 0);
+            GameCheck(&game);
+            GameHash(&game, 2166136261UL);
+            if(tick % 97 == 0)
+            {
+                game.garbageIn += 1 + tick % 4;
+            }
+        }
+    }
+}
+
+// Self-play task: the placement search and the evaluator's choice
+static void Choose(void)
+{
+    int g;
+    for(g = 0; g < STACK_GAMES; g++)
+    {
+        GameInit(&game, g + 1);
+        GameStep(&game, 0);
+        while(!game.gameover)
+        {
+            int count = PlaceFind(&game, game.shape, game.orientation, game.locationX, game.locationY,
+                                  placements, STACK_PLACEMENTS);
+            if(!count)
+            {
+                break;
+            }
+            Place(EvalChoose(&game, game.shape, placements, count > STACK_PLACEMENTS ? STACK_PLACEMENTS : count));
+        }
+    }
+}
+
+// Think task: full searches run to the end, then the commit
+static void Think(void)
+{
+    int g;
+    for(g = 0; g < 4; g++)
+    {
+        GameInit(&game, g + 1);
+        GameStep(&game, 0);
+        int piece;
+        for(piece = 0; piece < 100 && !game.gameover; piece++)
+        {
+            ThinkStart(&game);
+            while(ThinkSlice(thinkSlice))
+            {
+            }
+            if(ThinkCommit(moves, STACK_PLACEMENTS) < 0)
+            {
+                break;
+            }
+            GameStep(&game, INPUT_D);
+            GameStep(&game, 0);
+        }
+    }
+}
+
+// Perfect clear solver over random queues on the empty board
+static void Solve(void)
+{
+    unsigned char queue[PC_MAX_PIECES];
+    int n, i;
+    srand(1);
+    pcNodeLimit = 200000;
+    for(n = 0; n < 20; n++)
+    {
+        for(i = 0; i < PC_MAX_PIECES; i++)
+        {
+            queue[i] = rand() % 7;
+        }
+        GameInit(&game, n + 1);
+        PcSolve(&game, queue, GAME_COLS, solution);
+    }
+}
+
+static void LogEvent(const tEvent *event)
+{
+    if(event->type == EVENT_LOCK)
+    {
+        GameLogAppend(&event->lock);
+    }
+    else if(event->type == EVENT_GAMEOVER)
+    {
+        GameLogFlush();
+    }
+}
+
+static void AnimEvent(const tEvent *event)
+{
+    if(event->type == EVENT_LOCK)
+    {
+        AnimAbort();
+        AnimStart(&event->lock);
+    }
+}
+
+// Event task with the log and animation subscribers timers.c has, and the
+// render task drawing and encoding the frame as the animation runs. One
+// long game, as EventWatch follows a single board from boot, so the log
+// fills and writes several blocks.
+static void Events(void)
+{
+    GameInit(&game, 1);
+    GameStep(&game, 0);
+    int piece;
+    for(piece = 0; piece < 2000 && !game.gameover; piece++)
+    {
+        int count = PlaceFind(&game, game.shape, game.orientation, game.locationX, game.locationY,
+                              placements, STACK_PLACEMENTS);
+        if(!count)
+        {
+            break;
+        }
+        Place(EvalChoose(&game, game.shape, placements, count > STACK_PLACEMENTS ? STACK_PLACEMENTS : count));
+        EventWatch(&game);
+        while(EventDrain())
+        {
+        }
+        AnimTick(0);
+        RenderGame(g_pucFrame, &game);
+        RenderScore(g_pucFrame, &game);
+        FrameEncode(g_pucFrame, previous, encoded);
+    }
+}
+
+static void Enter(void (*run)(void))
+{
+    run();
+}
+
+// Runs one path on a freshly painted stack, returns the bytes it used
+static unsigned long Measure(void (*run)(void))
+{
+    memset(stack, STACK_PAINT, sizeof(stack));
+    getcontext(&path);
+    path.uc_stack.ss_sp = stack;
+    path.uc_stack.ss_size = sizeof(stack);
+    path.uc_link = &caller;
+    makecontext(&path, (void (*)(void))Enter, 1, run);
+    swapcontext(&caller, &path);
+
+    unsigned long i = 0;
+    while(i < sizeof(stack) && stack[i] == STACK_PAINT)
+    {
+        i++;
+    }
+    return sizeof(stack) - i;
+}
+
+int main(int argc, char **argv)
+{
+    static const struct
+    {
+        const char *name;
+        void (*run)(void);
+    } paths[] =
+    {
+        { "step", Step },
+        { "choose", Choose },
+        { "think", Think },
+        { "pc", Solve },
+        { "events", Events },
+    };
+
+    EventSubscribe(LogEvent);
+    EventSubscribe(AnimEvent);
+
+    unsigned long base = Measure(Nothing);
+    unsigned long deepest = 0;
+    int i;
+    for(i = 0; i < sizeof(paths) / sizeof(paths[0]); i++)
+    {
+        unsigned long depth = Measure(paths[i].run) - base;
+        printf("%-7s %5lu bytes\n", paths[i].name, depth);
+        fflush(stdout);
+        if(depth > deepest)
+        {
+            deepest = depth;
+        }
+    }
+    printf("deepest %lu bytes\n", deepest);
+    return 0;
+}
@@ -0,0 +1,112 @@
+// Host driver for the computer player's anytime search. It plays split
+// screen games for the computer alone, a tick at a time: CpuTick, then the
+// game step, then a number of idle slices of ThinkSlice as the think task
+// gets them between ticks.
+//
+//   gcc -O2 -I.. -o think think.c ../cpu.c ../think.c ../book.c ../place.c ../eval.c ../game.c
+//   ./think [games] [slices]   Default 20 games, a run with no idle slices then one with 4
+//
+// There is no cycle counter on the host, so time is modelled: each read of
+// SchedTimestamp moves the clock on by THINK_STEP_CYCLES. The search reads
+// it once per step, one placement scored or one expanded, so a budget of
+// cpuBudget cycles runs cpuBudget / THINK_STEP_CYCLES steps. The model
+// counts steps rather than timing them, and the runs repeat exactly. Each
+// game stops at THINK_PIECES pieces, and a garbage line is queued every
+// THINK_GARBAGE pieces to stand in for the player.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "game.h"
+#include "think.h"
+#include "cpu.h"
+
+#define THINK_STEP_CYCLES 2000 // Modelled cost of one search step
+#define THINK_PIECES 1000
+#define THINK_GARBAGE 20
+
+static unsigned long now;
+
+unsigned long SchedTimestamp(void)
+{
+    return now += THINK_STEP_CYCLES;
+}
+
+unsigned long SchedElapsed(unsigned long from, unsigned long to)
+{
+    return to - from;
+}
+
+static tGame game;
+
+typedef struct
+{
+    unsigned long pieces;
+    unsigned long lines;
+    unsigned long gameovers;
+} tRun;
+
+static void Run(int games, int slices, tRun *run)
+{
+    memset(run, 0, sizeof(tRun));
+    memset(&thinkStats, 0, sizeof(thinkStats));
+    memset(&cpuStats, 0, sizeof(cpuStats));
+
+    int g;
+    for(g = 0; g < games; g++)
+    {
+        GameInit(&game, g + 1);
+        CpuInit();
+        unsigned long locks = 0;
+        while(!game.gameover && game.locks < THINK_PIECES)
+        {
+            GameStep(&game, CpuTick(&game));
+            if(game.locks != locks)
+            {
+                locks = game.locks;
+                run->lines += game.lastLock.lines;
+                if(locks % THINK_GARBAGE == 0)
+                {
+                    game.garbageIn++;
+                }
+            }
+
+            int i;
+            for(i = 0; i < slices && ThinkSlice(thinkSlice); i++)
+            {
+            }
+        }
+        run->pieces += game.locks;
+        run->gameovers += game.gameover;
+    }
+}
+
+static void Report(int games, int slices, const tRun *run)
+{
+    unsigned long searches = thinkStats.depths[0] + thinkStats.depths[1] + thinkStats.depths[2];
+    printf("%d slices: %d games, %lu pieces, %lu lines, %lu game overs\n", slices, games, run->pieces, run->lines,
+           run->gameovers);
+    printf("  searches %lu: depth 0 %lu, depth 1 %lu, depth 2 %lu (%.0f%%), lost %lu\n", searches,
+           thinkStats.depths[0], thinkStats.depths[1], thinkStats.depths[2],
+           searches ? 100.0 * thinkStats.depths[2] / searches : 0.0, cpuStats.lost);
+}
+
+int main(int argc, char **argv)
+{
+    int games = argc > 1 ? atoi(argv[1]) : 20;
+    tRun run;
+
+    if(argc > 2)
+    {
+        int slices = atoi(argv[2]);
+        Run(games, slices, &run);
+        Report(games, slices, &run);
+        return 0;
+    }
+
+    Run(games, 0, &run);
+    Report(games, 0, &run);
+    Run(games, 4, &run);
+    Report(games, 4, &run);
+    return 0;
+}
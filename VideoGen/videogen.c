@@ -0,0 +1,390 @@
+// Host tool that turns a recorded input log into a video of the display,
+// drawn by the firmware's own renderer into a frame like g_pucFrame.
+//
+//   gcc -O2 -I.. -o videogen videogen.c ../game.c ../render.c ../frame.c ../anim.c -x c ../graphics.cpp
+//   ./videogen encode input.log > game.vid
+//   ./videogen gif game.vid > game.gif
+//   ./videogen raw game.vid > game.raw   (ffmpeg: -f rawvideo -pix_fmt gray -s 128x96 -r 20)
+//
+// Add -DBOARD_VARIANT=n to the build to record another board variant, which
+// the log must have been played on.
+//
+// An input log is a little-endian u32 seed followed by one byte per game
+// tick, the input mask the game task stepped with. Frames are taken every
+// VIDEO_TICKS ticks, as the render task does.
+//
+// A video is a u32 VIDEO_MAGIC and a u16 frame period in milliseconds,
+// then for each frame a u16 length and the frame as FrameEncode wrote it:
+// XOR against the frame before, run length coded. The first frame is
+// coded against a blank one. Encoding and both exports hold only the
+// current and previous frame, however long the game.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "game.h"
+#include "anim.h"
+#include "frame.h"
+#include "render.h"
+
+#define VIDEO_MAGIC 0x44495654 // "TVID"
+#define VIDEO_TICKS 5          // Game ticks per frame, the render period
+#define VIDEO_PERIOD 50        // Milliseconds per frame
+#define VIDEO_TAIL 20          // Frames kept after game over
+
+// GIF codes stay five bits wide when the table is cleared this often
+#define GIF_CLEAR_EVERY 12
+
+static unsigned char frame[FRAME_BYTES];
+static unsigned char previous[FRAME_BYTES];
+static unsigned char delta[FRAME_DELTA_MAX];
+static tGame game;
+
+static void Write16(FILE *file, unsigned long value)
+{
+    fputc(value & 0xFF, file);
+    fputc((value >> 8) & 0xFF, file);
+}
+
+static void Write32(FILE *file, unsigned long value)
+{
+    Write16(file, value);
+    Write16(file, value >> 16);
+}
+
+static int Read16(FILE *file, unsigned long *value)
+{
+    int lo = fgetc(file);
+    int hi = fgetc(file);
+    if(hi == EOF)
+    {
+        return 0;
+    }
+    *value = lo | (hi << 8);
+    return 1;
+}
+
+static int Read32(FILE *file, unsigned long *value)
+{
+    unsigned long lo, hi;
+    if(!Read16(file, &lo) || !Read16(file, &hi))
+    {
+        return 0;
+    }
+    *value = lo | (hi << 16);
+    return 1;
+}
+
+// Draws what DrawGame would show
+static void DrawFrame(void)
+{
+    RenderGame(frame, &game);
+    RenderScore(frame, &game);
+    if(game.gameover)
+    {
+        FrameStringDraw(frame, "   GAME OVER   ", 20, 48, 15);
+    }
+}
+
+static void WriteFrame(FILE *out)
+{
+    int length = FrameEncode(frame, previous, delta);
+    Write16(out, length);
+    fwrite(delta, 1, length, out);
+}
+
+static int Encode(FILE *in, FILE *out)
+{
+    unsigned long seed;
+    if(!Read32(in, &seed))
+    {
+        fprintf(stderr, "input log has no seed\n");
+        return 1;
+    }
+
+    GameInit(&game, seed);
+    memset(frame, 0, sizeof(frame));
+    memset(previous, 0, sizeof(previous));
+    RenderInit(frame);
+
+    Write32(out, VIDEO_MAGIC);
+    Write16(out, VIDEO_PERIOD);
+
+    unsigned long ticks = 0;
+    unsigned long frames = 0;
+    unsigned long bytes = 0;
+    unsigned long locks = 0;
+    int tail = VIDEO_TAIL;
+    int input;
+    while((input = fgetc(in)) != EOF && tail)
+    {
+        GameStep(&game, input & 0x1F);
+        if(game.locks != locks)
+        {
+            // As AnimEvents does for the lock event
+            AnimAbort();
+            AnimStart(&game.lastLock);
+            locks = game.locks;
+        }
+        AnimTick(0);
+
+        if(++ticks % VIDEO_TICKS == 0)
+        {
+            DrawFrame();
+            long before = ftell(out);
+            WriteFrame(out);
+            bytes += ftell(out) - before;
+            frames++;
+            if(game.gameover)
+            {
+                tail--;
+            }
+        }
+    }
+
+    fprintf(stderr, "%lu ticks, %lu frames, %lu bytes, %lu bytes per frame, score %d\n",
+            ticks, frames, bytes, frames ? bytes / frames : 0, game.score);
+    return 0;
+}
+
+// Reads the next frame into frame, returning 0 at the end of the video
+static int DecodeFrame(FILE *in)
+{
+    unsigned long length;
+    if(!Read16(in, &length))
+    {
+        return 0;
+    }
+    if(length > FRAME_DELTA_MAX || fread(delta, 1, length, in) != length || !FrameDecode(delta, length, frame))
+    {
+        fprintf(stderr, "corrupt frame\n");
+        exit(1);
+    }
+    return 1;
+}
+
+static int OpenVideo(FILE *in, unsigned long *period)
+{
+    unsigned long magic;
+    if(!Read32(in, &magic) || magic != VIDEO_MAGIC || !Read16(in, period))
+    {
+        fprintf(stderr, "not a video\n");
+        return 0;
+    }
+    memset(frame, 0, sizeof(frame));
+    return 1;
+}
+
+static int Pixel(const unsigned char *f, int x, int y)
+{
+    int pair = f[y * FRAME_STRIDE + x / 2];
+    return x & 1 ? pair & 0x0F : pair >> 4;
+}
+
+static int ExportRaw(FILE *in, FILE *out)
+{
+    unsigned long period;
+    if(!OpenVideo(in, &period))
+    {
+        return 1;
+    }
+
+    while(DecodeFrame(in))
+    {
+        int i;
+        for(i = 0; i < FRAME_WIDTH * FRAME_HEIGHT; i++)
+        {
+            fputc(Pixel(frame, i % FRAME_WIDTH, i / FRAME_WIDTH) * 17, out);
+        }
+    }
+    return 0;
+}
+
+// GIF image data, written without compression: a clear code every few
+// pixels keeps every code five bits wide
+typedef struct
+{
+    FILE *file;
+    unsigned char block[255];
+    int length;
+    unsigned long bits;
+    int count;
+} tGifData;
+
+static void GifByte(tGifData *data, int byte)
+{
+    data->block[data->length++] = byte;
+    if(data->length == 255)
+    {
+        fputc(255, data->file);
+        fwrite(data->block, 1, 255, data->file);
+        data->length = 0;
+    }
+}
+
+static void GifCode(tGifData *data, int code)
+{
+    data->bits |= (unsigned long)code << data->count;
+    data->count += 5;
+    while(data->count >= 8)
+    {
+        GifByte(data, data->bits & 0xFF);
+        data->bits >>= 8;
+        data->count -= 8;
+    }
+}
+
+// Writes rows first to last of f as one image shown for delay centiseconds
+static void GifImage(FILE *out, const unsigned char *f, int first, int last, int delay)
+{
+    fputc(0x21, out); // Graphic control, leave the image in place
+    fputc(0xF9, out);
+    fputc(4, out);
+    fputc(0x04, out);
+    Write16(out, delay);
+    fputc(0, out);
+    fputc(0, out);
+
+    fputc(0x2C, out);
+    Write16(out, 0);
+    Write16(out, first);
+    Write16(out, FRAME_WIDTH);
+    Write16(out, last - first + 1);
+    fputc(0, out);
+
+    fputc(4, out); // Minimum code size, 16 colours
+    tGifData data = { out, { 0 }, 0, 0, 0 };
+    int pixels = 0;
+    int x, y;
+    for(y = first; y <= last; y++)
+    {
+        for(x = 0; x < FRAME_WIDTH; x++)
+        {
+            if(pixels++ % GIF_CLEAR_EVERY == 0)
+            {
+                GifCode(&data, 16);
+            }
+            GifCode(&data, Pixel(f, x, y));
+        }
+    }
+    GifCode(&data, 17);
+    if(data.count)
+    {
+        GifByte(&data, data.bits & 0xFF);
+    }
+    if(data.length)
+    {
+        fputc(data.length, out);
+        fwrite(data.block, 1, data.length, out);
+    }
+    fputc(0, out);
+}
+
+// Frames that change nothing only lengthen the one before, so each image
+// is written once the next change shows how long it stayed up
+static int ExportGif(FILE *in, FILE *out)
+{
+    unsigned long period;
+    if(!OpenVideo(in, &period))
+    {
+        return 1;
+    }
+
+    fwrite("GIF89a", 1, 6, out);
+    Write16(out, FRAME_WIDTH);
+    Write16(out, FRAME_HEIGHT);
+    fputc(0xF3, out); // Global table of 16 colours
+    fputc(0, out);
+    fputc(0, out);
+    int i;
+    for(i = 0; i < 16; i++)
+    {
+        fputc(i * 17, out);
+        fputc(i * 17, out);
+        fputc(i * 17, out);
+    }
+
+    // Loop forever
+    fputc(0x21, out);
+    fputc(0xFF, out);
+    fputc(11, out);
+    fwrite("NETSCAPE2.0", 1, 11, out);
+    fputc(3, out);
+    fputc(1, out);
+    Write16(out, 0);
+    fputc(0, out);
+
+    // The pending image is previous, rows first to last
+    memset(previous, 0, sizeof(previous));
+    int first = 0;
+    int last = FRAME_HEIGHT - 1;
+    unsigned long shown = 0;
+    unsigned long frames = 0;
+    while(DecodeFrame(in))
+    {
+        int top = 0;
+        int bottom = FRAME_HEIGHT - 1;
+        while(top < FRAME_HEIGHT && !memcmp(&frame[top * FRAME_STRIDE], &previous[top * FRAME_STRIDE], FRAME_STRIDE))
+        {
+            top++;
+        }
+        if(top == FRAME_HEIGHT && frames)
+        {
+            shown += period;
+            continue;
+        }
+        while(bottom > top && !memcmp(&frame[bottom * FRAME_STRIDE], &previous[bottom * FRAME_STRIDE], FRAME_STRIDE))
+        {
+            bottom--;
+        }
+
+        if(frames)
+        {
+            GifImage(out, previous, first, last, (shown + 5) / 10);
+        }
+        memcpy(previous, frame, sizeof(previous));
+        first = top < FRAME_HEIGHT ? top : 0;
+        last = top < FRAME_HEIGHT ? bottom : 0;
+        shown = period;
+        frames++;
+    }
+    if(frames)
+    {
+        GifImage(out, previous, first, last, (shown + 5) / 10);
+    }
+
+    fputc(0x3B, out);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if(argc < 2)
+    {
+        fprintf(stderr, "usage: videogen encode|gif|raw [file]\n");
+        return 1;
+    }
+
+    FILE *in = stdin;
+    if(argc > 2 && !(in = fopen(argv[2], "rb")))
+    {
+        fprintf(stderr, "cannot open %s\n", argv[2]);
+        return 1;
+    }
+
+    if(!strcmp(argv[1], "encode"))
+    {
+        return Encode(in, stdout);
+    }
+    if(!strcmp(argv[1], "gif"))
+    {
+        return ExportGif(in, stdout);
+    }
+    if(!strcmp(argv[1], "raw"))
+    {
+        return ExportRaw(in, stdout);
+    }
+
+    fprintf(stderr, "unknown command %s\n", argv[1]);
+    return 1;
+}
@@ -0,0 +1,136 @@
+#include "game.h"
+#include "anim.h"
+
+// While animating the board is drawn as it was before the clear: cleared
+// rows take their animated look and every other row is read from where it
+// now sits in the collapsed grid. Only the cleared rows change from one
+// animation frame to the next, so the flush sends little more than them.
+
+#define WIPE_STEPS (GAME_COLS / 2)
+
+tAnimStats animStats;
+
+static int stage = ANIM_IDLE;
+static int elapsed;      // Ticks into the stage
+static int top;          // Board row of the first cleared row's box
+static unsigned char cleared; // Cleared rows as bits from top
+static int garbage;      // Rows the collapsed board was pushed up by
+
+void AnimStart(const tGameLock *lock)
+{
+    if(!lock->cleared)
+    {
+        return;
+    }
+
+    stage = ANIM_FLASH;
+    elapsed = 0;
+    top = lock->y;
+    cleared = lock->cleared;
+    garbage = lock->garbage;
+    animStats.clears++;
+}
+
+// Drops straight to the collapsed board
+void AnimAbort(void)
+{
+    if(stage != ANIM_IDLE)
+    {
+        stage = ANIM_IDLE;
+        animStats.aborted++;
+    }
+}
+
+// Advances the animation by one game tick, with the ticks waiting behind
+// it. Returns 1 if the board looks different.
+int AnimTick(int behind)
+{
+    if(stage == ANIM_IDLE)
+    {
+        return 0;
+    }
+
+    if(behind)
+    {
+        animStats.lateTicks++;
+        if((unsigned long)behind > animStats.maxLate)
+        {
+            animStats.maxLate = behind;
+        }
+    }
+
+    elapsed++;
+    if(stage == ANIM_FLASH)
+    {
+        if(elapsed == ANIM_FLASH_TICKS)
+        {
+            stage = ANIM_WIPE;
+            elapsed = 0;
+            return 1;
+        }
+        return elapsed % ANIM_BLINK_TICKS == 0;
+    }
+
+    if(elapsed == (WIPE_STEPS + 1) * ANIM_WIPE_STEP_TICKS)
+    {
+        stage = ANIM_IDLE; // Collapse
+        return 1;
+    }
+    return elapsed % ANIM_WIPE_STEP_TICKS == 0;
+}
+
+int AnimActive(void)
+{
+    return stage != ANIM_IDLE;
+}
+
+// Grid row to draw at a board row, -1 for a cleared row and GAME_ROWS for
+// one pushed out of the top. Rows are kept as the lock left them, before
+// any garbage, so garbage only shows once the rows collapse.
+int AnimSourceRow(int row)
+{
+    int offset = row - top;
+    if(offset >= 0 && offset < 4 && (cleared & (1 << offset)))
+    {
+        return -1;
+    }
+
+    // Rows above a cleared row have dropped by one for each below them
+    int drop = 0;
+    int i;
+    for(i = offset + 1; i < 4; i++)
+    {
+        if(i >= 0 && (cleared & (1 << i)))
+        {
+            drop++;
+        }
+    }
+
+    // Then garbage pushed the collapsed board up
+    row += drop - garbage;
+    return row >= 0 ? row : GAME_ROWS;
+}
+
+// Returns 1 if a cell of a cleared row is drawn filled this frame
+int AnimCellShown(int column)
+{
+    if(stage == ANIM_FLASH)
+    {
+        return (elapsed / ANIM_BLINK_TICKS) % 2 == 0;
+    }
+
+    // Distance from the centre, 0 for the middle pair of columns
+    int distance = column < GAME_COLS / 2 ? GAME_COLS / 2 - 1 - column : column - GAME_COLS / 2;
+    return distance >= elapsed / ANIM_WIPE_STEP_TICKS;
+}
+
+// Records the bytes sent for a frame flushed while animating
+void AnimFrame(unsigned long bytes)
+{
+    animStats.frames++;
+    animStats.bytes += bytes;
+    if(bytes > animStats.maxBytes)
+    {
+        animStats.maxBytes = bytes;
+    }
+}
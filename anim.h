@@ -0,0 +1,39 @@
+#ifndef __ANIM_H__
+#define __ANIM_H__
+
+#include "game.h"
+
+// Line clear animation stages. The game has already removed the rows; the
+// animation only changes how the board is drawn, so game timing and
+// gravity carry on as normal.
+#define ANIM_IDLE  0
+#define ANIM_FLASH 1 // Cleared rows blink
+#define ANIM_WIPE  2 // Cleared rows empty from the centre out, then collapse
+
+// Stage timing in ticks
+#define ANIM_FLASH_TICKS 16
+#define ANIM_BLINK_TICKS 4
+#define ANIM_WIPE_STEP_TICKS 2 // Per column pair wiped
+
+typedef struct
+{
+    unsigned long clears;   // Animations started
+    unsigned long aborted;  // Cut short by the next lock
+    unsigned long frames;   // Frames flushed while animating
+    unsigned long bytes;    // Bytes sent over SSI for those frames
+    unsigned long maxBytes; // Largest of those frames
+    unsigned long lateTicks; // Ticks processed late while animating
+    unsigned long maxLate;  // Most ticks behind while animating
+} tAnimStats;
+
+extern tAnimStats animStats;
+
+extern void AnimStart(const tGameLock *lock);
+extern void AnimAbort(void);
+extern int AnimTick(int behind);
+extern int AnimActive(void);
+extern int AnimSourceRow(int row);
+extern int AnimCellShown(int column);
+extern void AnimFrame(unsigned long bytes);
+
+#endif
@@ -0,0 +1,259 @@
+#include <string.h>
+#include "game.h"
+#include "batch.h"
+
+// A piece dropped from above lands where the first of its columns meets the
+// stack, so the column heights give the landing row without any collision
+// search. Rows are tested whole, all columns in one compare, and only the
+// four rows the piece landed in can have filled.
+
+#define FULL_ROW ((1 << GAME_COLS) - 1)
+
+// Each shape and orientation moved to the left of its box
+typedef struct
+{
+    unsigned short rows[4]; // Cells in each row of the box
+    signed char bottom[4];  // Lowest filled row of each column, -1 if none
+    unsigned char top;      // First filled row
+    unsigned char width;    // Columns filled
+} tBatchShape;
+
+tBatchStats batchStats;
+
+static tBatchShape shapes[7][4];
+static int shapesReady = 0;
+
+static void PrepareShapes(void)
+{
+    int shape, orientation, i, j;
+    for(shape = 0; shape < 7; shape++)
+    {
+        for(orientation = 0; orientation < 4; orientation++)
+        {
+            int mask = shapeMasks[shape][orientation];
+            tBatchShape *s = &shapes[shape][orientation];
+
+            int columns = 0;
+            for(i = 0; i < 4; i++)
+            {
+                columns |= (mask >> (4 * i)) & 0xF;
+            }
+            int left = 0;
+            while(!(columns & (1 << left)))
+            {
+                left++;
+            }
+            columns >>= left;
+
+            s->width = 0;
+            while(columns >> s->width)
+            {
+                s->width++;
+            }
+
+            s->top = 4;
+            for(i = 3; i >= 0; i--)
+            {
+                s->rows[i] = ((mask >> (4 * i)) & 0xF) >> left;
+                if(s->rows[i])
+                {
+                    s->top = i;
+                }
+            }
+
+            for(j = 0; j < 4; j++)
+            {
+                s->bottom[j] = -1;
+                for(i = 0; i < 4; i++)
+                {
+                    if(s->rows[i] & (1 << j))
+                    {
+                        s->bottom[j] = i;
+                    }
+                }
+            }
+        }
+    }
+    shapesReady = 1;
+}
+
+// Same generator as the game, one state per board
+static int Rand(tBatch *batch, int game)
+{
+    batch->seed[game] = (batch->seed[game] * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (int)((batch->seed[game] >> 16) & 0x7FFF);
+}
+
+// Empties one board and deals its first two pieces, carrying on from its
+// generator state
+void BatchReset(tBatch *batch, int game)
+{
+    int i;
+    for(i = 0; i < GAME_ROWS; i++)
+    {
+        batch->rows[i][game] = 0;
+    }
+    for(i = 0; i < GAME_COLS; i++)
+    {
+        batch->heights[i][game] = 0;
+    }
+
+    batch->shape[game] = Rand(batch, game) % 7;
+    batch->nextShape[game] = Rand(batch, game) % 7;
+    batch->pieces[game] = 0;
+}
+
+void BatchInit(tBatch *batch, int count, unsigned long seed)
+{
+    if(!shapesReady)
+    {
+        PrepareShapes();
+    }
+
+    batch->count = count;
+
+    int i;
+    for(i = 0; i < count; i++)
+    {
+        batch->seed[i] = seed + i;
+        BatchReset(batch, i);
+    }
+}
+
+// Takes a height for every column again, after rows have moved
+static void Heights(tBatch *batch, int game)
+{
+    int seen = 0;
+    int row;
+    for(row = 0; row < GAME_ROWS && seen != FULL_ROW; row++)
+    {
+        int fresh = batch->rows[row][game] & ~seen;
+        seen |= fresh;
+        while(fresh)
+        {
+            int column = 0;
+            while(!(fresh & (1 << column)))
+            {
+                column++;
+            }
+            batch->heights[column][game] = GAME_ROWS - row;
+            fresh &= fresh - 1;
+        }
+    }
+
+    int column;
+    for(column = 0; column < GAME_COLS; column++)
+    {
+        if(!(seen & (1 << column)))
+        {
+            batch->heights[column][game] = 0;
+        }
+    }
+}
+
+// Places one piece on one board. Returns the lines cleared, or -1 if the
+// piece is left sticking out of the top.
+static int Place(tBatch *batch, int game, int action)
+{
+    const tBatchShape *s = &shapes[batch->shape[game]][action / GAME_COLS];
+    int x = action % GAME_COLS;
+    if(x + s->width > GAME_COLS)
+    {
+        x = GAME_COLS - s->width;
+    }
+
+    // Box row where the first column meets the stack
+    int y = GAME_ROWS;
+    int j;
+    for(j = 0; j < s->width; j++)
+    {
+        int rest = GAME_ROWS - batch->heights[x + j][game] - 1 - s->bottom[j];
+        if(rest < y)
+        {
+            y = rest;
+        }
+    }
+    if(y + s->top < 0)
+    {
+        return -1;
+    }
+
+    int full = 0;
+    int i;
+    for(i = s->top; i < 4 && s->rows[i]; i++)
+    {
+        unsigned short row = batch->rows[y + i][game] | (s->rows[i] << x);
+        batch->rows[y + i][game] = row;
+        if(row == FULL_ROW)
+        {
+            full |= 1 << i;
+        }
+    }
+
+    if(!full)
+    {
+        for(j = 0; j < s->width; j++)
+        {
+            for(i = s->top; i <= s->bottom[j] && !(s->rows[i] & (1 << j)); i++)
+            {
+            }
+            if(GAME_ROWS - (y + i) > batch->heights[x + j][game])
+            {
+                batch->heights[x + j][game] = GAME_ROWS - (y + i);
+            }
+        }
+        return 0;
+    }
+
+    // Move the rows above each full one down over it
+    int lines = 0;
+    int to = y + 3 < GAME_ROWS ? y + 3 : GAME_ROWS - 1;
+    int from;
+    for(from = to; from >= 0; from--)
+    {
+        if(from >= y && (full & (1 << (from - y))))
+        {
+            lines++;
+            continue;
+        }
+        batch->rows[to--][game] = batch->rows[from][game];
+    }
+    for(; to >= 0; to--)
+    {
+        batch->rows[to][game] = 0;
+    }
+
+    Heights(batch, game);
+    return lines;
+}
+
+// Places the current piece of every game with its action, writing the lines
+// each cleared and whether it ended. Ended games are reset, so the batch
+// always holds live games.
+void BatchStep(tBatch *batch, const unsigned char *actions, unsigned char *lines, unsigned char *done)
+{
+    int game;
+    for(game = 0; game < batch->count; game++)
+    {
+        int cleared = Place(batch, game, actions[game] % BATCH_ACTIONS);
+
+        if(cleared < 0)
+        {
+            lines[game] = 0;
+            done[game] = 1;
+            BatchReset(batch, game);
+            batchStats.resets++;
+            continue;
+        }
+
+        lines[game] = cleared;
+        done[game] = 0;
+        batchStats.lines += cleared;
+
+        batch->shape[game] = batch->nextShape[game];
+        batch->nextShape[game] = Rand(batch, game) % 7;
+        batch->pieces[game]++;
+    }
+
+    batchStats.steps += batch->count;
+}
@@ -0,0 +1,45 @@
+#ifndef __BATCH_H__
+#define __BATCH_H__
+
+#include "game.h"
+
+// Batch of simplified games stepped together for training experiments, with
+// a reset and step interface. A step places the current piece of every game
+// at once: it drops straight down from above the stack in a chosen
+// orientation and column, then lines clear and the next piece is dealt.
+//
+// State is kept as one array per field, each indexed by game, so a kernel
+// walks one field of every game in order. Each board row is a bitmask,
+// bit c for column c. The caller owns the tBatch and reads the observation
+// straight from it; nothing is copied out.
+#define BATCH_MAX 32 // Games in one batch
+
+// Actions are orientation * GAME_COLS + column of the piece's leftmost cell.
+// Pieces that would hang off the right edge are moved back onto the board.
+#define BATCH_ACTIONS (4 * GAME_COLS)
+
+typedef struct
+{
+    int count;
+    unsigned short rows[GAME_ROWS][BATCH_MAX];     // Row 0 at the top
+    unsigned char heights[GAME_COLS][BATCH_MAX];   // Rows from the floor to the top filled cell
+    unsigned char shape[BATCH_MAX];
+    unsigned char nextShape[BATCH_MAX];
+    unsigned long seed[BATCH_MAX];
+    unsigned short pieces[BATCH_MAX];              // Placed since the last reset
+} tBatch;
+
+typedef struct
+{
+    unsigned long steps;  // Game steps, one per game per BatchStep
+    unsigned long lines;
+    unsigned long resets; // Games ended and started again
+} tBatchStats;
+
+extern tBatchStats batchStats;
+
+extern void BatchInit(tBatch *batch, int count, unsigned long seed);
+extern void BatchReset(tBatch *batch, int game);
+extern void BatchStep(tBatch *batch, const unsigned char *actions, unsigned char *lines, unsigned char *done);
+
+#endif
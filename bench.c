@@ -0,0 +1,440 @@
+#include "anim.h"
+#include "frame.h"
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "batch.h"
+#include "boot.h"
+#include "memmap.h"
+#include "pc.h"
+#include "sched.h"
+#include "think.h"
+#include "bench.h"
+
+#ifdef BENCH
+
+// Script entries hold a button mask for a number of ticks. The whole script
+// repeats BENCH_REPEAT times, moving, rotating and dropping pieces so every
+// handler sees line clears, rotations and full redraws. Presses are timed
+// in the first half only; the second half times the decision and thinking,
+// which run in the main loop and would otherwise delay the flushes timed.
+#define BENCH_REPEAT 200
+#define BENCH_FLUSH_REPEAT (BENCH_REPEAT / 2)
+
+typedef struct
+{
+    unsigned char input;
+    unsigned char ticks;
+} tBenchStep;
+
+static const tBenchStep script[] =
+{
+    { INPUT_R, 25 }, { 0, 5 },
+    { INPUT_RR, 3 }, { 0, 3 },
+    { INPUT_L, 45 }, { 0, 5 },
+    { INPUT_U, 10 }, { 0, 2 },
+    { INPUT_D, 1 }, { 0, 20 },
+    { INPUT_RR, 3 }, { 0, 3 },
+    { INPUT_RR, 3 }, { 0, 3 },
+    { INPUT_R, 12 }, { 0, 5 },
+    { INPUT_D, 1 }, { 0, 150 }
+};
+
+#define BENCH_STEPS (sizeof(script) / sizeof(script[0]))
+
+// Semihosting operations and exit reasons
+#define SYS_WRITE0 0x04
+#define SYS_EXIT   0x18
+#define ADP_Stopped_ApplicationExit   0x20026
+#define ADP_Stopped_RunTimeErrorUnknown 0x20023
+
+tBenchStats benchStats;
+
+static unsigned long step = 0;
+static unsigned long stepTicks = 0;
+static unsigned long repeat = 0;
+static int lastInput = 0;
+
+// The press being timed, one at a time. The script leaves a few ticks
+// between presses, so one is rarely still waiting when the next comes.
+#define PROBE_NONE  0
+#define PROBE_STEP  1 // Waiting for the game task to step its tick
+#define PROBE_FLUSH 2 // Waiting for the display to show the change
+static int probeStage = PROBE_NONE;
+static unsigned long probeIndex; // Input queue entry of the press
+static unsigned long probeStart;
+static int probeButton;
+static int probeClear;
+
+// Traps to the host with the operation in r0 and the argument in r1, in
+// semihost.asm
+extern void Semihost(int operation, unsigned long argument);
+
+// Starts timing a press sampled into input queue entry index
+static void Probe(unsigned long index, int input)
+{
+    int edges = (input & ~lastInput & ~INPUT_RR) | (~input & lastInput & INPUT_RR);
+    lastInput = input;
+    if(!edges)
+    {
+        return;
+    }
+
+    if(probeStage != PROBE_NONE)
+    {
+        benchStats.overtaken++;
+    }
+    probeStage = PROBE_STEP;
+    probeIndex = index;
+    probeStart = SchedTimestamp();
+    probeButton = 0;
+    while(!(edges & (1 << probeButton)))
+    {
+        probeButton++;
+    }
+    probeClear = AnimActive();
+}
+
+// Next scripted input mask for input queue entry index, 0 once the script
+// has finished. Called from Timer0IntHandler.
+int BenchInput(unsigned long index)
+{
+    if(repeat == BENCH_REPEAT)
+    {
+        Probe(index, 0);
+        return 0;
+    }
+
+    int input = script[step].input;
+    if(repeat < BENCH_FLUSH_REPEAT)
+    {
+        Probe(index, input);
+    }
+    benchStats.ticks++;
+    if(++stepTicks == script[step].ticks)
+    {
+        stepTicks = 0;
+        if(++step == BENCH_STEPS)
+        {
+            step = 0;
+            repeat++;
+        }
+    }
+
+    return input;
+}
+
+int BenchDone(void)
+{
+    return repeat == BENCH_REPEAT;
+}
+
+// Called from Timer0IntHandler with its own cost
+void BenchTimer(unsigned long cycles)
+{
+    if(cycles > benchStats.timerWcet)
+    {
+        benchStats.timerWcet = cycles;
+    }
+}
+
+// Called by the game task once it has stepped input queue entry index
+void BenchStepped(unsigned long index, int changed)
+{
+    if(probeStage != PROBE_STEP || index != probeIndex)
+    {
+        return;
+    }
+
+    if(changed)
+    {
+        probeStage = PROBE_FLUSH;
+    }
+    else
+    {
+        benchStats.unchanged++;
+        probeStage = PROBE_NONE;
+    }
+}
+
+// Called after each display flush with the bytes it sent
+void BenchFlushed(unsigned long bytes)
+{
+    if(probeStage != PROBE_FLUSH || !bytes)
+    {
+        return;
+    }
+    probeStage = PROBE_NONE;
+
+    unsigned long cycles = SchedElapsed(probeStart, SchedTimestamp());
+    int situation = probeClear ? BENCH_CLEAR : bytes >= FRAME_BYTES / 2 ? BENCH_REDRAW : BENCH_IDLE;
+    tBenchFlush *flush = &benchStats.flush[probeButton][situation];
+
+    flush->count++;
+    flush->total += cycles;
+    if(cycles > flush->worst)
+    {
+        flush->worst = cycles;
+    }
+
+    unsigned long ticks = cycles / BENCH_TICK_CYCLES;
+    flush->buckets[ticks < 3 ? ticks : ticks < 5 ? 3 : ticks < 9 ? 4 : 5]++;
+}
+
+// Placements kept per decision, more than any piece has on an open board
+#define BENCH_PLACEMENTS 64
+
+static tPlacement placements[BENCH_PLACEMENTS];
+static unsigned long decidedLocks = ~0UL;
+
+// Times the decision a computer player would make for each new piece, the
+// placement search then scoring every result. Runs outside the tasks so it
+// does not count against the game budget. The think arena is shared, so it
+// is only started when no computer is searching in it.
+void BenchDecide(tGame *game, int think)
+{
+    // Waits for the decision phase and the last press to be shown
+    if(repeat < BENCH_FLUSH_REPEAT || probeStage != PROBE_NONE)
+    {
+        return;
+    }
+    if(game->shape < 0 || game->locks == decidedLocks)
+    {
+        return;
+    }
+    decidedLocks = game->locks;
+
+    unsigned long start = SchedTimestamp();
+    int count = PlaceFind(game, game->shape, game->orientation, game->locationX, game->locationY,
+                          placements, BENCH_PLACEMENTS);
+    EvalChoose(game, game->shape, placements, count < BENCH_PLACEMENTS ? count : BENCH_PLACEMENTS);
+    unsigned long cycles = SchedElapsed(start, SchedTimestamp());
+
+    if(cycles > benchStats.decideWcet)
+    {
+        benchStats.decideWcet = cycles;
+    }
+
+    // Deepen the computer's search on the same piece in idle time, to see
+    // how far it gets before the script moves on
+    if(think)
+    {
+        ThinkStart(game);
+    }
+}
+
+// Perfect clear problems on an empty board, three solved in two lines and
+// one searched out without a solution
+#define BENCH_PC_PROBLEMS 4
+#define BENCH_PC_PIECES 7
+
+static const unsigned char pcQueues[BENCH_PC_PROBLEMS][BENCH_PC_PIECES] =
+{
+    { S_O, S_I, S_J, S_I, S_J, S_O, S_L },
+    { S_I, S_L, S_L, S_L, S_J, S_I, S_I },
+    { S_L, S_L, S_O, S_J, S_J, S_L, S_L },
+    { S_J, S_L, S_O, S_I, S_S, S_Z, S_T },
+};
+
+static tGame pcGame;
+static tPcMove pcSolution[BENCH_PC_PIECES];
+
+// Worst cycles to solve one of the problems
+static unsigned long BenchPc(void)
+{
+    unsigned long worst = 0;
+    int i;
+    for(i = 0; i < BENCH_PC_PROBLEMS; i++)
+    {
+        GameInit(&pcGame, 1);
+
+        unsigned long start = SchedTimestamp();
+        PcSolve(&pcGame, pcQueues[i], BENCH_PC_PIECES, pcSolution);
+        unsigned long cycles = SchedElapsed(start, SchedTimestamp());
+
+        if(cycles > worst)
+        {
+            worst = cycles;
+        }
+    }
+    return worst;
+}
+
+// Batch steps timed, each placing a piece in every game
+#define BENCH_BATCH_STEPS 50
+
+static tBatch batch;
+static unsigned char batchActions[BATCH_MAX];
+static unsigned char batchLines[BATCH_MAX];
+static unsigned char batchDone[BATCH_MAX];
+
+// Average cycles per game step of a full batch, with actions spread over
+// every column and orientation
+static unsigned long BenchBatch(void)
+{
+    BatchInit(&batch, BATCH_MAX, 1);
+
+    unsigned long start = SchedTimestamp();
+    int step, i;
+    for(step = 0; step < BENCH_BATCH_STEPS; step++)
+    {
+        for(i = 0; i < BATCH_MAX; i++)
+        {
+            batchActions[i] = (step * 7 + i * 13) % BATCH_ACTIONS;
+        }
+        BatchStep(&batch, batchActions, batchLines, batchDone);
+    }
+    unsigned long cycles = SchedElapsed(start, SchedTimestamp());
+
+    return cycles / (BENCH_BATCH_STEPS * BATCH_MAX);
+}
+
+static char report[128];
+
+static char *AppendString(char *out, const char *text)
+{
+    while(*text)
+    {
+        *out++ = *text++;
+    }
+    *out++ = ' ';
+    return out;
+}
+
+static char *AppendNumber(char *out, unsigned long value)
+{
+    char digits[10];
+    int count = 0;
+    do
+    {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while(value);
+    while(count)
+    {
+        *out++ = digits[--count];
+    }
+    *out++ = ' ';
+    return out;
+}
+
+static void Print(char *out)
+{
+    out[-1] = '\n'; // Over the last separator
+    *out = '\0';
+    Semihost(SYS_WRITE0, (unsigned long)report);
+}
+
+// Prints one "name cycles" line and returns 1 if over budget
+static int Report(const char *name, unsigned long cycles, unsigned long budget)
+{
+    char *out = AppendString(report, name);
+    out = AppendNumber(out, cycles);
+    Print(out);
+    return cycles > budget;
+}
+
+static const char *const buttonNames[BENCH_BUTTONS] = { "D", "U", "L", "R", "RR" };
+static const char *const situationNames[BENCH_SITUATIONS] = { "idle", "clear", "redraw" };
+
+// Prints "flush button situation count mean worst" then the histogram
+// for every button and situation seen, and returns the worst of them all
+static unsigned long ReportFlush(void)
+{
+    unsigned long worst = 0;
+    int button, situation, i;
+    for(button = 0; button < BENCH_BUTTONS; button++)
+    {
+        for(situation = 0; situation < BENCH_SITUATIONS; situation++)
+        {
+            tBenchFlush *flush = &benchStats.flush[button][situation];
+            if(!flush->count)
+            {
+                continue;
+            }
+
+            char *out = AppendString(report, "flush");
+            out = AppendString(out, buttonNames[button]);
+            out = AppendString(out, situationNames[situation]);
+            out = AppendNumber(out, flush->count);
+            out = AppendNumber(out, flush->total / flush->count);
+            out = AppendNumber(out, flush->worst);
+            for(i = 0; i < BENCH_FLUSH_BUCKETS; i++)
+            {
+                out = AppendNumber(out, flush->buckets[i]);
+            }
+            Print(out);
+
+            if(flush->worst > worst)
+            {
+                worst = flush->worst;
+            }
+        }
+    }
+    return worst;
+}
+
+// Runs each deep call path on its own and reports the stack it reached,
+// from the top, against the usable stack above the guard. The thinking
+// covers the placement search and the Expand to GameStep chain.
+static int BenchStack(void)
+{
+    int over = 0;
+
+    GameInit(&pcGame, 1);
+    GameStep(&pcGame, 0); // Deal a piece
+    MemRepaint();
+    PlaceFind(&pcGame, pcGame.shape, pcGame.orientation, pcGame.locationX, pcGame.locationY,
+              placements, BENCH_PLACEMENTS);
+    over |= Report("stack-place", MemDepth(), memStats.stackSize);
+
+    MemRepaint();
+    ThinkStart(&pcGame);
+    while(ThinkSlice(thinkSlice))
+    {
+    }
+    over |= Report("stack-think", MemDepth(), memStats.stackSize);
+
+    GameInit(&pcGame, 1);
+    MemRepaint();
+    PcSolve(&pcGame, pcQueues[0], BENCH_PC_PIECES, pcSolution);
+    over |= Report("stack-pc", MemDepth(), memStats.stackSize);
+
+    return over;
+}
+
+// Reports the worst case of each handler and exits, failing if any went
+// over its budget. Takes the scheduler slots of the game, audio and render
+// tasks.
+void BenchFinish(int game, int audio, int render)
+{
+    int over = 0;
+    over |= Report("timer", benchStats.timerWcet, BENCH_BUDGET_TIMER);
+    over |= Report("game", schedTasks[game].wcet, BENCH_BUDGET_GAME);
+    over |= Report("audio", schedTasks[audio].wcet, BENCH_BUDGET_AUDIO);
+    over |= Report("render", schedTasks[render].wcet, BENCH_BUDGET_RENDER);
+    over |= Report("decide", benchStats.decideWcet, BENCH_BUDGET_DECIDE);
+    over |= Report("pc", BenchPc(), BENCH_BUDGET_PC);
+    over |= BenchStack();
+    over |= Report("batch", BenchBatch(), BENCH_BUDGET_BATCH);
+    over |= Report("boot", bootStats.at[BOOT_PLAYABLE], BENCH_BUDGET_BOOT);
+    over |= Report("flush", ReportFlush(), BENCH_BUDGET_FLUSH);
+    over |= Report("think", thinkStats.sliceWcet, BENCH_BUDGET_THINK);
+
+    // Depth reached per piece, reported only
+    int depth;
+    for(depth = 0; depth <= THINK_DEPTHS; depth++)
+    {
+        char *out = AppendString(report, "depth");
+        out = AppendNumber(out, depth);
+        out = AppendNumber(out, thinkStats.depths[depth]);
+        Print(out);
+    }
+
+    Semihost(SYS_EXIT, over ? ADP_Stopped_RunTimeErrorUnknown : ADP_Stopped_ApplicationExit);
+    while(1)
+    {
+    }
+}
+
+#endif
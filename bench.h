@@ -0,0 +1,75 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include "game.h"
+
+// Benchmark build, the Bench configuration, which adds --define=BENCH.
+// Buttons are replaced by a fixed script and the worst case cost of each
+// per-tick handler is checked against a budget when the script ends.
+// BenchRun/benchrun.sh runs it under QEMU (lm3s6965evb) with -icount and
+// -semihosting, where a cycle is about one guest instruction, and checks
+// the report as well as the exit status.
+//
+// In the first half of the script each press (the release for RR, which
+// rotates on release) is also timed from the timer tick that sampled it to
+// the return of the first FlushFrame after the game step it changed, and
+// the distributions reported per button and per situation. This is the
+// firmware's share of the delay only: the scripted buttons skip the GPIO
+// pins, QEMU's SSI sends each word at once where the board waits on the
+// bus, and the panel showing the pixels is not timed. Presses that change
+// nothing are not timed. The decision and think benchmarks run in the
+// second half, outside every timed press.
+
+// Budgets in cycles, out of the 80000 in one tick at 8 MHz
+#define BENCH_BUDGET_TIMER  800    // Timer0IntHandler, every tick
+#define BENCH_BUDGET_GAME   20000  // GameTask, one tick of input
+#define BENCH_BUDGET_AUDIO  4000   // AudioTask, every tick
+#define BENCH_BUDGET_RENDER 400000 // RenderTask, may run once per 5 ticks
+#define BENCH_BUDGET_DECIDE 80000  // Placement search and scoring, per piece
+#define BENCH_BUDGET_PC     8000000 // Perfect clear search, per problem
+#define BENCH_BUDGET_BATCH  1500    // Batch environment, per game step
+#define BENCH_BUDGET_BOOT   4000000 // From the clock set up to the first playable frame
+#define BENCH_BUDGET_FLUSH  480000  // Worst sampled press to flushed frame, six ticks
+#define BENCH_BUDGET_THINK  60000   // Anytime search slice, with one PlaceFind that cannot be split
+
+#define BENCH_TICK_CYCLES 80000
+
+// Press to flush times are kept per button, in input mask bit order, and per situation
+#define BENCH_BUTTONS 5
+#define BENCH_IDLE   0 // Nothing else going on
+#define BENCH_CLEAR  1 // Pressed during the line clear animation
+#define BENCH_REDRAW 2 // Shown by a flush of at least half the frame
+#define BENCH_SITUATIONS 3
+
+// Histogram buckets: under a tick, 1, 2, 3-4, 5-8 and 9 or more ticks
+#define BENCH_FLUSH_BUCKETS 6
+
+typedef struct
+{
+    unsigned long count;
+    unsigned long total; // Cycles, for the mean
+    unsigned long worst;
+    unsigned long buckets[BENCH_FLUSH_BUCKETS];
+} tBenchFlush;
+
+typedef struct
+{
+    unsigned long ticks;     // Scripted ticks played so far
+    unsigned long timerWcet; // Worst Timer0IntHandler cycles
+    unsigned long decideWcet; // Worst BenchDecide cycles
+    tBenchFlush flush[BENCH_BUTTONS][BENCH_SITUATIONS];
+    unsigned long unchanged;  // Presses the game step ignored
+    unsigned long overtaken;  // Presses still waiting to be shown at the next one
+} tBenchStats;
+
+extern tBenchStats benchStats;
+
+extern int BenchInput(unsigned long index);
+extern void BenchStepped(unsigned long index, int changed);
+extern void BenchFlushed(unsigned long bytes);
+extern int BenchDone(void);
+extern void BenchTimer(unsigned long cycles);
+extern void BenchDecide(tGame *game, int think);
+extern void BenchFinish(int game, int audio, int render);
+
+#endif
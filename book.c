@@ -0,0 +1,109 @@
+#include "game.h"
+#include "sched.h"
+#include "book.h"
+#include "bookdata.h"
+
+// Keys are the nine height steps, each offset into 0 to 6 and taken as
+// base 7 digits, then times 49 plus the current and next shape as base 7
+// digits: under 2^31 for ten columns. The bucket of a key picks a seed that
+// sends every key in the bucket to its own slot, and the slot holds the key
+// so a board missing from the book is told apart.
+
+#define BOOK_STEPS (2 * BOOK_MAX_STEP + 1)
+
+tBookStats bookStats;
+
+static void Saved(void)
+{
+    if(bookStats.searches)
+    {
+        unsigned long long search = (unsigned long long)bookStats.searchCycles * bookStats.hits / bookStats.searches;
+        bookStats.saved = search > bookStats.lookupCycles ? (unsigned long)(search - bookStats.lookupCycles) : 0;
+    }
+}
+
+// Returns the key of the board with its current and next piece, or
+// BOOK_NO_KEY if the stack is too tall, rough or holed for the book
+unsigned long BookKey(tGame *game)
+{
+    if(game->shape < 0 || game->nextShape < 0)
+    {
+        return BOOK_NO_KEY;
+    }
+
+    unsigned long key = 0;
+    int i;
+    for(i = 0; i < GAME_COLS; i++)
+    {
+        if(game->heights[i] > BOOK_MAX_HEIGHT || game->holes[i])
+        {
+            return BOOK_NO_KEY;
+        }
+        if(i)
+        {
+            int step = game->heights[i] - game->heights[i - 1];
+            if(step < -BOOK_MAX_STEP || step > BOOK_MAX_STEP)
+            {
+                return BOOK_NO_KEY;
+            }
+            key = key * BOOK_STEPS + step + BOOK_MAX_STEP;
+        }
+    }
+
+    return (key * 7 + game->shape) * 7 + game->nextShape;
+}
+
+// Shared with BookGen, which picks the seeds
+unsigned long BookHash(unsigned long key, unsigned long seed)
+{
+    key ^= seed * 0x9E3779B9UL;
+    key &= 0xFFFFFFFFUL;
+    key ^= key >> 16;
+    key = (key * 0x85EBCA6BUL) & 0xFFFFFFFFUL;
+    key ^= key >> 13;
+    key = (key * 0xC2B2AE35UL) & 0xFFFFFFFFUL;
+    key ^= key >> 16;
+    return key;
+}
+
+// Looks the board up. On a hit returns 1 with the orientation and column to
+// drop the current piece straight down from; it fits from the spawn pose.
+int BookLookup(tGame *game, int *orientation, int *x)
+{
+#if BOOK_ENTRIES
+    unsigned long start = SchedTimestamp();
+    int hit = 0;
+
+    unsigned long key = BookKey(game);
+    if(key != BOOK_NO_KEY)
+    {
+        int bucket = BookHash(key, 0) % BOOK_BUCKETS;
+        int slot = BookHash(key, bookSeeds[bucket] + 1UL) % BOOK_ENTRIES;
+        if(bookKeys[slot] == key)
+        {
+            *orientation = bookMoves[slot] >> 4;
+            *x = (bookMoves[slot] & 0xF) - 3;
+            hit = GameFits(game, game->shape, *orientation, *x, game->locationY);
+        }
+    }
+
+    bookStats.lookups++;
+    bookStats.lookupCycles += SchedElapsed(start, SchedTimestamp());
+    if(hit)
+    {
+        bookStats.hits++;
+        Saved();
+    }
+    return hit;
+#else
+    return 0;
+#endif
+}
+
+// Counts the cost of a live search made after a miss
+void BookSearched(unsigned long cycles)
+{
+    bookStats.searches++;
+    bookStats.searchCycles += cycles;
+    Saved();
+}
@@ -0,0 +1,35 @@
+#ifndef __BOOK_H__
+#define __BOOK_H__
+
+#include "game.h"
+
+// Opening book of placements for low stacks without holes. Boards are looked
+// up by the height steps between neighbouring columns with the current and
+// next piece, so the same surface at any height shares an entry. The
+// entries come from BookGen, which plays openings on the host with a two
+// piece search, and sit in flash as a minimal perfect hash table: a lookup
+// is one probe whether it hits or not.
+#define BOOK_MAX_HEIGHT 8 // Tallest column looked up
+#define BOOK_MAX_STEP   3 // Largest height step between neighbours looked up
+#define BOOK_NO_KEY     0xFFFFFFFFUL
+
+// Cycles saved are estimated as hits times the average live search, less
+// the cost of every lookup
+typedef struct
+{
+    unsigned long lookups;
+    unsigned long hits;
+    unsigned long lookupCycles; // Spent on every lookup, hit or miss
+    unsigned long searches;     // Live searches after a miss
+    unsigned long searchCycles;
+    unsigned long saved;        // Estimated cycles saved
+} tBookStats;
+
+extern tBookStats bookStats;
+
+extern unsigned long BookKey(tGame *game);
+extern unsigned long BookHash(unsigned long key, unsigned long seed);
+extern int BookLookup(tGame *game, int *orientation, int *x);
+extern void BookSearched(unsigned long cycles);
+
+#endif
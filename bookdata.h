@@ -0,0 +1,1170 @@
+#ifndef __BOOKDATA_H__
+#define __BOOKDATA_H__
+
+// Generated by BookGen from 20000 games of 15 pieces, do not edit. The
+// entries cover 16.7% of the placements in those openings. Keys and moves
+// are laid out as in book.c, moves as orientation << 4 | (x + 3).
+
+#if GAME_COLS == 10
+
+#define BOOK_ENTRIES 4096
+#define BOOK_BUCKETS 1366
+
+static const unsigned long bookKeys[BOOK_ENTRIES] =
+{
+    0x25480CC5, 0x3B8DD563, 0x4BC44971, 0x3AEFD1C8, 0x387CD39F, 0x3AEFDA0D,
+    0x3AE14842, 0x3B40A418, 0x3B45BBF5, 0x362C1FA6, 0x3D550A35, 0x3AD4EDFA,
+    0x3AEF8F31, 0x29D6FAF4, 0x3AEDCEC2, 0x3D45A713, 0x38D16CB3, 0x3B43B667,
+    0x68A0F893, 0x2A178B4E, 0x2A64BA0A, 0x3CFDA020, 0x3AE1467C, 0x3AE2FF91,
+    0x2A160AC3, 0x4BC246D7, 0x3AF8890D, 0x2A6DC7F9, 0x3D9DA5F1, 0x3AEF9F21,
+    0x3D3FAE6A, 0x3AF88907, 0x3AE30757, 0x3AE2FF6F, 0x4BB5EE60, 0x2B1D60F0,
+    0x16D9DA58, 0x4BB77096, 0x3B43B684, 0x3AED4B11, 0x4B6C0AA0, 0x3CB3F349,
+    0x3AEDCBB0, 0x3B40A413, 0x3AEDCE39, 0x3D55CF3B, 0x2A62B77E, 0x5BEBE0C2,
+    0x2A62B76E, 0x3AFC17EC, 0x3AE30751, 0x3B43B68C, 0x3AEDCCFB, 0x4BC4105C,
+    0x3AF11111, 0x4905DE2C, 0x3B43B672, 0x3B478CA6, 0x3B9BE6E1, 0x3AFC217B,
+    0x3F4C3D9E, 0x2A714C5C, 0x2A663BE8, 0x37C9908D, 0x3AEBF96A, 0x3AED8E57,
+    0x3AEE56DC, 0x3AE13C13, 0x3D5382D6, 0x3AE13DB2, 0x5BEDEDD6, 0x3AFA5DE0,
+    0x3D099B1F, 0x3AD4EE09, 0x4BC3FFDB, 0x29BF9B40, 0x3D554D43, 0x3875E6DF,
+    0x3AEA78BF, 0x4BC23F15, 0x3AD4F895, 0x46F48ACD, 0x3AED4AE6, 0x4BC3FFE0,
+    0x3AF8927F, 0x3AEFC886, 0x2AB92D6C, 0x3AEF99BA, 0x3AEFA8CB, 0x3AEFA18E,
+    0x362011EB, 0x3AEF906F, 0x5CE3DE75, 0x4BD09909, 0x3A8B54D4, 0x3B45D12C,
+    0x3AE3075F, 0x3AE3091B, 0x4BC48331, 0x3AEF0D27, 0x3AEDCBA4, 0x382E0D8A,
+    0x2A62C3D4, 0x3AED4B0E, 0x3B457A09, 0x3AD4F5C7, 0x198AF2F5, 0x2A62F90F,
+    0x37C9A200, 0x3B392B25, 0x3AEFD229, 0x4BC27DEE, 0x3AEF4D7A, 0x3AEF7DCA,
+    0x4E26647C, 0x2C72C186, 0x2A711434, 0x3AED8C9E, 0x4B6A3D9E, 0x3BA6E330,
+    0x3AD4AC5E, 0x4BB5ACAF, 0x3AE30911, 0x3AED8CBB, 0x29BF5AF0, 0x361C96BD,
+    0x3AE34900, 0x3D099B0B, 0x4BB7C1F2, 0x3AEDD777, 0x3B45BD13, 0x4BB7704A,
+    0x3AE13DA1, 0x4BC61679, 0x3B45BCF6, 0x3AEE0F83, 0x4BC3FE8F, 0x3AFA0AE4,
+    0x2A64B9FD, 0x3D554A94, 0x3AFA0AC4, 0x4E81F2A2, 0x3B9D3729, 0x3AEE513F,
+    0x3AEC0AC3, 0x3AEDC66E, 0x2A30289F, 0x4BC44179, 0x3AD4AB14, 0x3AEDD0F5,
+    0x4BC452FE, 0x3AFA6885, 0x3B457A14, 0x3AEDFD9B, 0x4BC3FFC8, 0x3B8DD573,
+    0x3AEDD928, 0x38797E19, 0x2A2D2780, 0x3AEDCCF1, 0x361E4E73, 0x495C41FC,
+    0x3B06EC38, 0x4BC41225, 0x3AD4AC6F, 0x3A9966AF, 0x3AEE1146, 0x3AEFA1DE,
+    0x3AD4AC46, 0x490698AE, 0x3AD4AC6A, 0x3AEDD70A, 0x5BEBEB4F, 0x3B2CAC8F,
+    0x3AEF9F40, 0x37C990A0, 0x37D62019, 0x524CA327, 0x3AE3075E, 0x4DD2060B,
+    0x38CFBBFF, 0x2AAE6850, 0x4BCD033B, 0x3AEDCEC4, 0x0B200D04, 0x2A881603,
+    0x2A62F91A, 0x2A2D24C3, 0x3AEE1156, 0x3AEE115D, 0x3AD4F77F, 0x3AEDD7D8,
+    0x24F1F458, 0x3AD4F5C5, 0x3885CD5B, 0x3AD4AC73, 0x495FC55D, 0x3A940D61,
+    0x2A171976, 0x3B8E1804, 0x2A195DE0, 0x3AE13DA2, 0x3D3C2CBB, 0x27AFD43D,
+    0x3AEDD76F, 0x3A9762B9, 0x3AD4F5C6, 0x3AEDFBEF, 0x4DD20F7D, 0x3B392B04,
+    0x2AC463AD, 0x3B45B8EB, 0x3AD6DF16, 0x3AEDC778, 0x3AD4AE08, 0x4BC4418C,
+    0x3AEFA2D0, 0x3AEE0D2E, 0x3B45BAAF, 0x2A62B77F, 0x2A3028A9, 0x4BC455B0,
+    0x3D554D40, 0x29BFA5CB, 0x3D3C6B9F, 0x3B43B681, 0x2A62F91C, 0x2A664661,
+    0x3AE3074C, 0x3B8DD55F, 0x3AFA8CCD, 0x2A302A64, 0x3AEDCD4C, 0x3883F883,
+    0x2A668C29, 0x4BCECBED, 0x4BC3FE8D, 0x3CFD8ED5, 0x3F650C7D, 0x382C0DCA,
+    0x4BC4496F, 0x3B3AFD62, 0x3F028F46, 0x2E9B6920, 0x3D3C2CA8, 0x3D085367,
+    0x3AEC02DD, 0x3B392B16, 0x382C0B19, 0x5C9880B2, 0x3AEDCD6E, 0x2A2B5C22,
+    0x3B201B95, 0x4ABC23AD, 0x495C40FC, 0x29D6FCC8, 0x4E772CE8, 0x3AEE513D,
+    0x3AEE0FE3, 0x3AEDCBA5, 0x3AEF7DC6, 0x3AEF4D6A, 0x3AEE066D, 0x4BC44AB6,
+    0x5BEBE1A3, 0x3AED8CA7, 0x3AE1469A, 0x3AEDCEA7, 0x3AEDD92D, 0x2A64BBA5,
+    0x3AFA9767, 0x2A2B66BD, 0x3AEDCBA0, 0x5C35B47B, 0x3AED971B, 0x3B45BD0A,
+    0x361E4E53, 0x3A95E0DA, 0x3B40A403, 0x3AE17E8B, 0x3AEFDB9E, 0x2A195E04,
+    0x495C41E8, 0x37C9908B, 0x361E5902, 0x2A3028AC, 0x3B392C1C, 0x4DD21075,
+    0x3D3C29F7, 0x3AEFD129, 0x3AD4EDEC, 0x3A95E22C, 0x3AEF8F12, 0x3AED4E88,
+    0x4BCD0334, 0x25937A95, 0x2A64BCBE, 0x3AEF4D7D, 0x3AE2FF96, 0x3AEC03D3,
+    0x4905DE46, 0x3AEDC4C9, 0x3AE14855, 0x3AEDC4AF, 0x29C05557, 0x3AEDCD61,
+    0x38DFC818, 0x2E8F1B1E, 0x3AE13D45, 0x36056F5F, 0x3D3E2C73, 0x361E4CFD,
+    0x3D3C6BBC, 0x3AEDCB87, 0x4BC44077, 0x3AEE1057, 0x3AEE52DA, 0x4904506E,
+    0x3B2C9B11, 0x3AF888FC, 0x3AEE5120, 0x2A7B97BC, 0x3AEBF970, 0x3AED4B13,
+    0x2A62FACD, 0x37C9909F, 0x382C8E59, 0x1B4F5409, 0x3AEE5AD5, 0x3CF10F47,
+    0x3B9DFD6B, 0x3AEDFBD6, 0x2A64B9FC, 0x3AEBFD0A, 0x4BC41149, 0x3AEDD0F3,
+    0x2A30A946, 0x2A6DC7EA, 0x3AEDD0AC, 0x3AFA1C2D, 0x4BCECE95, 0x3AF013CB,
+    0x2A178B56, 0x2A302A68, 0x4BC3BD53, 0x3D3C29E7, 0x2DDF2D93, 0x27A38E27,
+    0x3AEE0F7F, 0x4B614247, 0x3AEDCBA8, 0x3B463CC4, 0x3AD4AC51, 0x2A30722D,
+    0x2A30A948, 0x3FBD4E44, 0x2A64BCA6, 0x3AEDC527, 0x37D6218C, 0x4BB5ACC6,
+    0x29BFA5C8, 0x3AEDD7C7, 0x3AEDCB8B, 0x2A64BCC3, 0x3AD4EE0A, 0x361E90F5,
+    0x29D6FCC5, 0x4BC452E2, 0x3AEDCEC1, 0x3B45BCEA, 0x2A665517, 0x5C9A85CA,
+    0x4BC3BF87, 0x3AEFA1E8, 0x3AEFDA0E, 0x3B375F61, 0x3AEC49A9, 0x3AD843F9,
+    0x3B460579, 0x3AFA1C43, 0x37C9908C, 0x3AEDCCFE, 0x4BD04F99, 0x2A195E06,
+    0x3DA0AB15, 0x29BF9CA7, 0x3B8DD560, 0x3AEDCF9D, 0x3A95CE33, 0x3D558D36,
+    0x4BC44423, 0x3AD6E9A2, 0x3AEE0674, 0x3AD4F792, 0x3B40AE9E, 0x495C41DB,
+    0x3AD56EB0, 0x4BC0B3FA, 0x4BC40299, 0x2A30322D, 0x2A62F91D, 0x3AEF96F8,
+    0x2A6DC7DD, 0x3AD88D76, 0x3D3C6B9E, 0x29C15ED9, 0x2AB92D7A, 0x3AFA1557,
+    0x2AC3E043, 0x3AECCF4D, 0x2A668C2D, 0x3AEDFBDB, 0x5BEBE1B9, 0x3AEDA0CF,
+    0x3AE1467A, 0x4BC5CB45, 0x4905E7C5, 0x3B45C637, 0x3B45BBF8, 0x4905F683,
+    0x3620234D, 0x3846AD84, 0x2A663BF5, 0x3FBAF48E, 0x3D3E2C89, 0x3AEDCBA3,
+    0x3B45CF6C, 0x3B45CFCD, 0x3AEDCD4B, 0x4B60D33A, 0x29BF9B45, 0x3CFD8EC8,
+    0x3877B241, 0x3D3AA037, 0x4B5F8186, 0x4BC23F18, 0x4BC246E1, 0x3AEDC4CF,
+    0x3D3E2C8D, 0x29BFDF96, 0x3B45CD2B, 0x495C40E6, 0x3AFA5444, 0x3AEDCCEC,
+    0x3AFA1C55, 0x3AE2FF87, 0x3AEDC4C8, 0x3AE17EF6, 0x3AEFA352, 0x4BDCE872,
+    0x3AD4EE0B, 0x2A62FACA, 0x29BF9D10, 0x16D9991C, 0x3AEDCB98, 0x3AEF8F10,
+    0x3B43B666, 0x4BC410D3, 0x495728D8, 0x3AEDFBD8, 0x3AE2C861, 0x3AED4CAC,
+    0x2A663BEB, 0x03B475BC, 0x37C99086, 0x3AED9634, 0x4BC40955, 0x2A195DE3,
+    0x36056F6E, 0x37C990A1, 0x38793DB6, 0x3C4DAE94, 0x2A62F91E, 0x3A3E2201,
+    0x2A64BA0D, 0x3AFA9764, 0x3B4539A9, 0x3A95CE11, 0x25077C78, 0x33C30EC0,
+    0x361E58FA, 0x382C1C8D, 0x36201B0E, 0x2AC3E2FE, 0x2A0AFA6C, 0x3AED9EF2,
+    0x3B392C08, 0x3AD4AE11, 0x3A894507, 0x3AD56EB3, 0x3605773B, 0x3AEDCFB6,
+    0x3AE17F64, 0x4BCECE92, 0x4BC23E00, 0x3AFBE908, 0x29D6E9A5, 0x3AEF56B7,
+    0x4B614262, 0x3AEDCE4D, 0x2A64B9F3, 0x4BC3FFE3, 0x3AFA5601, 0x4E2B871F,
+    0x2AC3E313, 0x37D7B62D, 0x3AEFDA06, 0x3AED4CBF, 0x37C99094, 0x2A179C6A,
+    0x3AEDCB86, 0x3AEDC4B3, 0x3B91215B, 0x2A30720A, 0x3AEDC4A8, 0x2A6301B1,
+    0x2A194D92, 0x382E1039, 0x0AC643C4, 0x3B45BBF6, 0x2A6DC7E8, 0x4BD0923E,
+    0x4BC796FE, 0x3AEFD321, 0x4BC3C7C7, 0x3AEDCF95, 0x3AEFD0CE, 0x3B45BFA8,
+    0x3D45A71E, 0x2A64BBAF, 0x16D997D6, 0x5BEBEB39, 0x3AEDCF38, 0x4B52F093,
+    0x2EE68547, 0x3B45CE7A, 0x4BC27DEA, 0x2A2B6699, 0x3AEC49A5, 0x3AEE5132,
+    0x3AEE0F94, 0x4C0D6C9D, 0x2A17DE5E, 0x361E4FA5, 0x4BC40A75, 0x5C9878DE,
+    0x3AFB5C8A, 0x2ABAE68B, 0x4958CD88, 0x36056F7F, 0x4BC3FFDA, 0x387CCB36,
+    0x3A95D661, 0x29BF9B42, 0x3AED8C95, 0x361ED309, 0x3AE69FED, 0x3B524E0B,
+    0x3AE0FBB8, 0x3A8B122E, 0x4B52F09E, 0x382E1805, 0x3AEE1910, 0x3AD4F7A8,
+    0x2AB92594, 0x27BC2345, 0x3AEFD8FD, 0x0875E2EE, 0x4B52F08C, 0x3AEDCB93,
+    0x3AEC03D5, 0x3AEDCE43, 0x33C30EBC, 0x3AF8890A, 0x3AE38018, 0x387B3EEB,
+    0x3B08BB86, 0x3CF115B7, 0x3AEE1FAE, 0x3B45386D, 0x3D554D38, 0x3AEF91CA,
+    0x3AED4AFE, 0x4E1F2D2F, 0x3AED947F, 0x3AE30754, 0x3B45CD14, 0x2A3028A4,
+    0x361E4FAF, 0x3AEDCCE0, 0x2A64BBCC, 0x4E776F15, 0x3AEDD080, 0x387CCA66,
+    0x3AD4F892, 0x3B92AB4A, 0x3AEFD9ED, 0x2A710A9D, 0x3AED4B05, 0x361E5904,
+    0x4B15E5E2, 0x3FBB792A, 0x37D7A20F, 0x3AF888F6, 0x3AEFDBB4, 0x4BC3DA2A,
+    0x3AEBF95C, 0x3AD4F7A1, 0x4BB943CE, 0x3AEDCB9E, 0x3AEDCF34, 0x4BC4798D,
+    0x3AEDD1ED, 0x3AFBE90C, 0x3AEDD787, 0x3D45A711, 0x3B45BCFE, 0x3AD4AE0F,
+    0x2A64C47D, 0x4905E51C, 0x4BC44186, 0x3AED964E, 0x3AEBF96F, 0x3AEF8F1C,
+    0x29D8FD98, 0x3AE13D46, 0x2AC780B5, 0x495C5202, 0x4BCE8CFB, 0x2AAE684C,
+    0x2AD1F1DD, 0x4BC3C7C6, 0x3AEE115C, 0x37D62AA5, 0x37C99081, 0x2AC76F3D,
+    0x2A663BE5, 0x3AEBFC7A, 0x4BB776D1, 0x2A307214, 0x4BCECE93, 0x3AED4AF0,
+    0x3AFA5EE7, 0x29D8FD75, 0x3AEDC4BF, 0x27BC6CA6, 0x3AD4AB11, 0x3AEDCEA9,
+    0x2A62B77B, 0x3AEDD78F, 0x3AD4AC45, 0x4BC3C757, 0x3AEF9F3C, 0x4C676DC0,
+    0x37E0E808, 0x38CDD45C, 0x3AD4AC75, 0x2A663BED, 0x3AEE0D34, 0x3AED9F00,
+    0x2A30A942, 0x2A195E08, 0x4BC23EFC, 0x3D3FAE63, 0x3AEF9069, 0x3AEBF964,
+    0x3AFA974C, 0x3AEF9F22, 0x3AFA56F4, 0x3AEBF96B, 0x3AEE0673, 0x4BC5947D,
+    0x3F028F47, 0x3D3E2C78, 0x3AEE4D9D, 0x29BF193D, 0x3AEDCCF2, 0x3AEFDB5B,
+    0x3AD4EE0E, 0x4BC40909, 0x3D554D3E, 0x4ABC23A0, 0x3AEF8F33, 0x4CBEDA98,
+    0x4968DABA, 0x4BC44171, 0x3AEDCD66, 0x3AE13BEF, 0x3AED9627, 0x361E9109,
+    0x3B8F57A0, 0x3CA5A92F, 0x4BC4088F, 0x3AEDCE33, 0x361DCC60, 0x5C96ED64,
+    0x37C99098, 0x3AE13DB4, 0x2A195DF3, 0x2A2F2A0A, 0x3B06A6BD, 0x361E58E4,
+    0x3AEBF958, 0x38DBF8A4, 0x4BC41143, 0x3AD4EE0C, 0x3D4A7D23, 0x4BC40973,
+    0x4BB7B857, 0x3B5284B1, 0x3B92EDF5, 0x3AED8C9F, 0x3AE1467E, 0x3A95D74C,
+    0x3AEC0AC2, 0x5C98B8C8, 0x3AEDD82E, 0x393428EB, 0x3AEDCDDB, 0x3AE17EF4,
+    0x3875E6D6, 0x3B45BD03, 0x4BB737BE, 0x3B508B75, 0x33082369, 0x3B45BD10,
+    0x3D3CAAA3, 0x4BC4418F, 0x3AEE191E, 0x3AEDCE53, 0x4BDCDF25, 0x3AFA55FE,
+    0x3AEDCD4A, 0x3B45BACE, 0x295B14FD, 0x33B48370, 0x4BC4115A, 0x2A2D24C5,
+    0x3D3E2C75, 0x2A6301BD, 0x3AEDCB99, 0x18DCC7C1, 0x362020B8, 0x4DD1FE26,
+    0x59DA8CF7, 0x3AEDC4C4, 0x387B3EEF, 0x4BB56AFD, 0x3AFA0AC7, 0x3AD4AE0D,
+    0x4E2BD07A, 0x3AEDD78B, 0x3AE1805F, 0x2B04922A, 0x2ABCAA1A, 0x3AEE066E,
+    0x3AEBF96D, 0x3B2CAE38, 0x2A302A6A, 0x3D53C226, 0x3AD6DF1C, 0x4B1413BB,
+    0x3AEDCE4A, 0x3AD4AAF2, 0x2A242DB7, 0x4BC246C5, 0x3AEBFB20, 0x3AED98D3,
+    0x2A64B9E7, 0x3AFA71F4, 0x3B45384D, 0x4CBF1993, 0x4BCECEB2, 0x3AEDCE36,
+    0x3D3C6BB1, 0x3B43B689, 0x3AD4AC52, 0x2AD40F42, 0x3AE13DB3, 0x495C41EC,
+    0x3AD4B6F3, 0x2A179245, 0x3A95D650, 0x2A2D5EA9, 0x3CFD8EBC, 0x3AEFD22D,
+    0x3AEF99BC, 0x3D3C6B8E, 0x2A2B5C1E, 0x3A9618E9, 0x3AEDCB9F, 0x2A664D40,
+    0x3AEDCD52, 0x3AEFA1E5, 0x38860EF2, 0x2A6DC7E0, 0x3B453861, 0x2A62B774,
+    0x36056F7B, 0x4B74CA9F, 0x2AD1F390, 0x4ABC238D, 0x3D554D3A, 0x27B04C91,
+    0x3AEE0659, 0x3AEDCD03, 0x3B4CF1F3, 0x3AED8C96, 0x37D7A219, 0x29D6FCD1,
+    0x4E2BBF23, 0x37C99091, 0x3AD4AC4A, 0x1B44D1D1, 0x3FA2675A, 0x4BC246E9,
+    0x361DCC5E, 0x444E35A0, 0x4BC3BF91, 0x3D099B1E, 0x3AD4AB13, 0x3AE1415C,
+    0x3AEDCD51, 0x5A30B15D, 0x29BFDB9A, 0x3AEFA1DA, 0x3A940AA1, 0x4BC3FFC6,
+    0x29BF9B50, 0x3B45BD06, 0x3D3E2F32, 0x4BC068C3, 0x3AEE5AB6, 0x25464248,
+    0x4BC3C75F, 0x3F028F45, 0x495DD11E, 0x4E20FAE2, 0x38860DBE, 0x3AED4AF2,
+    0x49A45A48, 0x3875E6F6, 0x3AEDCB9A, 0x29A6853E, 0x3AEDD91E, 0x3AED8C9A,
+    0x4BC25058, 0x3AE13C03, 0x2A64CC4D, 0x3B45B8FE, 0x3AEDCE4E, 0x29D6E9A1,
+    0x3AFA1C50, 0x29D6FAF3, 0x36205B84, 0x3AEF59B8, 0x3AEDC67C, 0x3AEDCB88,
+    0x3AE2C850, 0x3A940A8F, 0x38797FBB, 0x3AE3074A, 0x2A710AA0, 0x4BB7818E,
+    0x495C41FF, 0x4B614266, 0x3AEDD774, 0x38E533F1, 0x3AEC42D2, 0x389EADA5,
+    0x29BF9B44, 0x3AD52606, 0x3AED4B0A, 0x3AEE1924, 0x3AEC1536, 0x3AEF906B,
+    0x3B392B14, 0x3AEF9B50, 0x3AEDD93A, 0x3A95E92F, 0x3AEF96F6, 0x38863DF9,
+    0x4BC23F02, 0x4B5F8190, 0x0B273C50, 0x3AEF5818, 0x3AED8F63, 0x29D6FAFC,
+    0x382E0D73, 0x6061DEB8, 0x3AED4CBE, 0x3DA0D742, 0x3AD4F878, 0x3AEE106A,
+    0x3AEF9F26, 0x3AEDC4B1, 0x361E9A27, 0x3AD4AC69, 0x2A663F88, 0x37C9907C,
+    0x3D3C2CA9, 0x3AD4AB05, 0x3D3FAE6E, 0x4905DE2F, 0x3AEDC4BA, 0x3AD4F78E,
+    0x4BB73EAA, 0x2E90DBF6, 0x3AEE5134, 0x3AD4AB08, 0x2A663BEC, 0x0875E2D5,
+    0x4B5F3E6E, 0x2A17946E, 0x3AEFD9E3, 0x3AE2FF85, 0x38354683, 0x3875E6E0,
+    0x3AEC044A, 0x3B8E1EE6, 0x3AEBF96E, 0x3AE2FF8E, 0x3AE13DB9, 0x3608C38F,
+    0x3B43B671, 0x3846AD81, 0x3AEF9F23, 0x2ABAF8D7, 0x3AEC42D6, 0x3AE2FF8A,
+    0x4BDB5E3F, 0x37C99096, 0x2A2465AF, 0x3AD4EDFD, 0x3B443AB5, 0x361E4E69,
+    0x3AEDE117, 0x3AEFA1E7, 0x3B392C12, 0x173E20C0, 0x3AEDCCFC, 0x3AEDCD68,
+    0x25937A9A, 0x4BC61597, 0x3AD4AAEE, 0x2A663BF2, 0x3AF89396, 0x2AC764B9,
+    0x37D62AC3, 0x3AE2FF98, 0x4BC23F09, 0x3AEDCB9C, 0x2A2D2783, 0x3D600941,
+    0x3B06E54F, 0x4905DD3E, 0x361E9A84, 0x2A25AE50, 0x3D3C29E8, 0x361F9847,
+    0x29A68537, 0x382C4DB5, 0x3AEF9F41, 0x4C0F6F0D, 0x3AA2A0CF, 0x2A2B5C23,
+    0x3AD4EDEE, 0x3AED9637, 0x3AED97A1, 0x3AE311D4, 0x3AEE0669, 0x3AEDDA26,
+    0x3DAB75B2, 0x3B457A1A, 0x2A302896, 0x37C99097, 0x3AD4AB15, 0x361E5903,
+    0x3AEF4F40, 0x2A664571, 0x3AFA8CD0, 0x4BC246D6, 0x387B3EE6, 0x4B5F8952,
+    0x16D9991E, 0x3AEE191C, 0x3B392B13, 0x2A2D24C1, 0x3AD4AC5C, 0x361380E0,
+    0x495C40AA, 0x3A95CE37, 0x3AEF9FA9, 0x4BC3CFA2, 0x3A958DEC, 0x3CFD8EC2,
+    0x3CFD8ECA, 0x2A664D33, 0x37E0DD9B, 0x3AED4B12, 0x2A886BAA, 0x3AFA154F,
+    0x2A6301B2, 0x3A4C3D33, 0x37D62015, 0x3AEE51EF, 0x37CE6688, 0x3AEFA2D1,
+    0x2A2B5C1F, 0x29D6E9A2, 0x3B117BF1, 0x3AE30771, 0x3AF194A0, 0x3AE13DB5,
+    0x3AED4CA0, 0x37D62038, 0x3AEDD78D, 0x3B376886, 0x29BF193A, 0x3AEFA3AF,
+    0x4C1DCA0D, 0x29D6FB0F, 0x3AEF7DC4, 0x3AE30A02, 0x3AEBF968, 0x3AEDCCFA,
+    0x3B458478, 0x3AEF57FA, 0x495C41F5, 0x27BC9C59, 0x2A0CCF41, 0x4BC246E6,
+    0x4E81BA0C, 0x4B52AED9, 0x3DAD3944, 0x3C419B6B, 0x2A62FACB, 0x3B457A11,
+    0x3BAA433E, 0x3AEE1006, 0x2A7BD95D, 0x4C0E1EB3, 0x2A7C1B13, 0x2A2D24C4,
+    0x3CF0FDE1, 0x3B45BD01, 0x3AEC0C07, 0x3DABFA60, 0x3D099B2C, 0x3AEDCCFF,
+    0x3AED4CCA, 0x3D557B1E, 0x4E2872CB, 0x3AEBF956, 0x3B45BD12, 0x3D608AE0,
+    0x4C1BFEAE, 0x37C9909E, 0x4BC3FFDE, 0x3AEE0667, 0x3B45BC14, 0x38C52536,
+    0x37C99082, 0x3AEDCBA2, 0x3AEE5122, 0x3B4CF1F0, 0x3AE13D47, 0x2A195DEC,
+    0x3AEE4D9A, 0x3AED4AFD, 0x3AD66E94, 0x2A30AADE, 0x2A2D5EA4, 0x3B45CD2A,
+    0x16D95771, 0x3D3C2A00, 0x361E0E03, 0x4ABC238A, 0x4B5F8181, 0x3AFBE02F,
+    0x3AE17E89, 0x3D3C29EE, 0x3AD4F5C9, 0x37C99083, 0x29D6FAF1, 0x3AEFA1FA,
+    0x3AEE190E, 0x3AED4CB1, 0x2A663BE2, 0x4BD05862, 0x4BCECDBA, 0x3AEFDBC5,
+    0x3AEDCF49, 0x4BC27DF0, 0x3AEDCCDF, 0x2A178B38, 0x2A178B67, 0x4E1F2CD9,
+    0x3F654CA3, 0x37C9A1FE, 0x3AD52603, 0x3AF88909, 0x3AD4AE10, 0x18E95899,
+    0x4BD09A07, 0x2AD1F1EC, 0x3AA271E1, 0x3AEDCBB2, 0x3AFA5447, 0x3AEE1916,
+    0x5BEBE1C9, 0x4B15E746, 0x2A7C1B00, 0x38860F06, 0x3AED4E8C, 0x3D3C6B9A,
+    0x3AD6DF1B, 0x29BF99D8, 0x38797E10, 0x3AE13525, 0x3B8DD572, 0x3AED4CAF,
+    0x5BEDEDC2, 0x4BC44099, 0x2A64BC9B, 0x3AE2C85C, 0x3AED4CA1, 0x3AE13BFD,
+    0x68474637, 0x3AED9641, 0x5BEDE42E, 0x3AEBF96C, 0x4BC23EF2, 0x4BC44174,
+    0x29BFD4A8, 0x3D3E2C79, 0x37D65076, 0x3A95E783, 0x3DACF7AB, 0x37C9D329,
+    0x2A2B66B7, 0x3AE310E0, 0x3AEF96F3, 0x3AEBFB1D, 0x36376DAD, 0x1892F512,
+    0x3821885E, 0x2A663DAC, 0x3AEDD776, 0x3AEE065B, 0x3AEDD08D, 0x4BB7782C,
+    0x2A664664, 0x3846AD82, 0x3B45BBFC, 0x3AEFC89B, 0x2A302A4A, 0x4BC4097D,
+    0x3D558D23, 0x3851BF3E, 0x29A6853A, 0x3AD8421D, 0x29BF9CA4, 0x4E129E93,
+    0x4E2BD0A0, 0x3AD4F5D7, 0x3AE13BF1, 0x3AEDFBEC, 0x3AEE5135, 0x3AFA974F,
+    0x3D559565, 0x4BC40A74, 0x3AD6DF19, 0x37D65073, 0x3AED4CC9, 0x362011EA,
+    0x3B45B908, 0x3AEDCBB1, 0x3AEF8F29, 0x4BC41D15, 0x3AEF5814, 0x3AEE064F,
+    0x48FB9180, 0x4BCECEB3, 0x4BCECEB7, 0x2A304570, 0x3AEFD218, 0x3D3E3705,
+    0x3AED963D, 0x3AD4F790, 0x3AFA1C39, 0x29A68536, 0x2A303317, 0x2A6DBE67,
+    0x382C4C9D, 0x3AD4AB03, 0x4D7BDACC, 0x3AEFA1EA, 0x3AE2BDE0, 0x3AEDC4BD,
+    0x2A195E09, 0x3B461087, 0x361383A0, 0x3B478CA0, 0x2A663BF1, 0x37ED77B2,
+    0x4BC275C0, 0x4BC3BF9A, 0x3B45B4CC, 0x2ABAF7EC, 0x3B43B67F, 0x2A17933D,
+    0x3AED8CA5, 0x37C99087, 0x4BCECEAB, 0x4BB7780F, 0x37C9908F, 0x57C17772,
+    0x361E4FC3, 0x4BCECEAA, 0x3AEE513C, 0x3AEE1515, 0x38875726, 0x3AFA5ED3,
+    0x4BC4417A, 0x3B453866, 0x387B81E5, 0x3D53C21F, 0x3DA07977, 0x29BF9B2D,
+    0x38DE075C, 0x33B6905E, 0x3AE309FF, 0x2AAE685C, 0x2A66551C, 0x4BC44946,
+    0x3AEFDA0C, 0x4BC23EF8, 0x3AEDCD50, 0x37C99080, 0x3AE310F8, 0x3AEE0F81,
+    0x2A665535, 0x2A62F927, 0x37E0DD96, 0x3B43B68B, 0x36205D16, 0x2A62FAC6,
+    0x3AEFA2CE, 0x38843A17, 0x3A96054F, 0x2A663BEA, 0x3B5EA576, 0x2A66464E,
+    0x2A30331D, 0x3CF0FEBA, 0x29BFA5DC, 0x4BCD0DCE, 0x2A62F91F, 0x3B392BFF,
+    0x5C9A452D, 0x4BC3FFC4, 0x3D3C29F2, 0x495C448C, 0x5BEBE1C4, 0x3AE309FE,
+    0x2AB92D7E, 0x3AEF4F35, 0x3A95E0E7, 0x2A6F4770, 0x29BF193F, 0x4C19BA7C,
+    0x29BF9CAC, 0x2A70CA4D, 0x3B5080D3, 0x2A2B529F, 0x3AEE066A, 0x3DB849A7,
+    0x2A302A4F, 0x3AEDCCFD, 0x16D997D8, 0x2ABAE66D, 0x2A3028A3, 0x3614045B,
+    0x3A940A90, 0x37C9D22E, 0x3AEDD785, 0x085C7F38, 0x4905E52A, 0x29D6FAF6,
+    0x361E4E52, 0x3D558E83, 0x4BC41156, 0x3D3C6B8C, 0x36202092, 0x4BC44088,
+    0x3AEC0ABD, 0x16D997DC, 0x3AD4F5D3, 0x2AAE6852, 0x3AD5F4DC, 0x2A665534,
+    0x3AED8CB9, 0x3AE2C85E, 0x4AC8B5F3, 0x3D3E2C8E, 0x3AEF7DC2, 0x2A64BA0C,
+    0x4BC23F11, 0x3AFBE7B3, 0x29BF9B51, 0x3CFD4BBC, 0x37C99A32, 0x367644EC,
+    0x3D3FAE68, 0x29C01BEA, 0x3B453865, 0x4B6B4D7A, 0x3D3E2C69, 0x3AEDC514,
+    0x3D3E36FD, 0x361E4FD3, 0x3ADF71E8, 0x3AEE0F80, 0x3CFD8EC1, 0x495C8B5B,
+    0x3AEDCBAF, 0x3B9C3B4B, 0x4B615660, 0x37D62017, 0x2C79F150, 0x2A195DF7,
+    0x3AEE1933, 0x29BF9B2E, 0x2A64B9E9, 0x3AEDCCE2, 0x3AFC2162, 0x2A178D01,
+    0x4BCD0DD1, 0x3B478C86, 0x37E0E800, 0x2A0AF96E, 0x198C747D, 0x3AED541F,
+    0x3875E6DA, 0x3AFA0ADE, 0x3B06EDE1, 0x3AEDC4B2, 0x3AEE1042, 0x3AD56EB4,
+    0x2A17963E, 0x2A64BBB1, 0x49C07E9E, 0x4BC2487C, 0x3DADC5DF, 0x3D3C29FD,
+    0x38860DB2, 0x5C983822, 0x3AED8C97, 0x37C99085, 0x3AE13C09, 0x4BC44188,
+    0x361E4E65, 0x29BF9E03, 0x3D554D2C, 0x3AEDFD7C, 0x4BC59336, 0x3AEC4C7E,
+    0x2A64C480, 0x361E510A, 0x2ABAF8E8, 0x3AED8CBA, 0x3AFBE79B, 0x3AEF908A,
+    0x3AEE1134, 0x3AEDCE47, 0x3AEDCEA6, 0x3AED4B01, 0x4BC44AFC, 0x2A711EB9,
+    0x3AA09CD8, 0x4BC4494C, 0x3AEE190F, 0x3AED9470, 0x2ABB2FF2, 0x3AE13DB1,
+    0x2A710AA3, 0x2A881602, 0x3AE30913, 0x2A64C474, 0x3AEF908C, 0x3AEC4EB6,
+    0x3AEDD7DB, 0x27A3448E, 0x3AED9483, 0x2A64BCA4, 0x3AE13E9F, 0x3AEE0670,
+    0x3AEE191F, 0x18E959AD, 0x4BC41232, 0x2A64BA08, 0x0AD2D4C7, 0x3AEE0665,
+    0x3AED4AE9, 0x3AEDD708, 0x37C9A1FD, 0x3AA09FA5, 0x3AEBF961, 0x4B54B150,
+    0x2A64B9EA, 0x3AEF57F6, 0x4BC5931B, 0x46F48136, 0x3D558DEB, 0x3AFA257C,
+    0x16D915C7, 0x362011FE, 0x382E180A, 0x3B45BD17, 0x2A307215, 0x3AEDCE35,
+    0x29BF9DDF, 0x3AEDD788, 0x3B45BC0A, 0x3AEDD772, 0x3667E9FB, 0x4BD0584E,
+    0x3AEDCD02, 0x361E5036, 0x3AD4B6EF, 0x3AFBE213, 0x3CA596D6, 0x2AC78266,
+    0x3AEE4D99, 0x38797E1F, 0x4BC452DB, 0x3B453C15, 0x3AD4F71C, 0x3AED8C8F,
+    0x3AEC0ACC, 0x4BC60CCC, 0x38844CBC, 0x3B45BCF7, 0x2AC5B553, 0x3B06EC20,
+    0x3B457A13, 0x3B986280, 0x4C16D58F, 0x3AE3075C, 0x3AEBF95B, 0x2A64B9F4,
+    0x58D21E7F, 0x36056F7E, 0x3B45BCF9, 0x3AEBC153, 0x3CFD8EBB, 0x38797E16,
+    0x4C1A75EA, 0x3B392B1F, 0x2A178B66, 0x3A314FCF, 0x29BFD4BB, 0x3AF163BE,
+    0x4BD09A0C, 0x68A101A9, 0x1943226B, 0x3AD4F5C8, 0x4BC40A58, 0x2A2D2776,
+    0x3AEF8F0E, 0x3846AD8A, 0x3D3E2C7B, 0x3AD4AE0B, 0x086B256A, 0x2A2301B1,
+    0x3AED4CC0, 0x4BCECEA7, 0x2A3028A6, 0x3C4119D1, 0x3AEF581B, 0x3AED4CB0,
+    0x3B45BD1A, 0x3AEF62FA, 0x1999908C, 0x2A62BA13, 0x4BC40971, 0x3AED972A,
+    0x3AFA0D9B, 0x3AEDCCF3, 0x4BCED7CA, 0x3B43F80C, 0x360FF319, 0x4B6C12CC,
+    0x3AE2BDDE, 0x3AD4B6F2, 0x2AAE6B0C, 0x4968CEE1, 0x3D557C11, 0x3B392BFD,
+    0x38797DFC, 0x3AEDCF56, 0x3AEDCD46, 0x3AE2FF8F, 0x2A719F5E, 0x3B40AE99,
+    0x3AD4B6F5, 0x4C011A76, 0x2A62F90C, 0x46EB9111, 0x3AEFDA0A, 0x5C9A4438,
+    0x4BC40BB8, 0x3B43B682, 0x4BC4097C, 0x3AEDCE3B, 0x3AEFD1CA, 0x3AD56EAF,
+    0x4BC2CA29, 0x361E4FA7, 0x3AE348FF, 0x3B45BD0B, 0x3AE34BC4, 0x5C42455B,
+    0x3882362A, 0x2A195DF0, 0x362AD78A, 0x4E2670C8, 0x3AE13BEE, 0x2A30ABD5,
+    0x3AE13C02, 0x37C9909D, 0x3AEFD9EA, 0x3AEE513B, 0x3AEF9320, 0x3AE30774,
+    0x4BC3C7D0, 0x3B06F18A, 0x4BC3BE3C, 0x3AEDCB89, 0x4905E7C7, 0x3AFC2174,
+    0x4903CFD5, 0x3D558D8A, 0x4BB78311, 0x4BCECEB6, 0x3AD4AC5A, 0x361E4FAB,
+    0x3AED4C9E, 0x4C1BFEA8, 0x2A2D24C2, 0x49B440B7, 0x4BC3FFDF, 0x3AEF8F37,
+    0x4BC44173, 0x3D5583F2, 0x3AEF7DA8, 0x386CAB63, 0x3B51C9B5, 0x2A2B529A,
+    0x3D3C29FC, 0x3AEDCB9D, 0x3D3C29FF, 0x49A45A43, 0x3AEF9089, 0x3AF16154,
+    0x3A3DD890, 0x3AEDD10C, 0x3AEDCCF8, 0x4BC40BC2, 0x4BCD0335, 0x3B8E1806,
+    0x4BC2B7D5, 0x3A940AA0, 0x3AFBF283, 0x3AED4B00, 0x27B016E1, 0x387ABCF2,
+    0x3AF8938F, 0x3AEDD76C, 0x3B504937, 0x4C0F6C68, 0x495C41FE, 0x2A663DAB,
+    0x2A23E3D3, 0x3D570E1C, 0x5BEBE0BA, 0x3D9F290D, 0x2A650C28, 0x2A62F91B,
+    0x38DE108E, 0x4BC40A52, 0x3AD4AE0A, 0x3B43B84C, 0x2A64B9E6, 0x387B3ECF,
+    0x3AEC383D, 0x387B3EEE, 0x3AE311DF, 0x4E129E7F, 0x3B8DD565, 0x3877B4E2,
+    0x4905DD4A, 0x3AE1502D, 0x2AAE6860, 0x3AEF9F42, 0x3AED963A, 0x4BC23F04,
+    0x4BB76EF1, 0x3B478E3A, 0x3A97583E, 0x3CFD8EC6, 0x3A940C11, 0x4B5F818B,
+    0x4E2D942C, 0x3AEDD0F2, 0x4DD4121E, 0x3AEDC4B4, 0x3AEDD0AF, 0x3D48FDE3,
+    0x3AED8CA4, 0x3AEE1055, 0x2AC3F2AE, 0x3B392B21, 0x2A30A923, 0x3F028F39,
+    0x3AEF9321, 0x4B6C12C5, 0x3AED8DFE, 0x4B1413B7, 0x29BF9B4E, 0x46FF5000,
+    0x3AEDD615, 0x3CFBC9E8, 0x3AFC1859, 0x3AEF96E7, 0x3AEFDBB5, 0x2ABB5871,
+    0x3B393C1E, 0x3AEDCB94, 0x2A6F8A89, 0x2A64B9FE, 0x3B45EBFE, 0x3AED4B0B,
+    0x3AE13D44, 0x3D3E2C77, 0x4BC23DA5, 0x3AE17EF1, 0x3B458C55, 0x3AEDCE51,
+    0x3AEBC0D2, 0x38C498D7, 0x3A942692, 0x2A714C3F, 0x382FE37C, 0x2A64B9FB,
+    0x3AED973C, 0x33C30EBD, 0x3AD4AC50, 0x2A62F921, 0x4BB90375, 0x16D9A24D,
+    0x37D62018, 0x3AEBFB21, 0x3AEF7DAB, 0x4E129EA2, 0x3B45B90A, 0x38CDD452,
+    0x3AE13C15, 0x3AEDCF9C, 0x3AA29FC3, 0x4BC2488C, 0x3AEE1133, 0x3AEBFB12,
+    0x3B45BC1E, 0x38796B4C, 0x4B52AED3, 0x33BF8A35, 0x3AEE1051, 0x2AB92D90,
+    0x3AED5587, 0x3AEE0F97, 0x3D56CB1C, 0x29BF9B2F, 0x4BC23F01, 0x2A663BF0,
+    0x3CFD9701, 0x2A64BCA1, 0x3AD4F5CA, 0x29D6FAF7, 0x2A3039EE, 0x3AD4AB17,
+    0x3B52976E, 0x29BFA5BA, 0x3AEF931F, 0x3BA877E3, 0x33BF8A33, 0x3AED8C8D,
+    0x3AE3075A, 0x3AF89375, 0x3CFD8EB6, 0x3AF16172, 0x3AEDCFB7, 0x3AFA976A,
+    0x3AED9736, 0x3AEDD770, 0x16D9DA70, 0x3AE30A1A, 0x4BC40981, 0x3B5294CB,
+    0x49B40B01, 0x3AEDFBEA, 0x2A66465B, 0x3B45CE7D, 0x4B52AED8, 0x3AEF502B,
+    0x3B154352, 0x3AEDFBEE, 0x3B06F02D, 0x3AEC0ABE, 0x2A2D2791, 0x3AED4AED,
+    0x3B40AE87, 0x5BEBE0B7, 0x362ACE04, 0x3D550A3C, 0x3DAB7887, 0x3AE13C14,
+    0x3AE2C85A, 0x3AEDBCF2, 0x3A940A8B, 0x3AD4AC4D, 0x49B27505, 0x3AEE066C,
+    0x49A7DE9E, 0x3D557C26, 0x3B495C15, 0x3B392BFB, 0x3AED9EF3, 0x3AEE4D9B,
+    0x2B1D6106, 0x3AD56EB5, 0x3B069A7C, 0x2A62B772, 0x6B083B79, 0x2A22209A,
+    0x3AED4CBA, 0x3D9F2910, 0x4BC2058F, 0x3D3CAAA7, 0x3D3E2C74, 0x3AE310E6,
+    0x3AEE1060, 0x4BC44950, 0x2A2D2790, 0x2757EDCF, 0x3AE3412B, 0x4905DE31,
+    0x3B453851, 0x3AD4AC4B, 0x29D6FB0D, 0x3AE310FA, 0x3B40A417, 0x3AFA0AE5,
+    0x495C40A8, 0x38797E1A, 0x3AE17EF2, 0x387B3ED4, 0x3AEDCF57, 0x3AEDD70D,
+    0x3CFB884A, 0x3D56CDC4, 0x37D6201D, 0x3A95E0D3, 0x5E9DBDA0, 0x3B8DD570,
+    0x29BF9B41, 0x3B45BD08, 0x3AFA9750, 0x3AEC49CB, 0x495C41ED, 0x37C9D326,
+    0x4BB7788E, 0x50852B4E, 0x3D557C3C, 0x3AEDFBDC, 0x2A66465D, 0x3B2CAC7D,
+    0x3AEE115E, 0x4BC43EBC, 0x3D3C29F9, 0x3AEDD76E, 0x3AEBFAB4, 0x3D60117F,
+    0x3AE14696, 0x2A30289A, 0x3AEDCB8A, 0x5BEBEB60, 0x3AFA1DF8, 0x37C99092,
+    0x4DD37FFD, 0x2E8D57A2, 0x27BC9C49, 0x16D9577B, 0x3AD4EE08, 0x3AED4AF5,
+    0x4BC3FFD3, 0x36747982, 0x3AD4EDFB, 0x3AD6FC0E, 0x2A17D3F0, 0x3AED9639,
+    0x3AE310E8, 0x3B912977, 0x387E6587, 0x3AE30752, 0x3B43B68E, 0x2A710AA6,
+    0x3B504B16, 0x3B392B02, 0x3AE30BCF, 0x2A6F81E3, 0x36205B7C, 0x3AE30920,
+    0x29D6E9A3, 0x3AEFA1DB, 0x3B8DD56D, 0x3AF00A47, 0x5BEBE1A7, 0x58162B3D,
+    0x4BC3D256, 0x3AEDD76A, 0x3AED8C8E, 0x3AEDCF99, 0x3B392EC4, 0x4BD099F3,
+    0x3AD4AB0A, 0x3AE13BEC, 0x3B8DD562, 0x3AEBFD09, 0x4BC41247, 0x29C15EC5,
+    0x3B39748A, 0x3D48B9A8, 0x3B45BC10, 0x16D99065, 0x4C2683F2, 0x2A62FADF,
+    0x29BFD4C0, 0x3B43B66A, 0x3CFC0CD7, 0x4E266474, 0x3879ACF7, 0x2A62C3D1,
+    0x3D3C29FE, 0x3AFA4C8C, 0x2A2B529E, 0x3AEC4437, 0x3885CEB2, 0x382E1040,
+    0x3AD52601, 0x3AEF4D7F, 0x3AD4EDFF, 0x361DCC62, 0x398DE9F8, 0x33C30EA4,
+    0x361E4FC1, 0x2EE6969A, 0x38797E14, 0x3B45BC0B, 0x3AEF5819, 0x2AC3E046,
+    0x36056F62, 0x27BC6D87, 0x2A30331E, 0x2A302A66, 0x3B4579F1, 0x3CFD8DE1,
+    0x38217F48, 0x3AEE0656, 0x361E4E64, 0x3AEE5211, 0x29D8FD96, 0x3AED8C9B,
+    0x3AEDC66B, 0x3A960ECD, 0x3AD4AB07, 0x4D7BE457, 0x2A3028A8, 0x495C41F2,
+    0x3B92AB47, 0x4BC3BE95, 0x2A664D35, 0x3B0841DB, 0x3D54C897, 0x3B06EC45,
+    0x3885CDB1, 0x3A979982, 0x3AEDCF94, 0x3AEBF957, 0x33BF8A38, 0x3AD4AC72,
+    0x4BCECEA1, 0x3AEF9F25, 0x3AED4AFB, 0x361E4FA8, 0x3AEFDA08, 0x2A6DCAA3,
+    0x29B30A34, 0x25A00B7C, 0x3AEBFD07, 0x37C9A1FC, 0x3AE1467D, 0x3AFA0AE3,
+    0x3AEBFB11, 0x3B40A3FF, 0x3875E6DC, 0x3B06EC40, 0x3AE13E9A, 0x3AEDD08F,
+    0x4C1A3DE1, 0x3B392C14, 0x3D558D7A, 0x3D3E2C7E, 0x2A178B3D, 0x3CF0FDDF,
+    0x495C41F3, 0x3AD6DF18, 0x3AA09CDC, 0x3A95D671, 0x3D618883, 0x3B0731D7,
+    0x3AEDCF46, 0x4BC45303, 0x4BC48067, 0x3A95CE3B, 0x3AE13D43, 0x3D3C29FA,
+    0x3AEFA355, 0x3AEDC75A, 0x4BC23F16, 0x3AFA9766, 0x5C983808, 0x3AD4ADA4,
+    0x3AEFA2D5, 0x3AFA0C90, 0x2A62F90D, 0x2C72C169, 0x2AD1F1E6, 0x24F1A81A,
+    0x3AEF56C0, 0x38793C57, 0x2A64BCA0, 0x3AD4B59E, 0x3875E6D3, 0x4BC4418B,
+    0x3AEDCBA1, 0x3CFD8EBE, 0x3A940A8C, 0x3682D898, 0x3AE34A55, 0x3AED4AEE,
+    0x3CFD0A12, 0x2A64C47C, 0x4E2BC84F, 0x382C0AF5, 0x3B912979, 0x361E4E50,
+    0x2A3039ED, 0x2A1488D6, 0x5BEBEB5C, 0x3AEC4C74, 0x29BF9CF3, 0x3B446745,
+    0x3AFA1635, 0x29C01BE6, 0x3AEBF971, 0x4B52AEE5, 0x29BF9BB6, 0x2A64B9FF,
+    0x1B4F55B1, 0x29BF9B52, 0x3B392C02, 0x3D53B9ED, 0x3AD84233, 0x3B92AB55,
+    0x3AED9474, 0x37C99099, 0x3B43F91F, 0x37C99090, 0x3B442873, 0x2A62C3BE,
+    0x38797E0A, 0x4BC471BF, 0x2A0B0BBE, 0x3AEDCEA5, 0x3AEC0278, 0x3B504932,
+    0x2A3028AA, 0x3D574FBF, 0x3D574FC9, 0x3AEFA1D7, 0x3AD4F5D5, 0x3AED98D9,
+    0x4BC23F07, 0x3AEFA2ED, 0x37C9907E, 0x3B45BD11, 0x38797E17, 0x362011FA,
+    0x3AEDCEA3, 0x3AEF9087, 0x3AD4F78F, 0x3AD84239, 0x3AEE1067, 0x382C0B13,
+    0x2A62B77A, 0x3CFD9164, 0x386CAB85, 0x3ADF68CA, 0x3AEDCCDC, 0x3AEFA1F0,
+    0x2A6DC7E9, 0x33C30EB5, 0x3AFA0AE9, 0x3AED947B, 0x3AEBFB03, 0x37D62036,
+    0x3B453BF7, 0x4BC23DFF, 0x3AD4AC5B, 0x3B504B00, 0x4BC246EC, 0x4BBACD92,
+    0x3AFA1554, 0x382E0F4C, 0x3AC81D0E, 0x3AEE18B4, 0x27AE0892, 0x3AE2FF99,
+    0x3AFA9927, 0x3AFA5DE3, 0x3AF0E0CB, 0x3AE311F7, 0x55BAFD4E, 0x3B43B683,
+    0x3AD4EDED, 0x3AD4F5CB, 0x3D3E2C91, 0x38DE0F31, 0x3AEDCE54, 0x3AD4F894,
+    0x3AEF96F4, 0x3D3E2C7C, 0x2A178B46, 0x2A64C473, 0x4B6A7F1B, 0x38878F9B,
+    0x3B40A401, 0x4BC44AAA, 0x361E4E67, 0x3AEDCB85, 0x29D6FAEF, 0x3D3E2C6B,
+    0x3AEE0565, 0x3AFBE030, 0x3AEDCCF7, 0x3A95E093, 0x3AF8937C, 0x29BF9CA6,
+    0x3D9F30FA, 0x2A62B693, 0x3AEE055F, 0x3DB84850, 0x3AEBF962, 0x2A241A10,
+    0x2A307230, 0x3AEE0652, 0x3AEC0128, 0x37C99089, 0x2A178B51, 0x2A62B771,
+    0x4BC1FBF2, 0x38797E1B, 0x3AFA154C, 0x3DA0D745, 0x3AEDFDA1, 0x3AED4E8B,
+    0x3B9BE6E3, 0x495C41F1, 0x2A2419F0, 0x361E4E66, 0x3D54C9FC, 0x3AEDD093,
+    0x29D6FB10, 0x3AFB5C89, 0x3AE2FF8B, 0x3AE1501A, 0x3AE13D49, 0x3B45C640,
+    0x3BA8894B, 0x3B43B92E, 0x4BC23C6A, 0x3AEF57F4, 0x2B1D6A9D, 0x4B5F8191,
+    0x38DDBBFC, 0x3A97D8EE, 0x4BC40A6B, 0x3B44372F, 0x2A663BE4, 0x3AFBF286,
+    0x29D6E9A4, 0x3AED9495, 0x3B4CF1F2, 0x25077C6A, 0x3AEDCFB9, 0x4B5F8199,
+    0x4B61424A, 0x3AEDD76D, 0x38CFA9AF, 0x2A6301BB, 0x29BFA5BF, 0x3CF11201,
+    0x3AEF9713, 0x4C1BBE56, 0x4BC4129A, 0x361E4CFB, 0x36763D80, 0x4BC40A61,
+    0x3AE312B2, 0x4BCE8E9C, 0x2AC3E041, 0x382C0B1C, 0x387B3EE3, 0x3B45BD09,
+    0x3AF1250D, 0x3B45386A, 0x29FE7141, 0x3AEFAB8F, 0x3AEDD82C, 0x3AEE103D,
+    0x2A1AB07D, 0x3B35DECB, 0x3AEDD92A, 0x3D099B0E, 0x3AED4AEB, 0x3AED9646,
+    0x2A62F910, 0x3AED4CC8, 0x6CC08829, 0x3AE13C11, 0x361E5033, 0x4BC452F4,
+    0x38797E02, 0x16D9A252, 0x4BC23F0D, 0x37E0DD9A, 0x3D5596AE, 0x3B9BA584,
+    0x3AEE0F85, 0x3AEC0AC6, 0x2A302897, 0x3AEE0658, 0x3AE14843, 0x3AEDA0B4,
+    0x3AEE0672, 0x4BC23F0C, 0x3AE13C0F, 0x2AC3E044, 0x3AEDD090, 0x3AFA976F,
+    0x3B8E1805, 0x3AEDCFB5, 0x3AEDD82B, 0x3AED8CA2, 0x3B40AE9F, 0x3AEBF95F,
+    0x3AEDD789, 0x3AEDCEBF, 0x4BC44B2B, 0x3B4439DD, 0x3B45C4CE, 0x3B504B15,
+    0x3C4BDC6B, 0x3AE34903, 0x29D6FB11, 0x3B37AB90, 0x3AF12367, 0x4BC246DA,
+    0x3AFBE7B8, 0x495C41FB, 0x4BB7814E, 0x3AEFD9EF, 0x3AFA8CD3, 0x3AEDCBA7,
+    0x3AEF99B2, 0x3AF88910, 0x3AFC2AB1, 0x3AEE0E84, 0x361E4E72, 0x3D5583F1,
+    0x2A62C3BB, 0x3AEDD793, 0x3AEC4494, 0x37C9D22B, 0x3B392C07, 0x3AFBA898,
+    0x4BC41135, 0x3D3C6B94, 0x3B45BC03, 0x2A2D24C7, 0x3AEFD22A, 0x3B392C00,
+    0x3B4541F6, 0x2A30A940, 0x3CFD4BB9, 0x5BEBEB64, 0x4BC3C777, 0x173197F7,
+    0x36201202, 0x382E2199, 0x4B6A47B9, 0x3AEA309B, 0x37D7FF94, 0x37C9907A,
+    0x495C41EB, 0x3AEDD784, 0x3A314FCC, 0x3CFD8ECD, 0x3AEC4497, 0x3D09E74A,
+    0x2A668C2C, 0x3B521C5C, 0x38793C56, 0x4BCECE96, 0x36056F6D, 0x2E8D57A1,
+    0x3AFA976C, 0x361E0E13, 0x3B453873, 0x3AEDCD63, 0x3AE13BE9, 0x3879B787,
+    0x3AEDCF96, 0x3CA5A933, 0x3877B25F, 0x37C9D230, 0x3AEE2148, 0x3AEDFBE4,
+    0x2AC3E301, 0x2A668C4A, 0x4C0F7067, 0x2CCAF761, 0x3AED962F, 0x3AEDCB97,
+    0x3AE3075D, 0x3AFA95F5, 0x4BD09A1A, 0x37C99095, 0x3885CEAF, 0x3AED4B08,
+    0x4903CFD7, 0x3AED8C8C, 0x495BD011, 0x2A302C36, 0x3AEDE113, 0x3AED4AE5,
+    0x3AEDD0F0, 0x3AF16151, 0x4DC7C3BA, 0x4BC2BFA2, 0x37C9907D, 0x2ABAF1E9,
+    0x3D09E492, 0x3F650C65, 0x37D6506D, 0x3AED4AF1, 0x3AD4EDEF, 0x4BC246DB,
+    0x4BC40A64, 0x3AD4F877, 0x361DCC63, 0x27AE0891, 0x3AEE0D40, 0x3AE13DB6,
+    0x3D3C29ED, 0x3AEDE0F9, 0x3AEDFBD9, 0x2A3028AF, 0x3AEF9067, 0x3D54C899,
+    0x3AD4F78C, 0x3AE3074E, 0x2ABAE67F, 0x2A62B778, 0x2A64B9E5, 0x3AEDCF93,
+    0x2A62B77D, 0x3AEDCF43, 0x496710A5, 0x4C1BC777, 0x4BCED011, 0x444E3587,
+    0x2A6301C1, 0x3B392C17, 0x3A960ED1, 0x3B473D7C, 0x3AEE114C, 0x3AE2C84C,
+    0x3AFA8CCF, 0x2A195E03, 0x387082D4, 0x3846AD8E, 0x3AEDCBAE, 0x3AEDD08E,
+    0x3AEF283A, 0x3AD8421A, 0x3B91296B, 0x3AEA38D9, 0x3AF88904, 0x3B4270C2,
+    0x3AEE1135, 0x5BEBE1B1, 0x382E4F41, 0x3AEC0ABA, 0x2A881605, 0x3AD84237,
+    0x3B453862, 0x16D9992A, 0x4BCF0DAC, 0x3AD843EE, 0x29BF9B2B, 0x3B45BC15,
+    0x393428DB, 0x3A95D64F, 0x3AF89395, 0x3B45BBF7, 0x4BC3C7CA, 0x16D99997,
+    0x2A62C3B7, 0x38EA8D5E, 0x362AE0BB, 0x2ABAF7EE, 0x3AEDCD69, 0x3AFA609D,
+    0x3A940AB0, 0x3882768A, 0x3AEDD105, 0x3B8F55F2, 0x3AED9480, 0x4BC246D9,
+    0x38797E1E, 0x361E501A, 0x3AEF7DA1, 0x4B5F8171, 0x3AFA9747, 0x3AD53088,
+    0x3AEC02DC, 0x2A323F21, 0x29BFA5CA, 0x3AD67824, 0x2A64B9EB, 0x3875E6DD,
+    0x3AE13E9B, 0x3AFA1814, 0x3AEDE115, 0x3AEDCDE2, 0x29BF95CB, 0x3AD4AC4F,
+    0x3D45A723, 0x3AEC0AC8, 0x3B45BC01, 0x2AC7C240, 0x3AEDCE46, 0x3AEFDB65,
+    0x3AED49B7, 0x495C8A68, 0x3AE30909, 0x4BCCFB0C, 0x3B44419B, 0x29C16947,
+    0x29D6FB0C, 0x29BFA5C7, 0x3AEDC4CC, 0x3879B4C6, 0x382C0B1F, 0x3A940AA3,
+    0x3AD4AC70, 0x2A2B529D, 0x27AFD3F2, 0x3AE13DAE, 0x361E4E51, 0x3AEDD773,
+    0x3D3E2F24, 0x37C99A33, 0x3AD4AE09, 0x3AEF4D66, 0x3AED4AF4, 0x3A962144,
+    0x2A62FADB, 0x3AD4AB0C, 0x3AE310FE, 0x3AEF7DC9, 0x3AD4AC68, 0x3AD84238,
+    0x3AED4CA2, 0x3AED8CB7, 0x3AD52602, 0x29BF9CF6, 0x3875E6F0, 0x3AEE065A,
+    0x2A64B9F6, 0x4BC410D1, 0x3AEDCD01, 0x3AEF4F39, 0x37D7A1F3, 0x2A2B5C21,
+    0x2A302A51, 0x3AEE4D9E, 0x4BC23F14, 0x3B4793BF, 0x5A31019C, 0x3AEF7DD0,
+    0x3B53DFFD, 0x3AE3092A, 0x3F5BD8D9, 0x3AFC215D, 0x3AEFD31D, 0x2AC3E045,
+    0x2A663BE1, 0x4BC5DCBD, 0x3ADF71E4, 0x29BE12E6, 0x3AE13DAF, 0x4BC5932B,
+    0x2A62FAD0, 0x3AEFA2CF, 0x3B453B82, 0x3AFB9E29, 0x3AEDFBE6, 0x4C288E45,
+    0x4B6DDDDE, 0x2A19A087, 0x3AFA8CD1, 0x3AED9630, 0x49B0A988, 0x3AEE0F95,
+    0x3AEDD091, 0x2A64BC9E, 0x3D40396E, 0x3AE13BFB, 0x3CFD5E9A, 0x2ABAE66F,
+    0x29D6FAF5, 0x2A178B4A, 0x3AEF9066, 0x2A664666, 0x3AEF8F23, 0x3D558D25,
+    0x37C990A3, 0x2A2B529B, 0x5EE70DED, 0x3AEF7DC5, 0x361E5016, 0x3B06EE8A,
+    0x3AD843E6, 0x495C131E, 0x3AFA1C3F, 0x3AE348F2, 0x3AEDD786, 0x4B5F818E,
+    0x3AFA8CD2, 0x29BF9B30, 0x3AEDD611, 0x41CB49DB, 0x3AEC49A6, 0x3AFBE797,
+    0x3D099B28, 0x361E910B, 0x3AEC0AC0, 0x3AEF9086, 0x3AEBF95E, 0x2A64C496,
+    0x4E2D910E, 0x2A62B77C, 0x2E8D57A0, 0x3B8DD561, 0x2A6DBD72, 0x4B5F816C,
+    0x3B422F7F, 0x3AE13C10, 0x3AEBF959, 0x3D3C29FB, 0x29BF9BB4, 0x4905DE3C,
+    0x3AD4EE5F, 0x3AEDD62D, 0x3AE17E8C, 0x3D3C29F6, 0x3AD4AE06, 0x4BC44083,
+    0x3AEDCBB5, 0x29D6FAF8, 0x33BF8A36, 0x4BC3FFE2, 0x3AD4AC74, 0x3B43B67B,
+    0x3B4542EF, 0x3AE14168, 0x3AE13BED, 0x3AEFE391, 0x3AEFD9F6, 0x36138105,
+    0x3B4581D8, 0x4BC44198, 0x4BC23F0B, 0x3AEC49A7, 0x382E5031, 0x2A195DF9,
+    0x362011FB, 0x37D62029, 0x3AED4CA3, 0x2A62F920, 0x4BC25059, 0x3AEFA2F0,
+    0x3AEDD092, 0x4C264A1E, 0x4BB56B00, 0x2A302C38, 0x46F2C085, 0x494FB7EE,
+    0x3D3C29F1, 0x2A714C41, 0x38797E0D, 0x3AEBF969, 0x361E4E68, 0x3D55CDE9,
+    0x3B45CA56, 0x3AEE0D4C, 0x3AEF989F, 0x37C99088, 0x3AE17EF3, 0x3B43B669,
+    0x2ABAF0FB, 0x4BC4080E, 0x2A62F90E, 0x3AD52605, 0x2B1DAD33, 0x3AEF7DAC,
+    0x4904524A, 0x3B06F80A, 0x3AED948F, 0x4BB61EA1, 0x3B478CA4, 0x3AEF90D5,
+    0x3AEE0F9A, 0x3AEDCF30, 0x3AEDCE3D, 0x3B43B67C, 0x38DE0F2E, 0x3B46057D,
+    0x2A7B97BB, 0x3AE2FF94, 0x29BF9B4D, 0x3AE310DE, 0x3B43B66B, 0x38EA132F,
+    0x4BC068D1, 0x3D55831C, 0x3AEFA2DD, 0x3AEFD1B0, 0x2AB92D84, 0x16D9DA5C,
+    0x3AEBF960, 0x3AF163BC, 0x3AE30760, 0x6AFDFB7C, 0x2A62F925, 0x3B457BB5,
+    0x2A3028A5, 0x37C9909B, 0x5CFE4868, 0x29D8FD94, 0x4BC23E0A, 0x37D7A1F9,
+    0x494FB0F7, 0x4B54B167, 0x5BEBE0BC, 0x3875E6D5, 0x2A3028AB, 0x2AD1F1F1,
+    0x4BC3FFE4, 0x2A3028A0, 0x29BF9CF1, 0x382E0F4D, 0x3AE2FF6C, 0x3AD4F5D6,
+    0x3AEF8F21, 0x3AEF1FDE, 0x3AFA56F5, 0x37D62AC1, 0x4BC79F44, 0x3AD4AC6B,
+    0x4BC5D4E4, 0x29D8FD8C, 0x3AED4AEA, 0x3B92AB4D, 0x368C1167, 0x38845F82,
+    0x2A30E316, 0x4B7858AA, 0x3AFBE017, 0x361E0E2A, 0x367646B0, 0x3AEF7DA7,
+    0x4BD0D139, 0x3AED4AF6, 0x5C96ED5C, 0x50DEEDAA, 0x4BC4B368, 0x2A2D278B,
+    0x3AED9649, 0x3AED9EF8, 0x37EB7C0D, 0x4BC4418D, 0x3AED49A7, 0x4905E7D6,
+    0x3AEDCB95, 0x2A663BF3, 0x3D53B8A7, 0x29D8FD72, 0x37C9907F, 0x4905DD48,
+    0x37D7A1F7, 0x2A195DEF, 0x3AEDCD62, 0x3AF888F8, 0x3AEF7DC8, 0x4BD09233,
+    0x3AF88911, 0x3AEF9F3E, 0x3AEF9068, 0x3AED4AFA, 0x4BC413F8, 0x361349BF,
+    0x3B479206, 0x55634850, 0x3AF8890E, 0x3AED8C94, 0x4966FCE8, 0x4BB5A4E9,
+    0x3D45A726, 0x3AED4AFC, 0x3CF0FFA0, 0x3AD6DF1A, 0x362011D9, 0x3B45BC09,
+    0x4BC3CF9F, 0x3B43B685, 0x3B4EC987, 0x3AEE0805, 0x3AEE191A, 0x3AEF4D7B,
+    0x387B51C0, 0x49A45A42, 0x2A66474C, 0x4BC3FFD1, 0x3B458496, 0x3AEF8F26,
+    0x362011EF, 0x3AED8CB6, 0x4BC453F4, 0x49684E4E, 0x361E17B1, 0x4BC41137,
+    0x4B5F832C, 0x16D997DB, 0x4BD1A218, 0x3AEC42EB, 0x3B524D8D, 0x3AEDCF98,
+    0x36056F80, 0x4BCECF17, 0x5BEBE1C2, 0x3AEDE121, 0x2A195E02, 0x3D3C29E9,
+    0x2A62B76D, 0x3AEE0FF5, 0x3AEBF965, 0x2ABCAA0D, 0x3AEE0678, 0x37C9908E,
+    0x2A710AA5, 0x2AC764B7, 0x3A877B7B, 0x3B392C09, 0x3AEFDA07, 0x2A6F8A87,
+    0x3AF1110A, 0x3B45BBA7, 0x3AEBD3BA, 0x3BA6E31D, 0x3AEE0F96, 0x3AEDD0A9,
+    0x4BCECEBA, 0x361E4FAA, 0x3B4CF1F1, 0x3AED5585, 0x4B1414F1, 0x38797E15,
+    0x3D3C29E6, 0x3A893E8F, 0x2A62B773, 0x3CE46CD3, 0x3AE2C867, 0x16D915C6,
+    0x2E8D578A, 0x4BD98B0E, 0x3AE17F5C, 0x3AF888F9, 0x3AEC42EF, 0x2A6301B7,
+    0x29BF9B2C, 0x38793C55, 0x3AEF98A7, 0x4BC44194, 0x3AE2FF81, 0x4BD06081,
+    0x3AEDCF32, 0x3D3CAA86, 0x3AEE0FDD, 0x4BC23EF3, 0x3A94151F, 0x3AF89390,
+    0x3AEE0D53, 0x2A62F923, 0x4BC3FFD9, 0x2E90DBFA, 0x3AEDCBAC, 0x3AED8CA1,
+    0x3AFBA615, 0x361E90F1, 0x3AEE4D98, 0x3D3E2C7A, 0x2C7D871A, 0x4BCECEA8,
+    0x3AE4CAF3, 0x2A650FC0, 0x3AEE51A1, 0x2A3028AE, 0x3AEDCE5A, 0x361E4E4F,
+    0x3B45BCFF, 0x3846AD8C, 0x2A64BA00, 0x3AE13C0A, 0x3AEDCD59, 0x16D997D9,
+    0x3AE13EA0, 0x3CFD8DDE, 0x3AEF9064, 0x3AD4AAF3, 0x4DD593F5, 0x4BC40957,
+    0x3821920C, 0x3B4539AD, 0x3AEDCE55, 0x29D6FB0E, 0x3D3C6D4D, 0x2A30331A,
+    0x3AEDCDFB, 0x3B9DBBCD, 0x3AE30772, 0x1B4F5408, 0x3AD4AE0E, 0x4D665069,
+    0x49B273FA, 0x3AE13C0E, 0x3AE4D331, 0x3AE2C704, 0x4BC60CE2, 0x4BCECFF3,
+    0x361E90F2, 0x3AE17E8A, 0x2A178B3F, 0x29BF93C9, 0x3AEDCD67, 0x3AEBC138,
+    0x3AED9492, 0x4B52AEDC, 0x38793C5A, 0x4BC23F1A, 0x3D3C29E5, 0x3AF11108,
+    0x3AD68A84, 0x3AEDD781, 0x3AED9490, 0x4B62CEB3, 0x3AE13DA4, 0x2A30289B,
+    0x3B8DD571, 0x3AD4F5D4, 0x3AFA976D, 0x3AE2FF70, 0x3AE0FBA2, 0x3AEDD78A,
+    0x36764FE7, 0x3AEE52E8, 0x2A664D31, 0x3AE13D48, 0x2A2D2777, 0x3DACF7BC,
+    0x4BB7AF9F, 0x3AEDD0AA, 0x3AD4AAF4, 0x4BD09A08, 0x3AE2BDDB, 0x3AEF4D68,
+    0x090E81FA, 0x38DE3484, 0x3AD4AAF1, 0x4BC5D4D1, 0x2A62B780, 0x4BC3FFD4,
+    0x4904117D, 0x4BCD0DD3, 0x3AEDCD6C, 0x3AEF9F20, 0x3AD4AC4E, 0x3AE13BFF,
+    0x3AEF9063, 0x4E12F042, 0x3AEF7DCD, 0x37C990A2, 0x38389D5A, 0x29B30A36,
+    0x33C30EB7, 0x3CF0FDDE, 0x19999089, 0x3DAD4271, 0x4DD39006, 0x3AEDD926,
+    0x29BFA5BB, 0x36056F7A, 0x4BC3BEA4, 0x3AEDD792, 0x3AEE1155, 0x3ADF8C9D,
+    0x3AEDCD49, 0x38CFA932, 0x3AEDCD04, 0x3B45BD00, 0x3AE30A0D, 0x3AEF5812,
+    0x37D7B35F, 0x3AEE1148, 0x4BB737D4, 0x3D3C29EA, 0x421665D6, 0x3AEF96F5,
+    0x3B06F04B, 0x2C25902F, 0x25077C6B, 0x37D62ABF, 0x3AF89394, 0x4BC40A62,
+    0x1B4F5406, 0x2A303316, 0x3AED4B03, 0x3AEBFB22, 0x2A663BE9, 0x3B392B03,
+    0x3AE2FF7D, 0x3D3E2C6A, 0x4B5F8195, 0x3AEDD62A, 0x3AED8CA6, 0x3D5757A1,
+    0x36056F71, 0x4E76DB4F, 0x4BC41152, 0x361E4E76, 0x2A64CC51, 0x3AD4B599,
+    0x361E4E63, 0x3B45C4E9, 0x3D554D2E, 0x3B43F828, 0x361E0E02, 0x2A64BA0B,
+    0x2A62B770, 0x37E0DD9D, 0x3D48BC41, 0x3AEF4F3D, 0x4B5F8174, 0x2AB92D94,
+    0x2A663BF4, 0x3B38B104, 0x33C30EB0, 0x3875E6D4, 0x16D7CF1E, 0x3885CD4F,
+    0x495C44AC, 0x389B9881, 0x3A71F86E, 0x3885CD54, 0x3AED4B10, 0x2A178B53,
+    0x49A45A4B, 0x3D3E2E43, 0x3AED4AEC, 0x4BC27DED, 0x3AFA1C4B, 0x2A663BE6,
+    0x4B5F3FD0, 0x2A62C3D0, 0x3AE2FF8D, 0x2A663BEE, 0x4BC0732A, 0x4BCECEA0,
+    0x49B3FEBD, 0x382C4CB0, 0x3AFBE212, 0x3AEFDB54, 0x16D9997D, 0x5BEBE1BC,
+    0x38797E24, 0x3AE1C029, 0x3AEE0F98, 0x3AE2BDDD, 0x3A94583E, 0x3AEDCE5C,
+    0x4B6A4EF0, 0x3875E6F8, 0x3AEDD790, 0x3D574E6E, 0x3AEF906E, 0x3AEDFBDA,
+    0x3AFA4C6E, 0x3AED4CB2, 0x2A62FAD2, 0x38797E1C, 0x4B6B8F37, 0x3875E6EC,
+    0x361E5107, 0x3D3C29F3, 0x3AAEB7AF, 0x4BC27DEF, 0x3AE311EC, 0x4B5F8172,
+    0x3AEDCF31, 0x3CFD4BBD, 0x4E29FCFD, 0x2A668EF2, 0x3B45BD0D, 0x2A663F87,
+    0x3AED9640, 0x4B5F819B, 0x3AD4AC5D, 0x3AE310ED, 0x4B6C1388, 0x2E8D5788,
+    0x3AEF9F3F, 0x3AEF924C, 0x38847AAE, 0x33B685F7, 0x3AFA975F, 0x3D4934FA,
+    0x4BE65D4A, 0x3A95E103, 0x3AEE114A, 0x4BC246F1, 0x3AE2FF7F, 0x4C26BC1A,
+    0x3AEDD618, 0x4BD09BD3, 0x3AEC054A, 0x3D554BE2, 0x3AD6DF17, 0x4BDCE9B8,
+    0x3AEDCE4C, 0x3AEE5127, 0x3D3E2C7D, 0x2A307210, 0x1B4F5413, 0x3AEDCCF9,
+    0x38EA9EC6, 0x4BC41139, 0x3AEF906D, 0x3AEDCD6B, 0x3AEDCB96, 0x3AEF5813,
+    0x3AE30928, 0x361E92BE, 0x3AED971F, 0x25937A9C, 0x4905E7DD, 0x37D62016,
+    0x4BC44193, 0x3B082DB1, 0x4BCECEA4, 0x361E4E74, 0x3AFC6C9B, 0x3AE30918,
+    0x393428E6, 0x4BC068CC, 0x3F654CA4, 0x3B39AB9F, 0x3B392B01, 0x4BD04F81,
+    0x37C99093, 0x3B45BC0F, 0x3AEDCD4E, 0x3AEDCCF4, 0x3D3C6BB3, 0x2A195DF1,
+    0x4BD0507E, 0x3AEE1930, 0x3892A005, 0x3AEDCF40, 0x2A30B4A5, 0x3AED4B0F,
+    0x4E81EBA2, 0x3AEDD639, 0x3AED4B02, 0x4BC3FFD7, 0x2A64BBA8, 0x37D62039,
+    0x3AFA1EE3, 0x2A242DB4, 0x3B45BBFB, 0x382DE168, 0x3B4579F0, 0x3D56CB2C,
+    0x3AF89392, 0x3AEF908B, 0x3AED946D, 0x2A663BE3, 0x3AEF4D80, 0x3D3C29EC,
+    0x3AEDCBA9, 0x46F48A66, 0x4BCECE97, 0x4BCECE9F, 0x38E6F78C, 0x3AE30921,
+    0x3D3C29F0, 0x361E4FA9, 0x3AEFA347, 0x4BD1E3E3, 0x3AEBF95A, 0x3B504931,
+    0x3AEC02DA, 0x2A302C34, 0x3B392B26, 0x3935BAD5, 0x3AEDCF4A, 0x3AEF7DCC,
+    0x4BC40816, 0x2A64BCC2, 0x3B509000, 0x3846AD92, 0x2A195DE8, 0x2A178B49,
+    0x3B43B670, 0x29BF9B3F, 0x2A30720D, 0x3AEDCCDD, 0x29BF9B53, 0x3A3DE0C3,
+    0x2A15B577, 0x3AEF16CC, 0x4BC3CF9C, 0x382FE10E, 0x29D6E9A6, 0x2A6D74CC,
+    0x3AEE0D31, 0x361E58E3, 0x36768707, 0x3B508907, 0x3AEDCF9E, 0x3AD4AC5F,
+    0x3AEE0E4E, 0x5A3284D7, 0x3AEDFD7A, 0x361E0E06, 0x3AEDE112, 0x29BFA708,
+    0x37C9907B, 0x4904117B, 0x3A95E9A9, 0x3FBD4A24, 0x4BC246D4, 0x4BC45302,
+    0x3B43B849, 0x4BC23F0F, 0x2AC3E047, 0x495C41EA, 0x3AEDA0D1, 0x361E469D,
+    0x3D3C29EB, 0x3D3C6BB4, 0x3AE3090B, 0x16D997DA, 0x4BCD0338, 0x3B45BAA5,
+    0x3AD4EE0D, 0x3BA6E31B, 0x4905DD40, 0x3AEA3464, 0x2A62C3B4, 0x3AD8421B,
+    0x3AD52607, 0x4BC068A6, 0x361E58DC, 0x2A2B5C20, 0x3D3CAAA2, 0x2C7F5C00,
+    0x3AEE5126, 0x3AEF9088, 0x361E4E77, 0x16D915C9, 0x5C4E5B3E, 0x3AE13C00,
+    0x37D65074, 0x3AFA974B, 0x3AEDD78C, 0x3AE17EF7, 0x27BC1B59, 0x3CF0FEB7,
+    0x3AEDCBAD, 0x49691CC4, 0x3AED8C91, 0x2A62C3B3, 0x4BC452FB, 0x3AE30924,
+    0x2A6F9CC8, 0x3AAD361D, 0x3CFD8EC7, 0x3B504A21, 0x38D34066, 0x3D554D45,
+    0x3D558D89, 0x2A62B76F, 0x3D51FA7A, 0x3AD4AC4C, 0x4B5F818C, 0x29BFDDE2,
+    0x3B45BBFF, 0x4B6C1117, 0x3AEE113F, 0x3875E6F1, 0x3B8DD56E, 0x3AD4AB0F,
+    0x4BC23EFD, 0x3AE30917, 0x3AEBF95D, 0x36056F64, 0x4BC4096F, 0x3AEC4C5E,
+    0x3CFDD607, 0x16D915C8, 0x387B482D, 0x29BF9B4F, 0x3AD4F5D9, 0x495A9132,
+    0x4BC3FFC3, 0x3AEDD0AD, 0x3AEDD91F, 0x4B6DDB26, 0x3AEDD76B, 0x2A62B779,
+    0x2A3028B1, 0x4B52AED7, 0x2ABAE66E, 0x3AE17EF5, 0x2A62B776, 0x3AEF9322,
+    0x3AD4AE05, 0x3AD4AC6D, 0x3B8DD56F, 0x4C1A3B0D, 0x3AC9A666, 0x4BD090E6,
+    0x3AEE191D, 0x3B4D044E, 0x3AF1110E, 0x4BC451AE, 0x5C35C48B, 0x4BC3C7C9,
+    0x4BC408F6, 0x361E4E4E, 0x3AEE8709, 0x3B504A1F, 0x3A95CE25, 0x3A95CE39,
+    0x3AE30A1B, 0x3AEE0D48, 0x2A62F911, 0x3B45BD0E, 0x388409C8, 0x3D3C29F4,
+    0x382C0AFD, 0x4B54B17E, 0x3AD4B6F0, 0x36056F6F, 0x3AEF4D67, 0x4C1BF917,
+    0x3AEDC4A9, 0x37D62AA4, 0x3A95E917, 0x38844399, 0x2A62B777, 0x3AFBE20F,
+    0x2A178B5D, 0x3AEC0AC9, 0x38860EEF, 0x08699225, 0x2A62F926, 0x3AD4B6F1,
+    0x33BF8A34, 0x2A195E0C, 0x29C01BE7, 0x3AD4EDFE, 0x4BC23EED, 0x3D574FD5,
+    0x2AC76F41, 0x2A64B9F9, 0x3AED4B0D, 0x4954DA1E, 0x5BEBE0BE, 0x4E2BBF25,
+    0x2A663BE7, 0x3AEFA1EB, 0x3AEDD67E, 0x3CFD8DBE, 0x3AEA388D, 0x361E92AA,
+    0x3AEDCEC5, 0x3AEC44A1, 0x4BC40ACA, 0x3B087A5A, 0x2A64B9F5, 0x3AD4AE07,
+    0x29BF9CF5, 0x3B470C6A, 0x3AFA5ECF, 0x37D8F39C, 0x2A3078EB, 0x2AB92D6F,
+    0x3AEF906C, 0x3B5215DD, 0x1892FCC9, 0x3AEBFAC0, 0x3AEDCEA4, 0x3AEDD0AB,
+    0x2A64B9F8, 0x3AD4F7AB, 0x3AD4EDF2, 0x3B43B680, 0x3AD4AE12, 0x3AFA1C51,
+    0x3AEF9232, 0x495C41DE, 0x3AD52604, 0x3AEDCD48, 0x5BEBE88E, 0x2A62EF8D,
+    0x29D6FAF0, 0x3B032250, 0x3CF10078, 0x2A2D2779, 0x3FAEE848, 0x3AED4B04,
+    0x3AFA1E10, 0x3AEDCFBA, 0x3AEDE0F8, 0x3AEC0ABC, 0x4C1A2AF9, 0x3D3C2CB8,
+    0x3875E6D8, 0x3AF1B031, 0x29BF193E, 0x29BF193C, 0x38797FB5, 0x3AEDCE34,
+    0x3AEF7DBE, 0x3AEF5027, 0x3AFA9768, 0x4BC44125, 0x29BFA5BD, 0x3AE13C0D,
+    0x3AE13DB0, 0x2AC5B533, 0x3AEE8843, 0x3AE31395, 0x3B40A416, 0x3AE30A0F,
+    0x38BA26BA, 0x3AEDCD64, 0x3AFA5ED1, 0x4B614246, 0x3AEFD9F1, 0x2B1D6A97,
+    0x490615C9, 0x4BCECD38, 0x3AED5586, 0x3AD4AC49, 0x4B52AECF, 0x16D99674,
+    0x4BD222DC, 0x3AD4F791, 0x3AEDCEA8, 0x3AE2FF7A, 0x3AEDCE5B, 0x3AEDD93D,
+    0x3B45CCAF, 0x3AEFD20F, 0x3AE13BF2, 0x3AEDCCF6, 0x3846AD8B, 0x361E5901,
+    0x4BC246C7, 0x3AFA4C91, 0x38858BA5, 0x3AEDCFB4, 0x3AEF7DCF, 0x2A3028A1,
+    0x2A6BF2E4, 0x3AFA0ADD, 0x3AFA9762, 0x3FFC198D, 0x3B2CAD66, 0x3AEDC518,
+    0x2AB92D93, 0x3AEC49AB, 0x386CED23, 0x3CFD8ACD, 0x4BC44ABB, 0x3D9F30FD,
+    0x4B61426B, 0x37C99084, 0x3AD4F79E, 0x3AFA8CCE, 0x3AEE52F7, 0x29BF9B2A,
+    0x3AEDCBB4, 0x3AEC03C8, 0x3B453A10, 0x3AF89397, 0x3A95CE97, 0x3AEDCF9B,
+    0x3AEDC4C7, 0x2A178B4C, 0x2A3028B0, 0x387ABCFE, 0x495B41F6, 0x3AD4AB06,
+    0x3AEF9F24, 0x2A6301B9, 0x3D53B88C, 0x361CCB19, 0x2ABAF7F4, 0x29D6E9A0,
+    0x2A62C3B9, 0x3CF0FCE7, 0x090E84CA, 0x3A941520, 0x3AD4EE00, 0x4BD05A09,
+    0x3AED4AF9, 0x2ABAF000, 0x3AD4AC6C, 0x3AED4AF7, 0x3AE13C0C, 0x4BC23E12,
+    0x38CFAAA9, 0x38798F81, 0x4BC44197, 0x2A62D196, 0x2AC7761E, 0x2A64BBA7,
+    0x4E81F399, 0x3B457B6E, 0x4BC5D22E, 0x4BCD033C, 0x4BC3FFDC, 0x37C9909C,
+    0x3B504B1A, 0x3AEE0D2D, 0x37C9908A, 0x2ABB0260, 0x382C0AF8, 0x27B03B49,
+    0x361E4E71, 0x361E4E75, 0x3B06F029, 0x3B422DC5, 0x38865039, 0x4904118D,
+    0x24F01E65, 0x382E2193, 0x3B92AB5B, 0x495A7EB3, 0x29BF9CAA, 0x3AEFA1F9,
+    0x4BC3CF9E, 0x29BF9DE1, 0x3AEE1136, 0x3AF00A42, 0x3846AD89, 0x2A62F924,
+    0x3AFB5C72, 0x37C9909A, 0x3A95CFF3, 0x2A64BA0E, 0x4BC59339, 0x36057739,
+    0x2AC3E042, 0x2A663BEF, 0x3AEE0F84, 0x3605B1FC, 0x38848560, 0x362010A6,
+    0x3AE14698, 0x3AE2FF82, 0x3AE2FF7B, 0x3A3DCE1C, 0x4BC40980, 0x38797DFD,
+    0x3AC81D13, 0x4BC5932C, 0x38796B56, 0x4BC5D4D2, 0x2A2B5C1D, 0x3A897EC5,
+    0x4BCECE91, 0x3AE30759, 0x36056F63, 0x3AED8C92, 0x49B580E6, 0x3AEDCEC0,
+    0x361C7961, 0x2A64BA09, 0x3AFA154B, 0x3D558D9F, 0x38928BF9, 0x3CB22D00,
+    0x2A179327, 0x4BC246D1, 0x382C0B20, 0x2A664D34, 0x49638C3B, 0x2A663D99,
+    0x3AD84235, 0x38DE0F1B, 0x3AF16170, 0x29D6FAF9, 0x495C4091, 0x4B8C5AA4,
+    0x3AEF8F35, 0x4BC3C773, 0x3B43B686, 0x3BAC0EE3, 0x3AD4AC47, 0x3D56D4C1,
+    0x5CFDFEFB, 0x3AE311EE, 0x3D3E2C65, 0x29BF9DEB, 0x4BC2BF8E, 0x3AEC01A6,
+    0x29BFA5DD, 0x3AEDD791, 0x2A3028AD, 0x29BF9E08, 0x361E57A8, 0x361380E1,
+    0x2A2B5299, 0x3AEDD782, 0x3B06EC3D, 0x495C41F9, 0x3AFA9748, 0x3AEDCD05,
+    0x3AFA1C3A, 0x38DD82B1, 0x3AEF4D7E, 0x3AE2FF7C, 0x3885D6A0, 0x3AD5308E,
+    0x3AEDE0F7, 0x387986AA, 0x3D3C29F8, 0x4BC4113A, 0x3AFA5B26, 0x3AEDCBA6,
+    0x362011EC, 0x4B6B4D79, 0x4BC246E7, 0x3AEDCEC3, 0x2A30289E, 0x255BDD90,
+    0x3AFA1EE5, 0x2A30720E, 0x3AEFA1FC, 0x3AE30A05, 0x3AEDFBED, 0x3AEDCFB8,
+    0x4BC3F79B, 0x37CE668A, 0x3AEDCCE1, 0x3AE2FF90, 0x29BF9B43, 0x3AE30755,
+    0x3AEBFB2A, 0x2A62F922, 0x3D3E2C80, 0x2A302898, 0x3B45C589, 0x2A178B50,
+    0x2A2D277B, 0x3AEDFBEB, 0x3AFC6325, 0x4904533D, 0x3B8DD564, 0x382FE26B,
+    0x3B07EC0A, 0x3AED4C9F, 0x3AED4B15, 0x38793C58, 0x4B6C127A, 0x38C4ACF4,
+    0x3AEE0FF3, 0x387B3EF7, 0x3AEBFAB1, 0x3D3E2C7F, 0x4903CFD8, 0x3AEDCF91,
+    0x3D45A712, 0x2A2B669B, 0x3AEE1157, 0x38797E0E, 0x3AED9F0C, 0x3A940AB2,
+    0x3D558C26, 0x6AAEFC70, 0x3CFD8ECB, 0x2F1955BE, 0x2B1F6D1D, 0x2A19555A,
+    0x4968990B, 0x3AED964D, 0x3AEDD783, 0x4BC246D2, 0x495C40F4, 0x3AE2FF92,
+    0x3AEE0F99, 0x3AF00A43, 0x382E181B, 0x3AEDCEAE, 0x5E38B24F, 0x3AED4B71,
+    0x3AE2FF8C, 0x16D9999B, 0x3AEE0D4B, 0x3D558D8B, 0x29B30D0E, 0x3AEFD127,
+    0x4BCECEA6, 0x3AEE190B, 0x2A30E2F2, 0x3AF89387, 0x3AEDFBE9, 0x46FF500E,
+    0x3B45BC1A, 0x29BFA5C9, 0x3AEDCE49, 0x59907081, 0x1B4F53F1, 0x28141A1E,
+    0x3AEF8F25, 0x3A95D8AE, 0x3B457A18, 0x2A64B9FA, 0x3AEDC4BC, 0x4BC23F03,
+    0x3AE41A1C, 0x3B524C90, 0x3AEF8F11, 0x2A2B669A, 0x3AE2FF84, 0x29BF9E02,
+    0x4B6885EB, 0x3AE1469C, 0x3AFA976B, 0x3AE310EB, 0x4BC246D8, 0x4BC3FFE5,
+    0x3AEE1131, 0x4BC4097B, 0x3AED84D8, 0x387B3EF0, 0x33BF8A37, 0x3AED4B09,
+    0x3AE2FF9C, 0x3AEE1530, 0x4B5FC32E, 0x2AD1F399, 0x2ABAFAAF, 0x3AED8CA3,
+    0x3B9BE6E2, 0x3B45BBFA, 0x38D16B6D, 0x3AE2FF86, 0x382EDCF6, 0x49A45A49,
+    0x4E07E28C, 0x3AE17E8D, 0x29BF9CA8, 0x3B45837E, 0x3AEDCBB3, 0x3AEF9249,
+    0x5BEBEB63, 0x2A17938C, 0x4BC40A72, 0x29D6FAFA, 0x38860FE4, 0x2AAE685F,
+    0x3A962149, 0x3AE13BFE, 0x4BC3C7C3, 0x4BB76EE3, 0x3AEF1E85, 0x3B45C7A1,
+    0x3B45BC05, 0x3AEE514A, 0x388760AB, 0x3B43B668, 0x3AE4D32D, 0x29C126A2,
+    0x3AED4CCB, 0x3AEDCCF5, 0x2A179322, 0x3AEF99AA, 0x6063686D, 0x37D7A1F8,
+    0x2A2D24C6, 0x3CFF6024, 0x4C1C0006, 0x38302575, 0x3AEF7DB0, 0x2A30A949,
+    0x3AEBF963, 0x3D3C2CB9, 0x3AA23045, 0x3AEF90F2, 0x3AD4F78D, 0x3AEDE120,
+    0x4B52AEE4, 0x4BC44175, 0x2A30289C, 0x3AEFD20A, 0x4E837C47, 0x29D6FB0B,
+    0x3AEC0C86, 0x2A64B9E8, 0x4B61425F, 0x57C1776F, 0x2B049210, 0x193FCFA4,
+    0x3D558D97, 0x3AED4AFF, 0x3AEE103F, 0x3AED4B77, 0x36056F7C, 0x4BD0D035,
+    0x2A2215CF, 0x3846AD7F, 0x3B9A6653, 0x2AC90C08, 0x4B54B40B, 0x2A664749,
+    0x2A62B775, 0x3B2C9B12, 0x2A3039F2, 0x2A0AF971, 0x4903CFD9, 0x4BC068A7,
+    0x3AED4E8A, 0x4C267903, 0x3AEFA18C, 0x3AD4F5D8, 0x3AEDD780, 0x3AAF38AE,
+    0x4AAF9293, 0x27A34C75, 0x3B457A12, 0x4C73AD0C, 0x29BF9CA9, 0x3AD4AC48,
+    0x3AED4B14, 0x3AEDCBAB, 0x4BC5D38A, 0x3B45BC1B, 0x2AC3F2AA, 0x37D7A213,
+    0x2A64CC64, 0x4903CFDA, 0x3AED8C90, 0x361E5108, 0x3AD4B6F4, 0x38797E21,
+    0x3AEE0650, 0x5A3284D8, 0x2A0AFA57, 0x3AEF9065, 0x5BEBEB36, 0x4BC246DC,
+    0x3AE310F1, 0x4BC246DD, 0x3B45CD22, 0x3AEDD77F, 0x49689878, 0x3D3C29F5,
+    0x3AE30753, 0x3AE2FF93, 0x3AE2FF88, 0x3AEDCCDE, 0x3D0A2FBD, 0x4ABC23AF,
+    0x29BFD4BF, 0x3AEDCF92, 0x3AEF906A, 0x3B43B67E, 0x3AEF8F2A, 0x27B01EA6,
+    0x3A4A7315, 0x4BCECEB9, 0x3ADF69C0, 0x3AEDD78E, 0x3AE311EB, 0x2A71142C,
+    0x4BC40983, 0x3AEDCE48, 0x3AEC0D69, 0x4B0782C0, 0x5093863F, 0x29D8FD95,
+    0x49062829, 0x4B5F8192, 0x495E1586, 0x3D3E2C67, 0x3AED9632, 0x37D6202D,
+    0x3AEC0ACB, 0x2A6F8A80, 0x2A195D7C, 0x38793C59, 0x29BF99E8, 0x25480CCB,
+    0x3AEF8F28, 0x382E17FD, 0x3B45BC18, 0x495C41FD, 0x3B463CB8, 0x3AED4CBC,
+    0x3D3C2CAE, 0x3AEBF7EA, 0x2B049214, 0x3AED8C93, 0x3CFD5FD7, 0x4C1C0007,
+    0x2A3028A7, 0x3AEE5123, 0x29D8FD8E, 0x3AED4B0C, 0x4BC614B0, 0x2A15C75A,
+    0x3AED5582, 0x3AEC4485, 0x1B4F5412, 0x3B43B687, 0x4BC27DEC, 0x3B43B66D,
+    0x3AEC0ACD, 0x2A49D74C, 0x4D7D248E, 0x3B45386B, 0x2A66464D, 0x16D99680,
+    0x3AE2BDDF, 0x3AEDCD5D, 0x495C4203, 0x2A2B66B9, 0x3AE13BFC, 0x3AEE89BA,
+    0x3AED4AEF, 0x3AE14697, 0x3AE2BDDC, 0x3D53B8AB, 0x4BC3FFD8, 0x3D3FAE74,
+    0x38DE4F08, 0x4B52F095, 0x3AE2FF9B, 0x3CFD8EAF, 0x3AEDCE45, 0x36201203,
+    0x5BEBEB5F, 0x3AD4F7A4, 0x3AEE0F82, 0x3AED9494, 0x3D4730D2, 0x3A9790A7,
+    0x3AED8C98, 0x362020B2, 0x3AFA0D88, 0x3AD4EDF1, 0x37C9D22F, 0x4BD0912C,
+    0x2A30ABFC, 0x382FE53F, 0x3AE13DAD, 0x2AC76E39, 0x3B460610, 0x3AE2C865,
+    0x3B460ED4, 0x38797E1D, 0x2A64BBCD, 0x4BDCE02E, 0x3AEDD929, 0x3D3E2F41,
+    0x4905E528, 0x3AE34902, 0x3AD5308C, 0x3AEE0671, 0x4BC23F17, 0x3AEFA2CC,
+    0x4B6C0D44, 0x3A95961D, 0x3AEC4498, 0x3AE13C0B, 0x3DB67625, 0x37D6203C,
+    0x0875E2C8, 0x2A6DB685, 0x3AFA164A, 0x3AEDD0AE, 0x3AE30A08, 0x4BC246E0,
+    0x3AD84218, 0x3B392C1E, 0x3AED9493, 0x2A178DED, 0x4905E518, 0x6061E68D,
+    0x3AEDCE4B, 0x3AE13BF0, 0x5BEBE0B5, 0x4BC4096A, 0x3AED9733, 0x3D56D58C,
+    0x3AED9484, 0x2A6301BC, 0x36202093, 0x3AEDCF48, 0x3AED4AE8, 0x29BF9CA5,
+    0x2A64B9F7, 0x3AEF98AC, 0x3D3C6BB2, 0x16D915C5, 0x4BC5C34C, 0x2A30289D,
+    0x33B6908C, 0x361E5129, 0x4BC23F06, 0x3B504B03, 0x3B5255DC, 0x3D3C2CBC,
+    0x387B3EF3, 0x2A2EEB11, 0x4BC4095E, 0x3AEDDA2B, 0x2A302899, 0x3D3FAE71,
+    0x284697AB, 0x382E103F, 0x2B049213, 0x3AEF91D7, 0x3AEE79E9, 0x3AEE514C,
+    0x3AEDCF29, 0x4905DD41, 0x3935FC6E, 0x3AEFA2D7, 0x3AEDCF97, 0x3AEFA2D9,
+    0x3AD4ED94, 0x3AF00A2F, 0x3AED4AF3, 0x4BC41154, 0x3AEDD775, 0x3AED9F0B,
+    0x4B6144FD, 0x3AEF8F16, 0x3D558D35, 0x3605773C, 0x33BF8A39, 0x2A62F912,
+    0x2A64BBCE, 0x3AEDCE5F, 0x3AF00A33, 0x4B614518, 0x4BC068A3, 0x3AEDA0AE,
+    0x2A66474E, 0x3AFB9E3C, 0x3B509402, 0x3AEF9325, 0x3AED4B07, 0x3BD036F6,
+    0x3D3FB8DA, 0x38DDBC0F, 0x29BFA5BE, 0x4BD0921D, 0x29D6FAF2, 0x3AEF9070,
+    0x2A711513, 0x3AEF970F, 0x5C42445D, 0x3AEDD61C, 0x2A664D3F, 0x5C424571,
+    0x3B43B67A, 0x3AEDCE44, 0x3AD4AC6E, 0x3D554D42, 0x29B30A33, 0x3D3FAE6C,
+    0x3AFA976E, 0x3AE3075B, 0x2AC5B547, 0x3AEBF966, 0x4BC23F05, 0x3AE13C08,
+    0x3AEDCE63, 0x2A3074D8, 0x3AEE0668, 0x3AEBF967, 0x3AEF9B5C, 0x3A958DD5,
+    0x3B422F8A, 0x2A3078E7, 0x4ABC23AE, 0x3AD4AE0C, 0x4B614267, 0x4BCECEAF,
+    0x3AEBFABD, 0x29D6FAFB, 0x3AED4B06, 0x2A2B529C, 0x3AEDC4C6, 0x3AE1469B,
+    0x3AE41A1F, 0x3F5702CA, 0x2A178A5D, 0x3AEBFAAC, 0x18E96473, 0x3AEDD771,
+    0x4BC23E0F, 0x5C9A3A9D, 0x3AEC02DB, 0x2AC3E303, 0x3AFC29C2, 0x4BD1E3D4,
+    0x3AEDCF44, 0x39E5E20E, 0x4B5534A7, 0x2EE546CF, 0x2A2D277A, 0x3AE13E36,
+    0x2A3028A2, 0x387B3ED0, 0x3AE41A1A, 0x5C8F33D5, 0x2ABAE68C, 0x3AD4AAF0,
+    0x3AD4EDFC, 0x362011D5, 0x3B422E0A, 0x3AFBA613, 0x3D477D1C, 0x495C40E2,
+    0x4B52F079, 0x2A64BBAA, 0x3AEDCF9A, 0x3AE2BDDA, 0x3B460ECD, 0x3AED4AF8,
+    0x4BCECEA2, 0x3AE13BFA, 0x3AEBFD0D, 0x1B4F5418, 0x3B3B00FC, 0x3AEF985E,
+    0x3AE13DAC, 0x4E399983, 0x2A302C32, 0x08C111B0, 0x3AEF9F3D, 0x3AEDC4CA,
+    0x4BC442C4, 0x2A15B919, 0x2A3073BF, 0x3AEC0285, 0x3A95D7A6, 0x3AEE191B,
+    0x3F654CA0, 0x4B614501, 0x3AEDFBD7, 0x3AEFA2DB, 0x5E422F75, 0x3AFA54BC,
+    0x3AFB9E2B, 0x362011DA, 0x3AED9491, 0x3AEDCE5E, 0x3AE13C12, 0x36056F6C,
+    0x3B504B05, 0x361E5900, 0x361E512C, 0x2C7F59C1, 0x3AEF8839, 0x5BEBE1A9,
+    0x3AEDFBE5, 0x5A93B6E4, 0x3ADF7180, 0x3AE30775, 0x361380F8, 0x3D4ABEDF,
+    0x3B458498, 0x3AEE4D9C, 0x27BA9978, 0x3AEDCD00, 0x2A307213, 0x4BC23F12,
+    0x3AD4AC71, 0x386CECFE, 0x37C9A1FA, 0x3AED8C99, 0x3AEDCD4D, 0x29D6FCC4,
+    0x16D997D7, 0x3D3C2CB7, 0x3AEC449B, 0x37E0DD9E, 0x3AEF8F30, 0x3AD4EDF0,
+    0x2A30722E, 0x3AEFA330, 0x38793C5B, 0x3A97999B, 0x3AEDD828, 0x2A64BC9D,
+    0x361E4E54, 0x3D3CAA8A, 0x3D3C29EF, 0x37D6201A, 0x4BC452FF, 0x3AD4AC60,
+    0x3AFA9769, 0x4C1A2B73, 0x3AED4AE7, 0x2A62B76C, 0x4C675C6D, 0x36056F61,
+    0x3B392EBF, 0x3AEDCD5A, 0x3D45A70F, 0x3B45B905, 0x3B91297B, 0x3AEDC681,
+    0x4BC2BF9B, 0x3AEC42EE, 0x3B4CF1F5, 0x5F00391D, 0x361E4FA6, 0x2A181535,
+    0x3AF16567, 0x361E9087, 0x4BCD0332, 0x4BC23E0E
+};
+
+static const unsigned char bookMoves[BOOK_ENTRIES] =
+{
+    0x05, 0x33, 0x1A, 0x35, 0x29, 0x1A, 0x08, 0x2A, 0x03, 0x05, 0x19, 0x09,
+    0x0B, 0x02, 0x27, 0x19, 0x09, 0x0B, 0x15, 0x03, 0x0B, 0x03, 0x08, 0x1A,
+    0x09, 0x08, 0x0A, 0x08, 0x26, 0x0B, 0x1A, 0x3A, 0x1A, 0x03, 0x09, 0x04,
+    0x15, 0x15, 0x33, 0x39, 0x1A, 0x36, 0x3B, 0x23, 0x03, 0x13, 0x18, 0x0A,
+    0x19, 0x3A, 0x0B, 0x39, 0x37, 0x2A, 0x1A, 0x06, 0x0B, 0x13, 0x03, 0x05,
+    0x27, 0x24, 0x1A, 0x06, 0x0B, 0x17, 0x26, 0x0A, 0x08, 0x07, 0x06, 0x0B,
+    0x09, 0x18, 0x09, 0x0A, 0x08, 0x18, 0x07, 0x28, 0x25, 0x05, 0x03, 0x3A,
+    0x13, 0x1A, 0x04, 0x3A, 0x1A, 0x2A, 0x05, 0x13, 0x22, 0x05, 0x23, 0x03,
+    0x0A, 0x17, 0x36, 0x0A, 0x03, 0x0A, 0x12, 0x0B, 0x33, 0x07, 0x18, 0x04,
+    0x06, 0x38, 0x34, 0x14, 0x16, 0x0B, 0x0A, 0x09, 0x14, 0x17, 0x0A, 0x17,
+    0x06, 0x16, 0x0A, 0x17, 0x03, 0x15, 0x1A, 0x0B, 0x07, 0x08, 0x13, 0x17,
+    0x0A, 0x04, 0x09, 0x15, 0x38, 0x1A, 0x03, 0x18, 0x0B, 0x0A, 0x0A, 0x2A,
+    0x07, 0x18, 0x0B, 0x07, 0x17, 0x06, 0x0B, 0x1A, 0x13, 0x28, 0x0B, 0x23,
+    0x16, 0x0B, 0x08, 0x03, 0x0B, 0x15, 0x34, 0x06, 0x29, 0x26, 0x08, 0x06,
+    0x07, 0x14, 0x0B, 0x0B, 0x18, 0x13, 0x17, 0x14, 0x0B, 0x12, 0x0A, 0x3A,
+    0x14, 0x03, 0x05, 0x1A, 0x39, 0x0A, 0x04, 0x0B, 0x38, 0x09, 0x07, 0x0A,
+    0x23, 0x03, 0x04, 0x0A, 0x0A, 0x16, 0x3A, 0x27, 0x08, 0x0A, 0x29, 0x0A,
+    0x16, 0x06, 0x07, 0x0A, 0x08, 0x0A, 0x26, 0x0B, 0x16, 0x13, 0x17, 0x3A,
+    0x13, 0x0B, 0x19, 0x08, 0x14, 0x25, 0x08, 0x03, 0x03, 0x09, 0x04, 0x03,
+    0x06, 0x18, 0x15, 0x09, 0x19, 0x18, 0x04, 0x1A, 0x13, 0x16, 0x17, 0x29,
+    0x33, 0x17, 0x3A, 0x08, 0x13, 0x09, 0x18, 0x06, 0x0B, 0x14, 0x1A, 0x0A,
+    0x26, 0x16, 0x0A, 0x34, 0x17, 0x2A, 0x13, 0x0B, 0x3A, 0x0B, 0x13, 0x13,
+    0x06, 0x18, 0x1A, 0x07, 0x08, 0x16, 0x13, 0x14, 0x03, 0x22, 0x09, 0x1A,
+    0x05, 0x16, 0x17, 0x0B, 0x03, 0x39, 0x19, 0x05, 0x25, 0x24, 0x13, 0x08,
+    0x17, 0x06, 0x03, 0x06, 0x0B, 0x03, 0x18, 0x14, 0x06, 0x08, 0x06, 0x0B,
+    0x05, 0x13, 0x25, 0x18, 0x0B, 0x2A, 0x06, 0x14, 0x19, 0x07, 0x03, 0x0B,
+    0x27, 0x0B, 0x07, 0x06, 0x07, 0x06, 0x19, 0x0A, 0x07, 0x04, 0x1A, 0x39,
+    0x17, 0x15, 0x05, 0x13, 0x07, 0x07, 0x07, 0x17, 0x0A, 0x38, 0x0A, 0x06,
+    0x0B, 0x07, 0x26, 0x0B, 0x18, 0x16, 0x36, 0x09, 0x33, 0x07, 0x06, 0x04,
+    0x0B, 0x0B, 0x13, 0x23, 0x17, 0x24, 0x14, 0x28, 0x04, 0x38, 0x06, 0x28,
+    0x05, 0x08, 0x0B, 0x06, 0x3A, 0x15, 0x04, 0x15, 0x28, 0x03, 0x1A, 0x07,
+    0x17, 0x0A, 0x1A, 0x13, 0x0B, 0x29, 0x03, 0x0A, 0x06, 0x0B, 0x39, 0x14,
+    0x17, 0x16, 0x33, 0x09, 0x0A, 0x2A, 0x09, 0x19, 0x18, 0x07, 0x38, 0x15,
+    0x07, 0x13, 0x22, 0x03, 0x12, 0x1A, 0x0B, 0x0A, 0x03, 0x06, 0x08, 0x18,
+    0x0B, 0x16, 0x04, 0x0A, 0x08, 0x17, 0x15, 0x13, 0x08, 0x04, 0x03, 0x0A,
+    0x02, 0x04, 0x15, 0x19, 0x3A, 0x38, 0x2A, 0x1A, 0x16, 0x39, 0x0A, 0x05,
+    0x1A, 0x19, 0x06, 0x28, 0x13, 0x2A, 0x38, 0x05, 0x23, 0x09, 0x03, 0x03,
+    0x0B, 0x16, 0x3A, 0x07, 0x23, 0x0A, 0x25, 0x09, 0x03, 0x13, 0x03, 0x0B,
+    0x03, 0x0B, 0x07, 0x0A, 0x16, 0x09, 0x0B, 0x05, 0x15, 0x1A, 0x08, 0x09,
+    0x0A, 0x27, 0x15, 0x0B, 0x12, 0x0B, 0x04, 0x3A, 0x0B, 0x06, 0x08, 0x2A,
+    0x15, 0x17, 0x04, 0x12, 0x27, 0x03, 0x19, 0x09, 0x15, 0x0B, 0x07, 0x28,
+    0x39, 0x18, 0x18, 0x3A, 0x1A, 0x35, 0x29, 0x12, 0x04, 0x13, 0x13, 0x29,
+    0x08, 0x06, 0x15, 0x19, 0x37, 0x14, 0x0B, 0x1A, 0x23, 0x02, 0x0B, 0x09,
+    0x3A, 0x05, 0x14, 0x0A, 0x03, 0x09, 0x12, 0x2A, 0x12, 0x16, 0x0A, 0x04,
+    0x13, 0x04, 0x15, 0x06, 0x09, 0x07, 0x0B, 0x22, 0x02, 0x08, 0x03, 0x07,
+    0x2A, 0x08, 0x04, 0x05, 0x1A, 0x22, 0x0B, 0x3A, 0x08, 0x18, 0x09, 0x05,
+    0x1A, 0x03, 0x19, 0x0A, 0x15, 0x35, 0x09, 0x39, 0x17, 0x18, 0x06, 0x39,
+    0x04, 0x29, 0x06, 0x14, 0x12, 0x03, 0x0B, 0x08, 0x0B, 0x3A, 0x06, 0x29,
+    0x05, 0x1A, 0x2A, 0x0B, 0x09, 0x06, 0x18, 0x19, 0x0A, 0x1A, 0x0A, 0x1A,
+    0x15, 0x09, 0x06, 0x33, 0x09, 0x35, 0x25, 0x04, 0x13, 0x04, 0x19, 0x1A,
+    0x06, 0x03, 0x3A, 0x07, 0x08, 0x13, 0x09, 0x28, 0x15, 0x03, 0x0B, 0x1A,
+    0x07, 0x13, 0x13, 0x18, 0x18, 0x09, 0x04, 0x02, 0x13, 0x3B, 0x28, 0x06,
+    0x12, 0x17, 0x2A, 0x04, 0x08, 0x03, 0x1A, 0x08, 0x07, 0x19, 0x15, 0x19,
+    0x0B, 0x36, 0x33, 0x1A, 0x02, 0x0B, 0x2A, 0x02, 0x28, 0x0B, 0x17, 0x07,
+    0x03, 0x1A, 0x07, 0x19, 0x17, 0x02, 0x16, 0x18, 0x07, 0x26, 0x0A, 0x17,
+    0x34, 0x19, 0x09, 0x0A, 0x03, 0x38, 0x13, 0x0B, 0x03, 0x18, 0x26, 0x08,
+    0x03, 0x03, 0x36, 0x19, 0x0A, 0x03, 0x25, 0x12, 0x09, 0x0A, 0x38, 0x09,
+    0x04, 0x02, 0x13, 0x19, 0x14, 0x2A, 0x07, 0x16, 0x33, 0x03, 0x19, 0x18,
+    0x18, 0x1A, 0x03, 0x03, 0x03, 0x1A, 0x09, 0x17, 0x12, 0x17, 0x09, 0x13,
+    0x02, 0x1A, 0x18, 0x17, 0x1A, 0x18, 0x07, 0x22, 0x16, 0x07, 0x0B, 0x04,
+    0x08, 0x19, 0x09, 0x13, 0x06, 0x13, 0x07, 0x22, 0x07, 0x13, 0x17, 0x03,
+    0x15, 0x23, 0x04, 0x08, 0x33, 0x08, 0x03, 0x04, 0x08, 0x38, 0x15, 0x12,
+    0x14, 0x3A, 0x17, 0x02, 0x0B, 0x19, 0x05, 0x08, 0x13, 0x03, 0x04, 0x3A,
+    0x28, 0x07, 0x24, 0x18, 0x16, 0x38, 0x03, 0x07, 0x37, 0x08, 0x08, 0x08,
+    0x0B, 0x08, 0x02, 0x13, 0x04, 0x03, 0x17, 0x39, 0x17, 0x04, 0x06, 0x04,
+    0x13, 0x14, 0x08, 0x17, 0x16, 0x15, 0x3A, 0x07, 0x08, 0x0A, 0x03, 0x04,
+    0x1A, 0x0A, 0x03, 0x04, 0x09, 0x04, 0x18, 0x17, 0x03, 0x06, 0x03, 0x05,
+    0x1A, 0x39, 0x19, 0x19, 0x0B, 0x12, 0x12, 0x08, 0x07, 0x06, 0x08, 0x3A,
+    0x19, 0x1A, 0x13, 0x16, 0x0B, 0x16, 0x08, 0x18, 0x18, 0x13, 0x0A, 0x05,
+    0x34, 0x15, 0x17, 0x13, 0x06, 0x15, 0x17, 0x3A, 0x0B, 0x16, 0x0B, 0x0B,
+    0x18, 0x1A, 0x03, 0x3A, 0x03, 0x07, 0x08, 0x0B, 0x0A, 0x14, 0x0A, 0x1A,
+    0x39, 0x03, 0x1A, 0x09, 0x36, 0x0B, 0x09, 0x0B, 0x15, 0x0B, 0x04, 0x05,
+    0x33, 0x17, 0x1A, 0x08, 0x1A, 0x04, 0x03, 0x07, 0x0B, 0x17, 0x03, 0x02,
+    0x09, 0x06, 0x08, 0x36, 0x1A, 0x33, 0x07, 0x0B, 0x18, 0x1A, 0x29, 0x08,
+    0x03, 0x22, 0x09, 0x1A, 0x07, 0x23, 0x0B, 0x18, 0x0B, 0x0B, 0x2A, 0x19,
+    0x06, 0x0A, 0x26, 0x06, 0x09, 0x07, 0x0A, 0x12, 0x03, 0x0A, 0x26, 0x05,
+    0x09, 0x09, 0x03, 0x16, 0x08, 0x18, 0x03, 0x27, 0x0A, 0x3A, 0x06, 0x06,
+    0x0B, 0x09, 0x0B, 0x0B, 0x17, 0x3A, 0x12, 0x07, 0x05, 0x07, 0x0B, 0x0A,
+    0x19, 0x0A, 0x2A, 0x04, 0x38, 0x19, 0x23, 0x25, 0x07, 0x2A, 0x29, 0x03,
+    0x16, 0x2A, 0x38, 0x1A, 0x08, 0x17, 0x03, 0x02, 0x0B, 0x36, 0x0B, 0x25,
+    0x1A, 0x18, 0x17, 0x37, 0x3A, 0x08, 0x03, 0x03, 0x3A, 0x06, 0x36, 0x18,
+    0x0B, 0x29, 0x09, 0x3A, 0x1A, 0x27, 0x0A, 0x03, 0x15, 0x08, 0x04, 0x02,
+    0x04, 0x07, 0x06, 0x08, 0x07, 0x0B, 0x33, 0x0B, 0x2A, 0x0A, 0x09, 0x03,
+    0x05, 0x0B, 0x2A, 0x2A, 0x13, 0x13, 0x0A, 0x36, 0x0B, 0x13, 0x15, 0x08,
+    0x12, 0x1A, 0x13, 0x06, 0x06, 0x06, 0x09, 0x0B, 0x1A, 0x07, 0x19, 0x03,
+    0x15, 0x34, 0x3A, 0x09, 0x38, 0x0B, 0x09, 0x1A, 0x35, 0x04, 0x15, 0x3A,
+    0x17, 0x0B, 0x03, 0x03, 0x0A, 0x0B, 0x3A, 0x26, 0x19, 0x16, 0x03, 0x0B,
+    0x07, 0x19, 0x06, 0x03, 0x05, 0x13, 0x09, 0x0A, 0x02, 0x07, 0x13, 0x2A,
+    0x0B, 0x0A, 0x12, 0x2A, 0x33, 0x07, 0x15, 0x29, 0x03, 0x19, 0x17, 0x19,
+    0x0B, 0x09, 0x3A, 0x03, 0x17, 0x23, 0x13, 0x18, 0x0B, 0x06, 0x06, 0x09,
+    0x13, 0x17, 0x07, 0x13, 0x03, 0x25, 0x07, 0x09, 0x0B, 0x2A, 0x22, 0x33,
+    0x2A, 0x02, 0x03, 0x04, 0x24, 0x29, 0x03, 0x24, 0x07, 0x3A, 0x09, 0x09,
+    0x04, 0x03, 0x18, 0x23, 0x03, 0x13, 0x22, 0x06, 0x03, 0x04, 0x09, 0x03,
+    0x16, 0x0B, 0x06, 0x38, 0x29, 0x09, 0x02, 0x2A, 0x02, 0x09, 0x09, 0x06,
+    0x02, 0x37, 0x02, 0x07, 0x02, 0x15, 0x18, 0x03, 0x16, 0x1A, 0x3A, 0x06,
+    0x34, 0x02, 0x1A, 0x0A, 0x05, 0x06, 0x07, 0x15, 0x08, 0x07, 0x06, 0x33,
+    0x03, 0x08, 0x16, 0x3A, 0x12, 0x04, 0x0B, 0x09, 0x08, 0x06, 0x34, 0x37,
+    0x34, 0x1A, 0x17, 0x19, 0x12, 0x05, 0x1A, 0x33, 0x0A, 0x36, 0x3A, 0x16,
+    0x13, 0x1A, 0x29, 0x02, 0x13, 0x0B, 0x3A, 0x05, 0x33, 0x08, 0x06, 0x16,
+    0x29, 0x07, 0x0B, 0x25, 0x09, 0x3A, 0x08, 0x07, 0x1A, 0x33, 0x09, 0x3A,
+    0x19, 0x33, 0x18, 0x15, 0x2A, 0x24, 0x09, 0x37, 0x37, 0x0A, 0x08, 0x24,
+    0x18, 0x06, 0x34, 0x15, 0x16, 0x35, 0x05, 0x38, 0x2A, 0x07, 0x28, 0x13,
+    0x07, 0x3A, 0x04, 0x03, 0x03, 0x04, 0x18, 0x05, 0x0B, 0x17, 0x1A, 0x05,
+    0x13, 0x16, 0x19, 0x16, 0x03, 0x0B, 0x08, 0x03, 0x33, 0x13, 0x18, 0x04,
+    0x13, 0x3A, 0x3A, 0x1A, 0x13, 0x04, 0x03, 0x0B, 0x1A, 0x18, 0x04, 0x02,
+    0x22, 0x04, 0x17, 0x16, 0x06, 0x13, 0x12, 0x09, 0x14, 0x08, 0x0B, 0x18,
+    0x26, 0x18, 0x0B, 0x08, 0x36, 0x03, 0x19, 0x03, 0x0B, 0x04, 0x34, 0x37,
+    0x0B, 0x15, 0x37, 0x19, 0x05, 0x14, 0x05, 0x03, 0x04, 0x03, 0x05, 0x19,
+    0x05, 0x0B, 0x1A, 0x03, 0x2A, 0x08, 0x2A, 0x09, 0x12, 0x3A, 0x1A, 0x38,
+    0x18, 0x09, 0x39, 0x19, 0x39, 0x1A, 0x1A, 0x36, 0x3A, 0x08, 0x0B, 0x07,
+    0x1A, 0x33, 0x17, 0x15, 0x03, 0x02, 0x23, 0x13, 0x08, 0x06, 0x38, 0x16,
+    0x13, 0x09, 0x04, 0x0B, 0x0B, 0x12, 0x08, 0x0B, 0x05, 0x37, 0x18, 0x0B,
+    0x18, 0x1A, 0x13, 0x1A, 0x07, 0x0B, 0x38, 0x04, 0x14, 0x06, 0x03, 0x08,
+    0x29, 0x13, 0x0B, 0x15, 0x39, 0x13, 0x0A, 0x14, 0x03, 0x0A, 0x04, 0x07,
+    0x04, 0x09, 0x2A, 0x08, 0x1A, 0x1A, 0x07, 0x03, 0x09, 0x0B, 0x05, 0x12,
+    0x08, 0x02, 0x03, 0x13, 0x04, 0x0A, 0x09, 0x04, 0x16, 0x0B, 0x0B, 0x18,
+    0x07, 0x07, 0x27, 0x04, 0x06, 0x13, 0x17, 0x34, 0x08, 0x38, 0x18, 0x0A,
+    0x09, 0x0B, 0x37, 0x38, 0x38, 0x0B, 0x04, 0x0B, 0x19, 0x0A, 0x03, 0x16,
+    0x0B, 0x15, 0x14, 0x23, 0x1A, 0x0B, 0x16, 0x08, 0x09, 0x08, 0x26, 0x0B,
+    0x13, 0x25, 0x28, 0x05, 0x03, 0x03, 0x0B, 0x15, 0x0B, 0x18, 0x03, 0x0B,
+    0x08, 0x04, 0x03, 0x09, 0x38, 0x05, 0x13, 0x19, 0x09, 0x16, 0x07, 0x19,
+    0x04, 0x05, 0x04, 0x18, 0x02, 0x37, 0x18, 0x33, 0x24, 0x06, 0x16, 0x2A,
+    0x05, 0x02, 0x1A, 0x07, 0x1A, 0x02, 0x0B, 0x09, 0x0A, 0x06, 0x04, 0x0A,
+    0x27, 0x04, 0x0B, 0x18, 0x17, 0x09, 0x09, 0x06, 0x07, 0x04, 0x13, 0x19,
+    0x24, 0x0A, 0x08, 0x03, 0x28, 0x16, 0x08, 0x08, 0x04, 0x05, 0x06, 0x0B,
+    0x17, 0x28, 0x0B, 0x35, 0x03, 0x38, 0x07, 0x08, 0x04, 0x05, 0x06, 0x22,
+    0x12, 0x33, 0x16, 0x13, 0x2A, 0x0B, 0x12, 0x03, 0x1A, 0x1A, 0x06, 0x18,
+    0x19, 0x19, 0x05, 0x22, 0x19, 0x05, 0x07, 0x27, 0x14, 0x2A, 0x18, 0x1A,
+    0x13, 0x04, 0x13, 0x0B, 0x08, 0x15, 0x19, 0x06, 0x27, 0x33, 0x09, 0x05,
+    0x03, 0x0A, 0x0B, 0x12, 0x13, 0x19, 0x02, 0x0B, 0x09, 0x19, 0x09, 0x2A,
+    0x08, 0x18, 0x08, 0x17, 0x0B, 0x06, 0x15, 0x18, 0x38, 0x34, 0x18, 0x13,
+    0x36, 0x17, 0x05, 0x09, 0x04, 0x09, 0x19, 0x14, 0x39, 0x17, 0x09, 0x15,
+    0x03, 0x09, 0x02, 0x03, 0x2A, 0x04, 0x17, 0x14, 0x06, 0x28, 0x0B, 0x0B,
+    0x0B, 0x17, 0x08, 0x02, 0x33, 0x08, 0x06, 0x24, 0x04, 0x0B, 0x19, 0x12,
+    0x0B, 0x09, 0x18, 0x05, 0x05, 0x13, 0x25, 0x08, 0x16, 0x1A, 0x09, 0x17,
+    0x08, 0x1A, 0x0B, 0x13, 0x0B, 0x16, 0x06, 0x08, 0x19, 0x2A, 0x3A, 0x05,
+    0x16, 0x0A, 0x36, 0x03, 0x16, 0x04, 0x06, 0x19, 0x04, 0x03, 0x2A, 0x3A,
+    0x13, 0x19, 0x08, 0x07, 0x0B, 0x03, 0x18, 0x3A, 0x07, 0x02, 0x2A, 0x0A,
+    0x13, 0x0A, 0x19, 0x06, 0x02, 0x13, 0x06, 0x38, 0x0B, 0x33, 0x0B, 0x2A,
+    0x0A, 0x06, 0x05, 0x08, 0x07, 0x07, 0x0A, 0x09, 0x0B, 0x08, 0x17, 0x04,
+    0x18, 0x2A, 0x0A, 0x04, 0x07, 0x2A, 0x05, 0x04, 0x0B, 0x08, 0x05, 0x17,
+    0x13, 0x16, 0x18, 0x33, 0x05, 0x03, 0x16, 0x13, 0x09, 0x0B, 0x26, 0x1A,
+    0x37, 0x13, 0x2A, 0x13, 0x33, 0x06, 0x08, 0x3A, 0x04, 0x17, 0x19, 0x16,
+    0x13, 0x26, 0x02, 0x08, 0x08, 0x19, 0x19, 0x02, 0x0A, 0x03, 0x34, 0x0A,
+    0x1A, 0x18, 0x0B, 0x17, 0x18, 0x0A, 0x07, 0x19, 0x1A, 0x08, 0x0B, 0x0B,
+    0x03, 0x0B, 0x0A, 0x0B, 0x0A, 0x08, 0x09, 0x03, 0x17, 0x07, 0x19, 0x08,
+    0x03, 0x02, 0x08, 0x29, 0x09, 0x06, 0x19, 0x07, 0x34, 0x35, 0x38, 0x0A,
+    0x2A, 0x33, 0x07, 0x0B, 0x28, 0x0B, 0x03, 0x18, 0x16, 0x06, 0x07, 0x23,
+    0x0A, 0x33, 0x05, 0x36, 0x04, 0x06, 0x0A, 0x23, 0x25, 0x0A, 0x15, 0x07,
+    0x24, 0x07, 0x17, 0x13, 0x1A, 0x08, 0x15, 0x03, 0x0B, 0x08, 0x05, 0x39,
+    0x18, 0x07, 0x05, 0x08, 0x39, 0x0A, 0x0A, 0x0B, 0x16, 0x13, 0x0A, 0x1A,
+    0x15, 0x07, 0x35, 0x06, 0x0B, 0x03, 0x08, 0x08, 0x35, 0x03, 0x15, 0x39,
+    0x34, 0x13, 0x38, 0x3A, 0x06, 0x23, 0x13, 0x0B, 0x06, 0x09, 0x38, 0x13,
+    0x07, 0x17, 0x33, 0x36, 0x22, 0x06, 0x0B, 0x09, 0x09, 0x0A, 0x04, 0x03,
+    0x1A, 0x0B, 0x19, 0x08, 0x0B, 0x15, 0x18, 0x3A, 0x08, 0x2A, 0x19, 0x2A,
+    0x03, 0x0A, 0x07, 0x0B, 0x13, 0x05, 0x05, 0x12, 0x13, 0x09, 0x1A, 0x0B,
+    0x05, 0x25, 0x19, 0x24, 0x0B, 0x38, 0x07, 0x1A, 0x0A, 0x23, 0x24, 0x03,
+    0x1A, 0x0A, 0x0A, 0x16, 0x19, 0x2A, 0x04, 0x09, 0x04, 0x18, 0x0A, 0x0B,
+    0x0A, 0x1A, 0x15, 0x17, 0x08, 0x27, 0x12, 0x03, 0x03, 0x05, 0x13, 0x15,
+    0x0B, 0x04, 0x38, 0x07, 0x08, 0x0A, 0x19, 0x17, 0x18, 0x0B, 0x17, 0x06,
+    0x23, 0x33, 0x05, 0x0A, 0x0B, 0x17, 0x35, 0x16, 0x0B, 0x08, 0x0A, 0x07,
+    0x2A, 0x26, 0x0B, 0x18, 0x17, 0x08, 0x06, 0x16, 0x28, 0x3A, 0x09, 0x13,
+    0x08, 0x19, 0x04, 0x17, 0x1A, 0x02, 0x19, 0x17, 0x19, 0x17, 0x08, 0x34,
+    0x03, 0x03, 0x0B, 0x14, 0x15, 0x19, 0x19, 0x04, 0x12, 0x03, 0x19, 0x0B,
+    0x04, 0x07, 0x22, 0x33, 0x12, 0x0B, 0x13, 0x36, 0x28, 0x12, 0x19, 0x03,
+    0x18, 0x34, 0x04, 0x18, 0x26, 0x18, 0x1A, 0x33, 0x2A, 0x1A, 0x2A, 0x06,
+    0x04, 0x12, 0x12, 0x07, 0x0B, 0x04, 0x0B, 0x09, 0x03, 0x13, 0x07, 0x14,
+    0x38, 0x25, 0x16, 0x13, 0x3A, 0x15, 0x07, 0x1A, 0x07, 0x0B, 0x26, 0x19,
+    0x08, 0x09, 0x08, 0x08, 0x03, 0x03, 0x07, 0x05, 0x1A, 0x0A, 0x18, 0x16,
+    0x18, 0x18, 0x07, 0x09, 0x22, 0x08, 0x0B, 0x37, 0x17, 0x0B, 0x08, 0x2A,
+    0x36, 0x05, 0x0A, 0x06, 0x15, 0x3A, 0x07, 0x07, 0x37, 0x33, 0x33, 0x17,
+    0x1A, 0x0A, 0x18, 0x02, 0x06, 0x0B, 0x17, 0x07, 0x0A, 0x03, 0x05, 0x0B,
+    0x07, 0x09, 0x0A, 0x2A, 0x05, 0x16, 0x07, 0x2A, 0x15, 0x0B, 0x0B, 0x24,
+    0x1A, 0x0B, 0x1A, 0x06, 0x03, 0x0B, 0x08, 0x33, 0x03, 0x0A, 0x2A, 0x09,
+    0x33, 0x36, 0x0B, 0x18, 0x09, 0x06, 0x0B, 0x13, 0x3A, 0x37, 0x14, 0x04,
+    0x04, 0x19, 0x28, 0x14, 0x39, 0x18, 0x09, 0x06, 0x34, 0x07, 0x3A, 0x05,
+    0x34, 0x08, 0x04, 0x08, 0x28, 0x33, 0x0B, 0x14, 0x18, 0x08, 0x04, 0x14,
+    0x1A, 0x14, 0x12, 0x0B, 0x09, 0x12, 0x19, 0x05, 0x04, 0x1A, 0x04, 0x33,
+    0x02, 0x0B, 0x38, 0x23, 0x08, 0x03, 0x06, 0x07, 0x08, 0x19, 0x09, 0x0A,
+    0x04, 0x23, 0x06, 0x15, 0x27, 0x05, 0x17, 0x04, 0x36, 0x2A, 0x08, 0x0A,
+    0x0B, 0x07, 0x09, 0x18, 0x07, 0x17, 0x1A, 0x13, 0x27, 0x08, 0x08, 0x1A,
+    0x27, 0x09, 0x07, 0x03, 0x1A, 0x1A, 0x13, 0x27, 0x24, 0x07, 0x0B, 0x08,
+    0x38, 0x16, 0x0B, 0x13, 0x08, 0x07, 0x24, 0x15, 0x2A, 0x0B, 0x0A, 0x38,
+    0x03, 0x0A, 0x03, 0x03, 0x39, 0x09, 0x03, 0x08, 0x1A, 0x14, 0x04, 0x09,
+    0x02, 0x17, 0x04, 0x0B, 0x03, 0x0B, 0x09, 0x34, 0x16, 0x08, 0x33, 0x37,
+    0x25, 0x16, 0x36, 0x18, 0x0B, 0x17, 0x04, 0x37, 0x15, 0x36, 0x09, 0x08,
+    0x0B, 0x04, 0x02, 0x02, 0x16, 0x07, 0x1A, 0x08, 0x29, 0x08, 0x09, 0x33,
+    0x19, 0x16, 0x28, 0x06, 0x06, 0x0B, 0x18, 0x04, 0x1A, 0x13, 0x17, 0x08,
+    0x0A, 0x13, 0x1A, 0x3A, 0x09, 0x0B, 0x19, 0x09, 0x3A, 0x18, 0x07, 0x09,
+    0x09, 0x0B, 0x06, 0x0A, 0x19, 0x04, 0x1A, 0x05, 0x0A, 0x0B, 0x07, 0x07,
+    0x12, 0x07, 0x0B, 0x0B, 0x04, 0x06, 0x02, 0x08, 0x17, 0x24, 0x06, 0x0A,
+    0x0A, 0x06, 0x12, 0x17, 0x04, 0x15, 0x08, 0x08, 0x02, 0x02, 0x28, 0x14,
+    0x03, 0x08, 0x19, 0x09, 0x06, 0x03, 0x0A, 0x39, 0x06, 0x25, 0x0B, 0x09,
+    0x13, 0x06, 0x0B, 0x09, 0x38, 0x27, 0x06, 0x06, 0x3A, 0x08, 0x0A, 0x0B,
+    0x33, 0x05, 0x0B, 0x26, 0x0B, 0x0A, 0x04, 0x03, 0x1A, 0x0A, 0x0A, 0x25,
+    0x04, 0x09, 0x23, 0x03, 0x28, 0x05, 0x36, 0x0A, 0x38, 0x0B, 0x18, 0x07,
+    0x17, 0x0A, 0x03, 0x06, 0x0B, 0x03, 0x18, 0x03, 0x03, 0x25, 0x0B, 0x19,
+    0x13, 0x16, 0x16, 0x1A, 0x27, 0x17, 0x17, 0x08, 0x09, 0x04, 0x03, 0x37,
+    0x0B, 0x15, 0x13, 0x0B, 0x04, 0x14, 0x04, 0x03, 0x2A, 0x1A, 0x08, 0x05,
+    0x37, 0x08, 0x15, 0x07, 0x05, 0x08, 0x18, 0x06, 0x18, 0x0B, 0x03, 0x33,
+    0x03, 0x0B, 0x0B, 0x1A, 0x19, 0x0B, 0x09, 0x23, 0x07, 0x0A, 0x26, 0x18,
+    0x04, 0x05, 0x0B, 0x09, 0x03, 0x0A, 0x03, 0x0B, 0x16, 0x25, 0x0B, 0x25,
+    0x13, 0x23, 0x1A, 0x04, 0x2A, 0x04, 0x28, 0x24, 0x13, 0x39, 0x04, 0x04,
+    0x17, 0x16, 0x18, 0x3A, 0x3A, 0x12, 0x05, 0x13, 0x0A, 0x06, 0x18, 0x39,
+    0x06, 0x16, 0x03, 0x06, 0x16, 0x04, 0x02, 0x12, 0x03, 0x03, 0x0A, 0x0B,
+    0x27, 0x3A, 0x12, 0x0A, 0x0A, 0x2A, 0x34, 0x25, 0x05, 0x03, 0x3A, 0x3A,
+    0x0A, 0x0B, 0x03, 0x03, 0x0B, 0x13, 0x19, 0x2A, 0x08, 0x15, 0x3A, 0x06,
+    0x2A, 0x08, 0x07, 0x18, 0x18, 0x07, 0x27, 0x1A, 0x09, 0x13, 0x16, 0x06,
+    0x07, 0x2A, 0x0B, 0x03, 0x13, 0x19, 0x1A, 0x12, 0x05, 0x3A, 0x2A, 0x07,
+    0x13, 0x35, 0x0A, 0x33, 0x06, 0x35, 0x1A, 0x26, 0x13, 0x0B, 0x2A, 0x03,
+    0x06, 0x0A, 0x09, 0x04, 0x08, 0x23, 0x09, 0x18, 0x18, 0x12, 0x15, 0x0A,
+    0x19, 0x06, 0x06, 0x0B, 0x0A, 0x03, 0x0B, 0x18, 0x04, 0x06, 0x0A, 0x0B,
+    0x03, 0x19, 0x07, 0x07, 0x03, 0x14, 0x2A, 0x08, 0x08, 0x1A, 0x0B, 0x06,
+    0x2A, 0x17, 0x13, 0x1A, 0x03, 0x0A, 0x04, 0x1A, 0x34, 0x06, 0x09, 0x19,
+    0x28, 0x03, 0x12, 0x14, 0x03, 0x15, 0x1A, 0x35, 0x16, 0x06, 0x03, 0x04,
+    0x14, 0x17, 0x14, 0x12, 0x07, 0x06, 0x06, 0x0A, 0x0A, 0x05, 0x18, 0x18,
+    0x13, 0x3A, 0x04, 0x36, 0x03, 0x07, 0x16, 0x08, 0x03, 0x17, 0x26, 0x08,
+    0x33, 0x04, 0x09, 0x04, 0x14, 0x08, 0x14, 0x37, 0x0A, 0x29, 0x1A, 0x03,
+    0x24, 0x0A, 0x0A, 0x33, 0x19, 0x34, 0x08, 0x0B, 0x17, 0x22, 0x0A, 0x05,
+    0x1A, 0x15, 0x2A, 0x05, 0x16, 0x0A, 0x06, 0x06, 0x09, 0x0A, 0x3A, 0x1A,
+    0x0A, 0x0B, 0x03, 0x1A, 0x13, 0x05, 0x25, 0x15, 0x24, 0x13, 0x0A, 0x08,
+    0x3A, 0x18, 0x15, 0x16, 0x05, 0x04, 0x0A, 0x33, 0x08, 0x07, 0x07, 0x0A,
+    0x13, 0x12, 0x0B, 0x18, 0x13, 0x0A, 0x09, 0x17, 0x33, 0x0B, 0x05, 0x02,
+    0x17, 0x15, 0x08, 0x07, 0x18, 0x09, 0x25, 0x24, 0x06, 0x26, 0x39, 0x09,
+    0x02, 0x06, 0x0B, 0x19, 0x18, 0x06, 0x03, 0x03, 0x16, 0x06, 0x39, 0x15,
+    0x0A, 0x04, 0x17, 0x04, 0x2A, 0x26, 0x28, 0x05, 0x04, 0x18, 0x06, 0x37,
+    0x03, 0x07, 0x04, 0x03, 0x08, 0x19, 0x08, 0x0A, 0x17, 0x07, 0x1A, 0x04,
+    0x0B, 0x17, 0x14, 0x33, 0x09, 0x05, 0x0B, 0x0B, 0x06, 0x02, 0x1A, 0x08,
+    0x13, 0x14, 0x09, 0x12, 0x0B, 0x08, 0x24, 0x0B, 0x36, 0x16, 0x14, 0x13,
+    0x3A, 0x03, 0x33, 0x2A, 0x16, 0x0B, 0x14, 0x09, 0x0A, 0x0B, 0x03, 0x15,
+    0x17, 0x2A, 0x0A, 0x07, 0x05, 0x08, 0x1A, 0x18, 0x3A, 0x34, 0x02, 0x09,
+    0x1A, 0x03, 0x1A, 0x13, 0x09, 0x12, 0x13, 0x17, 0x15, 0x15, 0x09, 0x09,
+    0x15, 0x0B, 0x09, 0x05, 0x13, 0x13, 0x1A, 0x07, 0x19, 0x28, 0x09, 0x28,
+    0x08, 0x03, 0x1A, 0x02, 0x0A, 0x03, 0x23, 0x07, 0x1A, 0x0A, 0x17, 0x3A,
+    0x08, 0x09, 0x04, 0x17, 0x07, 0x34, 0x13, 0x18, 0x0B, 0x13, 0x16, 0x0B,
+    0x0B, 0x3A, 0x07, 0x13, 0x18, 0x07, 0x02, 0x08, 0x28, 0x03, 0x19, 0x06,
+    0x03, 0x07, 0x0A, 0x27, 0x08, 0x04, 0x0A, 0x17, 0x04, 0x1A, 0x06, 0x14,
+    0x16, 0x05, 0x39, 0x27, 0x03, 0x08, 0x17, 0x19, 0x13, 0x19, 0x19, 0x3A,
+    0x06, 0x19, 0x37, 0x0B, 0x19, 0x06, 0x12, 0x18, 0x14, 0x06, 0x28, 0x19,
+    0x0A, 0x12, 0x1A, 0x2A, 0x0A, 0x03, 0x15, 0x03, 0x17, 0x37, 0x08, 0x03,
+    0x07, 0x3A, 0x14, 0x15, 0x0B, 0x17, 0x05, 0x13, 0x09, 0x38, 0x09, 0x04,
+    0x0B, 0x36, 0x03, 0x17, 0x17, 0x04, 0x15, 0x13, 0x0B, 0x03, 0x19, 0x19,
+    0x18, 0x38, 0x16, 0x13, 0x23, 0x03, 0x3A, 0x0A, 0x19, 0x14, 0x16, 0x04,
+    0x0B, 0x3A, 0x17, 0x0B, 0x08, 0x07, 0x37, 0x05, 0x18, 0x16, 0x12, 0x08,
+    0x27, 0x07, 0x18, 0x09, 0x39, 0x13, 0x08, 0x38, 0x25, 0x0A, 0x14, 0x0A,
+    0x03, 0x09, 0x17, 0x1A, 0x09, 0x07, 0x17, 0x03, 0x34, 0x14, 0x17, 0x06,
+    0x0B, 0x19, 0x22, 0x03, 0x38, 0x28, 0x0A, 0x27, 0x07, 0x0A, 0x05, 0x06,
+    0x0B, 0x3A, 0x03, 0x3A, 0x16, 0x03, 0x34, 0x05, 0x17, 0x1A, 0x15, 0x35,
+    0x0B, 0x23, 0x28, 0x03, 0x16, 0x03, 0x0A, 0x0B, 0x16, 0x19, 0x0B, 0x29,
+    0x0A, 0x16, 0x14, 0x19, 0x08, 0x19, 0x06, 0x14, 0x13, 0x23, 0x06, 0x06,
+    0x1A, 0x05, 0x07, 0x15, 0x02, 0x1A, 0x13, 0x38, 0x03, 0x07, 0x07, 0x13,
+    0x37, 0x09, 0x07, 0x18, 0x17, 0x06, 0x18, 0x3A, 0x16, 0x03, 0x13, 0x1A,
+    0x18, 0x1A, 0x03, 0x04, 0x06, 0x16, 0x13, 0x15, 0x0A, 0x08, 0x0A, 0x1A,
+    0x1A, 0x13, 0x0A, 0x0A, 0x0A, 0x17, 0x0B, 0x05, 0x18, 0x12, 0x13, 0x35,
+    0x0B, 0x03, 0x03, 0x36, 0x07, 0x39, 0x18, 0x12, 0x2A, 0x13, 0x2A, 0x3B,
+    0x12, 0x06, 0x1A, 0x25, 0x14, 0x12, 0x19, 0x03, 0x0B, 0x0B, 0x0B, 0x03,
+    0x38, 0x28, 0x18, 0x06, 0x34, 0x19, 0x03, 0x08, 0x18, 0x0B, 0x06, 0x16,
+    0x1A, 0x02, 0x03, 0x15, 0x37, 0x06, 0x17, 0x05, 0x16, 0x12, 0x05, 0x25,
+    0x23, 0x18, 0x04, 0x04, 0x25, 0x15, 0x03, 0x17, 0x18, 0x39, 0x0A, 0x0A,
+    0x18, 0x04, 0x02, 0x0B, 0x04, 0x06, 0x07, 0x0B, 0x13, 0x08, 0x29, 0x13,
+    0x13, 0x13, 0x0B, 0x0B, 0x0A, 0x0A, 0x1A, 0x13, 0x3A, 0x15, 0x04, 0x0B,
+    0x0B, 0x04, 0x0B, 0x17, 0x15, 0x19, 0x08, 0x08, 0x05, 0x08, 0x17, 0x08,
+    0x03, 0x19, 0x08, 0x19, 0x37, 0x2A, 0x02, 0x16, 0x09, 0x18, 0x15, 0x1A,
+    0x09, 0x1A, 0x1A, 0x07, 0x12, 0x14, 0x16, 0x0B, 0x1A, 0x0B, 0x07, 0x28,
+    0x04, 0x28, 0x07, 0x1A, 0x0B, 0x17, 0x24, 0x17, 0x04, 0x15, 0x04, 0x18,
+    0x17, 0x17, 0x38, 0x0B, 0x06, 0x33, 0x07, 0x0B, 0x0A, 0x25, 0x17, 0x12,
+    0x05, 0x05, 0x2A, 0x08, 0x14, 0x0B, 0x18, 0x18, 0x04, 0x13, 0x08, 0x03,
+    0x19, 0x0A, 0x3A, 0x07, 0x0B, 0x14, 0x13, 0x16, 0x16, 0x18, 0x17, 0x05,
+    0x0B, 0x08, 0x07, 0x0B, 0x03, 0x26, 0x05, 0x19, 0x0B, 0x07, 0x05, 0x34,
+    0x03, 0x04, 0x19, 0x13, 0x06, 0x12, 0x0A, 0x17, 0x08, 0x03, 0x27, 0x17,
+    0x0A, 0x13, 0x13, 0x13, 0x04, 0x17, 0x07, 0x13, 0x0B, 0x09, 0x0B, 0x04,
+    0x13, 0x04, 0x06, 0x0B, 0x0A, 0x27, 0x04, 0x07, 0x07, 0x08, 0x09, 0x0B,
+    0x19, 0x15, 0x07, 0x0A, 0x02, 0x04, 0x04, 0x17, 0x18, 0x05, 0x07, 0x09,
+    0x29, 0x09, 0x03, 0x08, 0x0B, 0x29, 0x08, 0x06, 0x0B, 0x19, 0x17, 0x03,
+    0x0B, 0x06, 0x3A, 0x13, 0x16, 0x17, 0x07, 0x08, 0x06, 0x08, 0x38, 0x17,
+    0x33, 0x39, 0x13, 0x0B, 0x06, 0x08, 0x05, 0x0B, 0x08, 0x07, 0x07, 0x04,
+    0x36, 0x07, 0x0A, 0x15, 0x13, 0x34, 0x1A, 0x03, 0x17, 0x0A, 0x27, 0x27,
+    0x08, 0x0B, 0x19, 0x25, 0x25, 0x34, 0x08, 0x28, 0x3A, 0x03, 0x0B, 0x09,
+    0x04, 0x0B, 0x0B, 0x1A, 0x34, 0x07, 0x34, 0x14, 0x17, 0x0A, 0x03, 0x04,
+    0x1A, 0x03, 0x18, 0x24, 0x2A, 0x09, 0x3A, 0x12, 0x24, 0x19, 0x02, 0x07,
+    0x03, 0x04, 0x03, 0x0B, 0x22, 0x25, 0x04, 0x0A, 0x17, 0x08, 0x07, 0x0B,
+    0x0A, 0x04, 0x17, 0x0A, 0x1A, 0x13, 0x3A, 0x08, 0x2A, 0x39, 0x12, 0x06,
+    0x33, 0x23, 0x0B, 0x0A, 0x12, 0x17, 0x08, 0x0B, 0x04, 0x04, 0x0B, 0x1A,
+    0x15, 0x39, 0x13, 0x0A, 0x15, 0x08, 0x12, 0x16, 0x18, 0x0A, 0x14, 0x37,
+    0x0A, 0x16, 0x03, 0x15, 0x3A, 0x03, 0x19, 0x1A, 0x16, 0x0B, 0x24, 0x07,
+    0x0A, 0x2A, 0x0B, 0x07, 0x25, 0x15, 0x27, 0x16, 0x18, 0x0A, 0x24, 0x15,
+    0x06, 0x13, 0x1A, 0x17, 0x0A, 0x07, 0x02, 0x15, 0x05, 0x03, 0x18, 0x19,
+    0x0B, 0x0B, 0x03, 0x16, 0x0A, 0x1A, 0x03, 0x08, 0x0A, 0x04, 0x08, 0x03,
+    0x26, 0x16, 0x35, 0x14, 0x12, 0x12, 0x0B, 0x19, 0x33, 0x02, 0x07, 0x3B,
+    0x09, 0x2A, 0x03, 0x09, 0x0B, 0x0A, 0x1A, 0x1A, 0x2A, 0x03, 0x1A, 0x05,
+    0x38, 0x03, 0x34, 0x15, 0x13, 0x0B, 0x05, 0x15, 0x0A, 0x15, 0x08, 0x07,
+    0x08, 0x04, 0x17, 0x14, 0x0B, 0x03, 0x09, 0x08, 0x22, 0x26, 0x34, 0x08,
+    0x13, 0x02, 0x25, 0x1A, 0x0A, 0x28, 0x1A, 0x15, 0x03, 0x1A, 0x03, 0x15,
+    0x16, 0x03, 0x16, 0x09, 0x0A, 0x03, 0x02, 0x26, 0x13, 0x36, 0x39, 0x06,
+    0x0B, 0x09, 0x29, 0x19, 0x12, 0x37, 0x0A, 0x35, 0x07, 0x16, 0x19, 0x15,
+    0x02, 0x08, 0x13, 0x04, 0x27, 0x36, 0x03, 0x36, 0x1A, 0x12, 0x3A, 0x09,
+    0x05, 0x24, 0x19, 0x08, 0x09, 0x1A, 0x2A, 0x3A, 0x36, 0x1A, 0x17, 0x3B,
+    0x17, 0x04, 0x0B, 0x03, 0x28, 0x19, 0x13, 0x03, 0x05, 0x2A, 0x1A, 0x05,
+    0x2A, 0x05, 0x0A, 0x36, 0x0B, 0x13, 0x0A, 0x19, 0x2A, 0x03, 0x09, 0x12,
+    0x39, 0x03, 0x03, 0x08, 0x09, 0x26, 0x34, 0x1A, 0x07, 0x08, 0x07, 0x13,
+    0x03, 0x15, 0x2A, 0x17, 0x08, 0x13, 0x06, 0x1A, 0x17, 0x04, 0x27, 0x08,
+    0x33, 0x0A, 0x06, 0x16, 0x07, 0x26, 0x17, 0x0B, 0x06, 0x03, 0x3B, 0x09,
+    0x08, 0x1A, 0x04, 0x12, 0x07, 0x04, 0x06, 0x06, 0x1A, 0x09, 0x0B, 0x1A,
+    0x04, 0x16, 0x04, 0x0B, 0x35, 0x06, 0x09, 0x0A, 0x1A, 0x08, 0x22, 0x06,
+    0x08, 0x2A, 0x13, 0x06, 0x0A, 0x14, 0x38, 0x38, 0x16, 0x23, 0x07, 0x23,
+    0x12, 0x0B, 0x09, 0x03, 0x12, 0x34, 0x19, 0x04, 0x16, 0x0B, 0x04, 0x04,
+    0x14, 0x09, 0x0A, 0x17, 0x3A, 0x13, 0x1A, 0x09, 0x17, 0x04, 0x18, 0x06,
+    0x04, 0x19, 0x0B, 0x39, 0x0B, 0x08, 0x09, 0x0A, 0x17, 0x1A, 0x33, 0x2A,
+    0x07, 0x08, 0x0B, 0x12, 0x17, 0x07, 0x0A, 0x13, 0x33, 0x13, 0x0B, 0x06,
+    0x2A, 0x0B, 0x09, 0x15, 0x13, 0x29, 0x15, 0x02, 0x06, 0x0B, 0x06, 0x07,
+    0x0A, 0x07, 0x13, 0x19, 0x05, 0x03, 0x15, 0x1A, 0x17, 0x0B, 0x03, 0x0B,
+    0x3A, 0x13, 0x0B, 0x08, 0x0B, 0x04, 0x19, 0x24, 0x1A, 0x1A, 0x2A, 0x06,
+    0x26, 0x05, 0x08, 0x2A, 0x0A, 0x14, 0x16, 0x19, 0x04, 0x0B, 0x0A, 0x0A,
+    0x08, 0x14, 0x04, 0x0B, 0x03, 0x23, 0x17, 0x03, 0x13, 0x18, 0x2A, 0x19,
+    0x08, 0x03, 0x04, 0x19, 0x02, 0x15, 0x0B, 0x07, 0x25, 0x0B, 0x0B, 0x14,
+    0x18, 0x14, 0x18, 0x09, 0x02, 0x0A, 0x08, 0x0A, 0x08, 0x0B, 0x04, 0x0B,
+    0x16, 0x29, 0x33, 0x14, 0x0A, 0x07, 0x19, 0x27, 0x09, 0x38, 0x12, 0x0A,
+    0x0B, 0x17, 0x06, 0x03, 0x08, 0x25, 0x08, 0x35, 0x0B, 0x1A, 0x1A, 0x0A,
+    0x0B, 0x17, 0x15, 0x09, 0x06, 0x05, 0x24, 0x37, 0x15, 0x04, 0x02, 0x16,
+    0x26, 0x17, 0x18, 0x14, 0x13, 0x3A, 0x05, 0x16, 0x07, 0x13, 0x28, 0x0B,
+    0x02, 0x36, 0x34, 0x17, 0x03, 0x0B, 0x04, 0x0B, 0x0B, 0x18, 0x16, 0x04,
+    0x13, 0x27, 0x1A, 0x09, 0x0A, 0x22, 0x03, 0x17, 0x02, 0x12, 0x07, 0x03,
+    0x0B, 0x04, 0x0B, 0x38, 0x09, 0x16, 0x19, 0x19, 0x08, 0x19, 0x04, 0x28,
+    0x25, 0x25, 0x1A, 0x09, 0x03, 0x09, 0x3A, 0x03, 0x02, 0x18, 0x03, 0x2A,
+    0x17, 0x36, 0x04, 0x1A, 0x07, 0x24, 0x03, 0x02, 0x09, 0x03, 0x14, 0x16,
+    0x17, 0x06, 0x18, 0x15, 0x05, 0x03, 0x06, 0x14, 0x03, 0x0B, 0x08, 0x04,
+    0x06, 0x25, 0x03, 0x38, 0x0B, 0x14, 0x0B, 0x24, 0x07, 0x06, 0x09, 0x07,
+    0x18, 0x18, 0x16, 0x13, 0x05, 0x13, 0x06, 0x1A, 0x02, 0x08, 0x04, 0x22,
+    0x08, 0x04, 0x17, 0x08, 0x04, 0x26, 0x24, 0x16, 0x08, 0x18, 0x12, 0x13,
+    0x1A, 0x05, 0x0A, 0x0B, 0x06, 0x14, 0x23, 0x0B, 0x16, 0x09, 0x17, 0x22,
+    0x36, 0x08, 0x09, 0x08, 0x38, 0x27, 0x39, 0x08, 0x03, 0x16, 0x09, 0x08,
+    0x07, 0x12, 0x13, 0x12, 0x24, 0x05, 0x2A, 0x0B, 0x07, 0x12, 0x02, 0x03,
+    0x34, 0x0B, 0x39, 0x06, 0x04, 0x0B, 0x0A, 0x03, 0x18, 0x1A, 0x09, 0x08,
+    0x07, 0x09, 0x09, 0x09, 0x0B, 0x0A, 0x07, 0x06, 0x36, 0x08, 0x16, 0x17,
+    0x07, 0x12, 0x18, 0x04, 0x0B, 0x38, 0x05, 0x38, 0x04, 0x1A, 0x03, 0x07,
+    0x03, 0x15, 0x0A, 0x16, 0x02, 0x1A, 0x3A, 0x03, 0x08, 0x1A, 0x27, 0x07,
+    0x09, 0x1A, 0x25, 0x2A, 0x06, 0x06, 0x3A, 0x02, 0x03, 0x06, 0x16, 0x06,
+    0x09, 0x36, 0x04, 0x39, 0x1A, 0x18, 0x29, 0x07, 0x25, 0x0B, 0x19, 0x34,
+    0x39, 0x37, 0x39, 0x36, 0x0B, 0x03, 0x24, 0x13, 0x17, 0x2A, 0x0A, 0x0B,
+    0x0B, 0x0B, 0x17, 0x16, 0x33, 0x16, 0x1A, 0x13, 0x09, 0x19, 0x3A, 0x07,
+    0x33, 0x29, 0x07, 0x0B, 0x06, 0x17, 0x16, 0x1A, 0x08, 0x33, 0x05, 0x1A,
+    0x03, 0x25, 0x02, 0x07
+};
+
+static const unsigned short bookSeeds[BOOK_BUCKETS] =
+{
+    8, 21, 41, 0, 83, 0, 4, 18, 0, 15, 10, 5,
+    0, 128, 0, 12, 0, 4, 12, 28, 11, 23, 0, 0,
+    38, 1, 1, 1, 13, 24, 0, 2, 2, 66, 2, 0,
+    40, 0, 6, 14, 7, 11, 0, 12, 0, 10, 3, 0,
+    2, 3, 4, 94, 4, 34, 29, 6, 6, 0, 0, 0,
+    1, 7, 25, 9, 11, 1, 0, 7, 1, 1, 0, 8,
+    24, 8, 2, 13, 0, 1, 1, 11, 2, 2, 3, 35,
+    7, 0, 29, 3, 6, 0, 0, 46, 0, 0, 1, 54,
+    102, 66, 61, 0, 38, 5, 11, 3, 21, 0, 3, 54,
+    9, 0, 7, 60, 3, 9, 0, 5, 6, 1, 1, 0,
+    24, 7, 47, 0, 25, 2, 84, 11, 25, 3, 0, 14,
+    29, 59, 16, 5, 11, 0, 11, 0, 50, 22, 0, 25,
+    5, 7, 0, 19, 14, 12, 31, 6, 8, 1, 0, 0,
+    34, 20, 0, 3, 8, 2, 0, 0, 16, 6, 18, 13,
+    1, 0, 1, 0, 4, 1, 5, 0, 3, 7, 0, 3,
+    6, 5, 34, 15, 0, 3, 40, 0, 0, 69, 49, 0,
+    1, 5, 0, 87, 6, 1, 29, 65, 16, 8, 12, 0,
+    0, 8, 30, 7, 3, 56, 0, 3, 1, 5, 0, 2,
+    39, 0, 1, 8, 11, 2, 2, 0, 38, 0, 49, 3,
+    2, 1, 0, 0, 2, 6, 75, 13, 47, 1, 33, 16,
+    13, 0, 28, 36, 48, 18, 3, 1, 2, 18, 1, 36,
+    0, 0, 23, 9, 4, 8, 1, 48, 26, 5, 29, 1,
+    25, 4, 3, 0, 1, 27, 6, 1, 36, 0, 17, 3,
+    2, 47, 2, 0, 27, 7, 42, 11, 40, 1, 57, 9,
+    0, 1, 42, 4, 2, 24, 72, 5, 7, 1, 0, 2,
+    23, 6, 1, 55, 23, 0, 27, 11, 47, 15, 28, 12,
+    5, 7, 26, 0, 9, 0, 1, 1, 10, 1, 16, 1,
+    11, 1, 9, 18, 21, 0, 6, 57, 23, 6, 1, 23,
+    15, 10, 40, 2, 6, 38, 20, 27, 1, 5, 10, 1,
+    74, 5, 0, 1, 23, 2, 49, 6, 12, 13, 36, 17,
+    53, 0, 2, 19, 0, 43, 12, 1, 4, 9, 50, 2,
+    15, 31, 7, 131, 309, 8, 15, 117, 4, 27, 1, 58,
+    64, 4, 10, 3, 0, 21, 0, 2, 61, 5, 183, 0,
+    9, 34, 76, 27, 5, 12, 1, 5, 91, 2, 0, 1,
+    0, 0, 26, 14, 0, 0, 62, 0, 124, 18, 0, 48,
+    0, 0, 0, 11, 6, 2, 0, 76, 32, 0, 6, 4,
+    0, 70, 10, 3, 6, 1, 8, 38, 3, 156, 1, 3,
+    6, 17, 23, 40, 4, 4, 1, 11, 34, 3, 16, 14,
+    8, 16, 11, 13, 20, 24, 10, 26, 0, 42, 68, 10,
+    2, 2, 2, 37, 2, 64, 49, 21, 8, 5, 23, 1,
+    144, 3, 8, 3, 16, 3, 117, 11, 19, 3, 33, 8,
+    34, 3, 0, 0, 49, 4, 0, 7, 91, 27, 34, 21,
+    3, 2, 45, 20, 11, 12, 27, 16, 58, 69, 2, 4,
+    2, 15, 6, 28, 101, 77, 155, 0, 0, 15, 8, 21,
+    50, 21, 12, 1, 9, 0, 32, 18, 42, 37, 0, 35,
+    8, 7, 3, 83, 3, 3, 0, 11, 32, 7, 0, 9,
+    8, 51, 5, 10, 53, 4, 92, 130, 114, 25, 8, 0,
+    34, 0, 0, 0, 0, 8, 2, 0, 33, 22, 61, 83,
+    3, 42, 2, 1, 0, 29, 0, 70, 5, 13, 20, 6,
+    76, 4, 8, 21, 26, 0, 6, 6, 9, 3, 1, 9,
+    16, 2, 3, 0, 1, 3, 23, 37, 25, 9, 149, 80,
+    0, 16, 11, 10, 0, 11, 26, 79, 11, 8, 0, 7,
+    2, 23, 249, 9, 0, 11, 45, 10, 5, 0, 7, 31,
+    4, 0, 0, 1, 4, 52, 14, 0, 1, 1, 4, 1,
+    6, 33, 95, 6, 5, 89, 7, 5, 0, 6, 24, 16,
+    7, 0, 152, 13, 12, 128, 0, 0, 13, 68, 105, 17,
+    26, 26, 1, 7, 3, 10, 5, 6, 89, 12, 0, 2,
+    1, 8, 5, 2, 0, 23, 9, 3, 9, 16, 12, 27,
+    28, 146, 21, 5, 22, 2, 33, 4, 177, 4, 25, 27,
+    4, 90, 16, 3, 57, 3, 19, 29, 0, 8, 13, 25,
+    15, 59, 35, 109, 133, 2, 61, 0, 171, 0, 111, 98,
+    0, 2, 0, 0, 2, 9, 0, 9, 50, 0, 12, 0,
+    0, 5, 14, 5, 0, 16, 118, 10, 103, 21, 4, 1,
+    1, 112, 5, 73, 34, 0, 4, 7, 68, 23, 3, 0,
+    56, 0, 1, 9, 47, 22, 45, 22, 1, 26, 12, 8,
+    8, 24, 5, 0, 0, 80, 10, 3, 78, 3, 98, 22,
+    128, 3, 2, 80, 26, 7, 13, 16, 0, 11, 8, 0,
+    9, 21, 39, 37, 77, 61, 0, 153, 46, 13, 2, 30,
+    35, 314, 180, 27, 0, 12, 0, 8, 61, 5, 0, 27,
+    5, 56, 140, 10, 72, 13, 77, 26, 33, 0, 98, 19,
+    90, 0, 12, 94, 39, 4, 32, 114, 6, 566, 23, 30,
+    3, 2, 2, 1, 37, 0, 36, 224, 28, 13, 16, 8,
+    3, 13, 12, 86, 50, 7, 160, 111, 15, 10, 10, 28,
+    0, 78, 125, 0, 145, 64, 0, 1, 26, 11, 11, 31,
+    3, 7, 22, 18, 26, 116, 52, 5, 5, 7, 60, 30,
+    0, 425, 0, 5, 46, 29, 54, 0, 10, 413, 165, 0,
+    56, 135, 14, 0, 7, 10, 118, 10, 250, 13, 144, 1,
+    0, 88, 18, 50, 0, 54, 81, 1, 15, 3, 20, 9,
+    66, 15, 13, 0, 20, 48, 281, 0, 0, 19, 11, 206,
+    100, 30, 148, 54, 44, 3, 27, 44, 339, 8, 0, 0,
+    42, 64, 66, 29, 7, 614, 624, 236, 0, 1, 1, 61,
+    64, 154, 39, 0, 48, 210, 30, 2, 0, 0, 5, 20,
+    0, 48, 35, 119, 2, 33, 11, 24, 1, 62, 58, 0,
+    4, 115, 1, 259, 13, 151, 257, 1, 2, 121, 7, 1,
+    15, 5, 15, 6, 186, 6, 103, 17, 54, 23, 21, 0,
+    55, 198, 249, 76, 145, 2, 3, 60, 19, 178, 3, 101,
+    2, 83, 29, 42, 106, 31, 8, 118, 4, 8, 0, 0,
+    197, 154, 22, 136, 17, 2, 584, 7, 1, 16, 37, 21,
+    1, 0, 85, 0, 17, 16, 142, 75, 6, 0, 6, 106,
+    5, 9, 54, 1, 82, 9, 0, 104, 221, 83, 99, 89,
+    32, 185, 414, 6, 0, 548, 8, 19, 42, 15, 48, 13,
+    8, 1, 25, 384, 0, 11, 375, 704, 145, 22, 4, 18,
+    0, 4, 1, 16, 14, 0, 13, 182, 70, 1, 283, 36,
+    67, 0, 517, 34, 75, 4, 525, 22, 0, 1, 238, 32,
+    385, 13, 47, 28, 3, 15, 83, 7, 4, 239, 0, 223,
+    5, 6, 151, 3, 505, 68, 75, 9, 3, 57, 13, 24,
+    201, 50, 160, 0, 47, 1, 19, 2, 13, 21, 55, 35,
+    17, 39, 78, 124, 74, 143, 4, 61, 1, 12, 46, 22,
+    15, 123, 137, 0, 0, 8, 75, 25, 0, 14, 22, 2,
+    2, 252, 45, 0, 104, 0, 180, 5, 8, 0, 48, 144,
+    4, 54, 10, 4, 372, 0, 44, 181, 68, 12, 5, 0,
+    38, 184, 0, 1, 30, 3, 2, 17, 126, 0, 566, 10,
+    209, 196, 0, 61, 66, 165, 35, 65, 89, 0, 8, 274,
+    0, 0, 29, 1, 18, 359, 251, 0, 88, 478, 35, 56,
+    16, 213, 716, 4, 15, 32, 0, 21, 334, 69, 50, 157,
+    5, 88, 312, 25, 6, 7, 11, 1, 23, 20, 0, 1,
+    268, 399, 0, 13, 4, 17, 15, 46, 345, 20, 9, 70,
+    1, 49, 56, 209, 16, 0, 6, 8, 221, 158, 125, 0,
+    17, 1815, 46, 98, 97, 16, 2, 122, 3, 2278, 31, 14,
+    1289, 328, 45, 134, 12, 20, 0, 84, 16, 791, 326, 85,
+    204, 76, 91, 6, 534, 43, 816, 496, 21, 146, 14, 6,
+    151, 21, 1944, 1, 893, 168, 12, 622, 0, 158, 1, 406,
+    113, 4, 447, 80, 38, 87, 337, 858, 15, 0, 21, 103,
+    0, 0, 192, 1110, 114, 2348, 38, 1, 77, 8665
+};
+
+#else
+
+#define BOOK_ENTRIES 0 // Generated for ten columns only
+
+#endif
+
+#endif
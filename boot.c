@@ -0,0 +1,53 @@
+#include "inc/hw_types.h"
+#include "driverlib/systick.h"
+#include "console.h"
+#include "sched.h"
+#include "boot.h"
+
+// SysTick is started early here, over the same full 24 bits PowerInit
+// gives it later, so phases can use the scheduler's timestamps. That covers
+// startups of up to two seconds at 8 MHz.
+
+tBootStats bootStats;
+
+static unsigned long start;
+static unsigned long last; // End of the latest phase marked
+static int marked = 0;     // Phases already timed
+
+void BootInit(void)
+{
+    SysTickPeriodSet(0x1000000);
+    SysTickEnable();
+    start = SchedTimestamp();
+}
+
+// Ends a phase, which started where the one before it in time ended. Only
+// the first call for each phase counts, so the playable mark can sit on the
+// render path.
+void BootMark(int phase)
+{
+    if(marked & (1 << phase))
+    {
+        return;
+    }
+    marked |= 1 << phase;
+
+    bootStats.at[phase] = SchedElapsed(start, SchedTimestamp());
+    bootStats.phase[phase] = bootStats.at[phase] - last;
+    last = bootStats.at[phase];
+}
+
+void BootReport(void)
+{
+    static const char *const names[BOOT_PHASES] = { "display", "frame", "devices", "playable" };
+    int i;
+    for(i = 0; i < BOOT_PHASES; i++)
+    {
+        ConsolePrint(names[i]);
+        ConsolePrint(" at ");
+        ConsoleNumber(bootStats.at[i]);
+        ConsolePrint(" took ");
+        ConsoleNumber(bootStats.phase[i]);
+        ConsolePrint(" cycles\r\n");
+    }
+}
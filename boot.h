@@ -0,0 +1,26 @@
+#ifndef __BOOT_H__
+#define __BOOT_H__
+
+// Startup phases, in the order main reaches them; BOOT_DEVICES_FIRST moves
+// the devices ahead of the frame, as they were before. Each is timed from
+// BootInit, which runs as soon as the clock is set up; the C runtime's copy
+// of .data and zeroing of .bss come before it and are not counted.
+#define BOOT_DISPLAY  0 // OLED powered up and cleared
+#define BOOT_FRAME    1 // Mode chosen and the empty board shown
+#define BOOT_DEVICES  2 // Timer, sound, game log, power and console set up
+#define BOOT_PLAYABLE 3 // First frame with a piece in play
+#define BOOT_PHASES   4
+
+typedef struct
+{
+    unsigned long at[BOOT_PHASES];    // Cycles from BootInit to the end of each phase
+    unsigned long phase[BOOT_PHASES]; // Cycles spent in each phase
+} tBootStats;
+
+extern tBootStats bootStats;
+
+extern void BootInit(void);
+extern void BootMark(int phase);
+extern void BootReport(void);
+
+#endif
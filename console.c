@@ -0,0 +1,156 @@
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "globals.h"
+#include "console.h"
+
+// The ring is indexed by free running counts, like the event queue. Only
+// tasks print and flush, so it needs no locking.
+
+tConsoleStats consoleStats;
+
+static char ring[CONSOLE_RING];
+static unsigned long head = 0;
+static unsigned long tail = 0;
+
+static char line[CONSOLE_LINE + 1];
+static int lineLength = 0;
+static int lineReady = 0;
+
+void ConsoleInit(void)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
+    GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+    UARTConfigSetExpClk(UART0_BASE, g_ulSystemClock, CONSOLE_BAUD,
+                        UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE);
+    UARTEnable(UART0_BASE);
+}
+
+void ConsolePrint(const char *str)
+{
+    while(*str)
+    {
+        if(head - tail >= CONSOLE_RING)
+        {
+            consoleStats.dropped++;
+        }
+        else
+        {
+            ring[head % CONSOLE_RING] = *str;
+            head++;
+        }
+        str++;
+    }
+}
+
+// Prints in decimal, kept off the heap like IntToString
+void ConsoleNumber(unsigned long value)
+{
+    char digits[11];
+    int i = 10;
+    digits[i] = '\0';
+    do
+    {
+        digits[--i] = '0' + value % 10;
+        value /= 10;
+    }
+    while(value);
+    ConsolePrint(&digits[i]);
+}
+
+void ConsoleHex(unsigned long value)
+{
+    char digits[11];
+    int i;
+    digits[0] = '0';
+    digits[1] = 'x';
+    for(i = 0; i < 8; i++)
+    {
+        digits[9 - i] = "0123456789ABCDEF"[(value >> (4 * i)) & 0xF];
+    }
+    digits[10] = '\0';
+    ConsolePrint(digits);
+}
+
+// Fills the transmit FIFO from the ring and collects received characters.
+// Called from a periodic task; 16 characters of FIFO last 1.4 ms at
+// 115200 baud, so a long report goes out over several calls.
+void ConsoleFlush(void)
+{
+    while(tail != head && UARTSpaceAvail(UART0_BASE))
+    {
+        UARTCharPutNonBlocking(UART0_BASE, ring[tail % CONSOLE_RING]);
+        tail++;
+        consoleStats.sent++;
+    }
+
+    long c;
+    while(!lineReady && (c = UARTCharGetNonBlocking(UART0_BASE)) >= 0)
+    {
+        if(c == '\r' || c == '\n')
+        {
+            if(lineLength)
+            {
+                line[lineLength] = '\0';
+                lineReady = 1;
+                consoleStats.lines++;
+            }
+        }
+        else if(lineLength < CONSOLE_LINE)
+        {
+            line[lineLength++] = (char)c;
+        }
+    }
+}
+
+// Returns the next complete command line, or 0 if none has arrived. The
+// line stays valid until the next ConsoleFlush.
+const char *ConsoleRead(void)
+{
+    if(!lineReady)
+    {
+        return 0;
+    }
+
+    lineReady = 0;
+    lineLength = 0;
+    return line;
+}
+
+// Returns the rest of the line, past any spaces, if it starts with word
+// as a whole word, else 0
+const char *ConsoleCommand(const char *line, const char *word)
+{
+    while(*word)
+    {
+        if(*line++ != *word++)
+        {
+            return 0;
+        }
+    }
+    if(*line && *line != ' ')
+    {
+        return 0;
+    }
+    while(*line == ' ')
+    {
+        line++;
+    }
+    return line;
+}
+
+// Reads a decimal argument of up to nine digits, -1 if there is none
+long ConsoleArgument(const char *str)
+{
+    long value = 0;
+    int digits = 0;
+    while(*str >= '0' && *str <= '9' && digits < 9)
+    {
+        value = value * 10 + (*str++ - '0');
+        digits++;
+    }
+    return digits && !*str ? value : -1;
+}
@@ -0,0 +1,29 @@
+#ifndef __CONSOLE_H__
+#define __CONSOLE_H__
+
+// Text over UART0, the evaluation board's USB virtual serial port, at
+// 115200 8N1. Output waits in a ring until the transmit FIFO has room, so
+// printing never holds up a task; input is collected a line at a time.
+#define CONSOLE_BAUD 115200
+#define CONSOLE_RING 512 // Power of two
+#define CONSOLE_LINE 32  // Longest command, longer lines are cut short
+
+typedef struct
+{
+    unsigned long sent;    // Characters moved into the transmit FIFO
+    unsigned long dropped; // Characters printed while the ring was full
+    unsigned long lines;   // Command lines received
+} tConsoleStats;
+
+extern tConsoleStats consoleStats;
+
+extern void ConsoleInit(void);
+extern void ConsolePrint(const char *str);
+extern void ConsoleNumber(unsigned long value);
+extern void ConsoleHex(unsigned long value);
+extern void ConsoleFlush(void);
+extern const char *ConsoleRead(void);
+extern const char *ConsoleCommand(const char *line, const char *word);
+extern long ConsoleArgument(const char *str);
+
+#endif
@@ -0,0 +1,193 @@
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "book.h"
+#include "sched.h"
+#include "think.h"
+#include "cpu.h"
+
+// Boards in the opening book skip the search: the book's drop is pressed
+// out as rotations, then shifts, then the drop. Otherwise an anytime search
+// starts when a piece appears and deepens in idle time until cpuDelay has
+// passed, when its best placement so far is committed and pressed out. Each
+// tick also runs a slice of up to cpuBudget cycles itself until depth one
+// is done, so the computer keeps its pace with no idle time at all. The
+// search's PlaceFind and EvalPrepare boards are shared, so nothing else may
+// search while the computer is playing.
+
+#define STAGE_IDLE  0 // Waiting for a piece
+#define STAGE_THINK 1
+#define STAGE_PRESS 2
+
+tCpuStats cpuStats;
+unsigned long cpuBudget = CPU_BUDGET;
+unsigned long cpuDelay = CPU_DELAY;
+
+static const unsigned char moveInputs[] =
+{
+    0, INPUT_L, INPUT_R, INPUT_RR, INPUT_U, INPUT_D
+};
+
+static unsigned char path[CPU_PATH];
+
+static int stage = STAGE_IDLE;
+static unsigned long pieceLocks; // game->locks when the piece appeared
+static int pathLength;
+static int pathNext;
+static unsigned long wait;
+static int held; // Input pressed last tick, released before the next move
+
+// Writes the path for a straight drop from the spawn pose
+static void BookPath(tGame *game, int orientation, int x)
+{
+    int turns = (orientation - game->orientation) & 3;
+    pathLength = 0;
+    while(turns--)
+    {
+        path[pathLength++] = MOVE_ROTATE;
+    }
+
+    int shift = x - game->locationX;
+    while(shift && pathLength < CPU_PATH - 1)
+    {
+        path[pathLength++] = shift < 0 ? MOVE_LEFT : MOVE_RIGHT;
+        shift += shift < 0 ? 1 : -1;
+    }
+    path[pathLength++] = MOVE_DROP;
+}
+
+static void Search(tGame *game)
+{
+    pieceLocks = game->locks;
+    wait = cpuDelay;
+    pathNext = 0;
+
+    int orientation, x;
+    if(BookLookup(game, &orientation, &x))
+    {
+        BookPath(game, orientation, x);
+        stage = STAGE_PRESS;
+        cpuStats.pieces++;
+        return;
+    }
+
+    unsigned long start = SchedTimestamp();
+    ThinkStart(game);
+    ThinkSlice(cpuBudget);
+    unsigned long cycles = SchedElapsed(start, SchedTimestamp());
+
+    if(cycles > cpuStats.searchWcet)
+    {
+        cpuStats.searchWcet = cycles;
+    }
+    stage = STAGE_THINK;
+}
+
+// Thinks until the delay is up, then takes the best placement found
+static void Think(void)
+{
+    if(ThinkPending() && ThinkDepth() < 1)
+    {
+        unsigned long start = SchedTimestamp();
+        ThinkSlice(cpuBudget);
+        unsigned long cycles = SchedElapsed(start, SchedTimestamp());
+
+        cpuStats.slices++;
+        if(cycles > cpuStats.sliceWcet)
+        {
+            cpuStats.sliceWcet = cycles;
+        }
+    }
+
+    if(wait)
+    {
+        wait--;
+        return;
+    }
+    if(ThinkPending() && ThinkDepth() < 1)
+    {
+        return; // Not one placement to choose from yet
+    }
+
+    BookSearched(ThinkCost());
+    pathLength = ThinkCommit(path, CPU_PATH);
+    if(pathLength < 0)
+    {
+        pathLength = 0; // Nowhere to go, gravity decides
+    }
+    else
+    {
+        if(pathLength > CPU_PATH)
+        {
+            pathLength = CPU_PATH;
+        }
+
+        // A path ending at rest still needs the drop to lock it now
+        if(!pathLength || path[pathLength - 1] != MOVE_DROP)
+        {
+            if(pathLength == CPU_PATH)
+            {
+                pathLength--;
+            }
+            path[pathLength++] = MOVE_DROP;
+        }
+    }
+
+    pathNext = 0;
+    stage = STAGE_PRESS;
+    cpuStats.pieces++;
+}
+
+void CpuInit(void)
+{
+    stage = STAGE_IDLE;
+    held = 0;
+}
+
+// Thinks for one tick and returns the input mask to step the computer's
+// game with
+int CpuTick(tGame *game)
+{
+    if(game->gameover || game->shape < 0)
+    {
+        return 0; // The next step deals a piece
+    }
+
+    if(stage == STAGE_IDLE || game->locks != pieceLocks)
+    {
+        if(stage == STAGE_PRESS && game->locks != pieceLocks)
+        {
+            cpuStats.lost++; // Gravity locked it first
+        }
+        held = 0;
+        Search(game);
+        return 0;
+    }
+
+    if(stage == STAGE_THINK)
+    {
+        Think();
+        return 0;
+    }
+
+    if(wait)
+    {
+        wait--; // Book moves wait out the delay too
+        return 0;
+    }
+
+    // Each move is a press for one tick then a release, rotation acts on
+    // the release
+    if(held || pathNext == pathLength)
+    {
+        held = 0;
+        return 0;
+    }
+
+    held = moveInputs[path[pathNext++]];
+    if(held == INPUT_D)
+    {
+        stage = STAGE_IDLE;
+    }
+    return held;
+}
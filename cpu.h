@@ -0,0 +1,30 @@
+#ifndef __CPU_H__
+#define __CPU_H__
+
+#include "game.h"
+
+// Computer opponent for the split screen. It plays its board through input
+// masks like a player: each new piece is looked up in the opening book, or
+// searched by the anytime search in think.c until the delay is up, then the
+// path is pressed out one button every other tick.
+#define CPU_BUDGET 20000 // Search cycles per tick until depth one, a quarter of a tick at 8 MHz
+#define CPU_DELAY  40    // Ticks from a new piece to the first press
+#define CPU_PATH   32    // Longest path followed, longer ones are cut short
+
+typedef struct
+{
+    unsigned long pieces;     // Placements chosen
+    unsigned long slices;     // Ticks spent searching after the first
+    unsigned long searchWcet; // Worst first tick of a search, the whole PlaceFind
+    unsigned long sliceWcet;  // Worst search cycles in a later tick
+    unsigned long lost;       // Pieces that locked before their path was done
+} tCpuStats;
+
+extern tCpuStats cpuStats;
+extern unsigned long cpuBudget; // Search cycles per tick until depth one
+extern unsigned long cpuDelay;  // Ticks before the first press, sets the pace
+
+extern void CpuInit(void);
+extern int CpuTick(tGame *game);
+
+#endif
@@ -0,0 +1,93 @@
+#include "deadline.h"
+
+// Every tick samples one input, and the game task should process it before
+// the next. Lateness is measured in ticks queued behind the one processed,
+// which also counts states a render would merge.
+
+tDeadlineStats deadlineStats;
+
+static unsigned long onTime = 0;           // Ticks processed on time in a row
+static unsigned long unshown = 0;         // Changed states since the last render
+
+static void SetLevel(int level)
+{
+    if(level != deadlineStats.level)
+    {
+        deadlineStats.level = level;
+        deadlineStats.shifts++;
+    }
+}
+
+// Called from the timer interrupt with the number of earlier ticks still
+// waiting to be processed
+void DeadlineTick(unsigned long timestamp, int backlog)
+{
+    deadlineStats.ticks++;
+    deadlineStats.lastTick = timestamp;
+    if(backlog)
+    {
+        deadlineStats.overruns++;
+    }
+}
+
+// Called by the game task for each tick processed, with the number of newer
+// ticks already waiting and whether the tick changed what is on screen
+void DeadlineProcessed(int behind, int changed)
+{
+    if(changed)
+    {
+        unshown++;
+    }
+
+    int bucket = behind < 4 ? behind : behind < 8 ? 4 : 5;
+    deadlineStats.late[bucket]++;
+
+    if(behind >= DEADLINE_SHED_BEHIND)
+    {
+        SetLevel(DEADLINE_SHED);
+    }
+    else if(behind >= DEADLINE_SKIP_BEHIND && deadlineStats.level < DEADLINE_SKIP)
+    {
+        SetLevel(DEADLINE_SKIP);
+    }
+
+    if(behind)
+    {
+        onTime = 0;
+    }
+    else if(deadlineStats.level != DEADLINE_FULL && ++onTime >= DEADLINE_RECOVER_TICKS)
+    {
+        SetLevel(deadlineStats.level - 1);
+        onTime = 0;
+    }
+}
+
+// Returns 1 if a render should go ahead. While behind, a render with ticks
+// still waiting would show a state that is already out of date.
+int DeadlineRender(int waiting)
+{
+    if(deadlineStats.level != DEADLINE_FULL && waiting)
+    {
+        deadlineStats.skipped++;
+        return 0;
+    }
+
+    if(unshown > deadlineStats.merged)
+    {
+        deadlineStats.merged = unshown;
+    }
+    unshown = 0;
+    deadlineStats.renders++;
+    return 1;
+}
+
+// Returns 1 if the render under way should redraw the score text
+int DeadlineHud(void)
+{
+    return deadlineStats.level == DEADLINE_FULL || deadlineStats.renders % DEADLINE_HUD_FRAMES == 0;
+}
+
+int DeadlineLevel(void)
+{
+    return deadlineStats.level;
+}
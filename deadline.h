@@ -0,0 +1,44 @@
+#ifndef __DEADLINE_H__
+#define __DEADLINE_H__
+
+// Quality levels, raised while game ticks are processed late and lowered
+// again once they are on time
+#define DEADLINE_FULL 0
+#define DEADLINE_SKIP 1 // Skip renders of states already out of date, slower HUD
+#define DEADLINE_SHED 2 // Also hold back samples and telemetry
+
+// Ticks waiting behind the one processed that raise each level
+#define DEADLINE_SKIP_BEHIND 2
+#define DEADLINE_SHED_BEHIND 4
+
+// On-time ticks in a row before dropping back one level (0.5 s)
+#define DEADLINE_RECOVER_TICKS 50
+
+// Renders per HUD refresh above DEADLINE_FULL
+#define DEADLINE_HUD_FRAMES 4
+
+// Lateness histogram buckets: 0, 1, 2, 3, 4-7 and 8 or more ticks
+#define DEADLINE_BUCKETS 6
+
+typedef struct
+{
+    unsigned long ticks;     // Timer ticks timestamped
+    unsigned long lastTick;  // Timestamp of the latest tick
+    unsigned long overruns;  // Ticks that fired before the previous one was processed
+    unsigned long late[DEADLINE_BUCKETS]; // Ticks processed by how many ticks late
+    unsigned long renders;
+    unsigned long skipped;   // Renders skipped as out of date
+    unsigned long merged;    // Most changed game states shown by one render
+    unsigned long shifts;    // Level changes
+    int level;
+} tDeadlineStats;
+
+extern tDeadlineStats deadlineStats;
+
+extern void DeadlineTick(unsigned long timestamp, int backlog);
+extern void DeadlineProcessed(int behind, int changed);
+extern int DeadlineRender(int waiting);
+extern int DeadlineHud(void);
+extern int DeadlineLevel(void);
+
+#endif
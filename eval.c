@@ -0,0 +1,218 @@
+#include <string.h>
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "evalweights.h"
+
+// Placements are applied to a copy of the board held one row per word, bit
+// j for column j, so clearing lines and measuring the result are a few
+// operations per row. The network is all integer multiply-accumulate, the
+// M3 has no FPU: a linear term over the inputs plus one ReLU hidden layer
+// for what the linear term cannot express.
+
+#define FULL_ROW ((1 << GAME_COLS) - 1)
+
+tEvalStats evalStats;
+
+// The board EvalPrepare, EvalPlacement and EvalChoose use
+static tEvalBoard evalBoard;
+
+static int BitCount(unsigned long bits)
+{
+    int count = 0;
+    while(bits)
+    {
+        bits &= bits - 1;
+        count++;
+    }
+    return count;
+}
+
+// Takes a copy of the board for the placements that follow
+void EvalPrepareIn(tEvalBoard *board, tGame *game)
+{
+    int i;
+    for(i = 0; i < GAME_ROWS; i++)
+    {
+        board->boardRows[i] = GameRowBits(game, i);
+    }
+}
+
+// Stores the piece into the scratch rows and removes full lines. Returns
+// lines cleared.
+static int Place(tEvalBoard *board, int shape, const tPlacement *placement)
+{
+    unsigned short *rows = board->rows;
+    memcpy(rows, board->boardRows, sizeof(board->rows));
+
+    int mask = shapeMasks[shape][placement->orientation];
+    int i;
+    for(i = 0; i < 4; i++)
+    {
+        int bits = (mask >> (4 * i)) & 0xF;
+        if(bits)
+        {
+            int x = placement->x;
+            rows[placement->y + i] |= x >= 0 ? bits << x : bits >> -x;
+        }
+    }
+
+    // Compact the rows that stay from the floor up
+    int lines = 0;
+    int to = GAME_ROWS - 1;
+    for(i = GAME_ROWS - 1; i >= 0; i--)
+    {
+        if(rows[i] == FULL_ROW)
+        {
+            lines++;
+        }
+        else
+        {
+            rows[to--] = rows[i];
+        }
+    }
+    while(to >= 0)
+    {
+        rows[to--] = 0;
+    }
+
+    return lines;
+}
+
+// Fills in the network inputs from rows
+static void Measure(const unsigned short *rows, int *features, int lines)
+{
+    int *heights = features;
+    int holes = 0;
+    int transitions = 0;
+    unsigned short covered = 0; // Columns with a filled cell above
+
+    memset(heights, 0, GAME_COLS * sizeof(int));
+
+    int i;
+    for(i = 0; i < GAME_ROWS; i++)
+    {
+        unsigned short row = rows[i];
+        unsigned short tops = row & ~covered;
+        if(tops)
+        {
+            int j;
+            for(j = 0; j < GAME_COLS; j++)
+            {
+                if(tops & (1 << j))
+                {
+                    heights[j] = GAME_ROWS - i;
+                }
+            }
+        }
+
+        if(covered)
+        {
+            holes += BitCount(covered & ~row);
+        }
+
+        covered |= row;
+        if(covered)
+        {
+            // Changes between filled and empty along the row, walls count
+            // as filled. Empty rows above the stack are skipped.
+            unsigned long walled = (1UL << (GAME_COLS + 1)) | (row << 1) | 1;
+            transitions += BitCount((walled ^ (walled >> 1)) & ((1UL << (GAME_COLS + 1)) - 1));
+        }
+    }
+
+    features[GAME_COLS] = holes > 127 ? 127 : holes;
+    features[GAME_COLS + 1] = transitions > 127 ? 127 : transitions;
+    features[GAME_COLS + 2] = lines;
+}
+
+// Scores a board from its network inputs
+long EvalNetwork(const int *features)
+{
+    long out = evalB2;
+    long hidden = 0;
+
+    int i, k;
+    for(i = 0; i < EVAL_INPUTS; i++)
+    {
+        out += evalLinear[i] * features[i];
+    }
+
+    for(k = 0; k < EVAL_HIDDEN; k++)
+    {
+        const short *weights = evalW1[k];
+        long sum = evalB1[k];
+        for(i = 0; i < EVAL_INPUTS; i++)
+        {
+            sum += weights[i] * features[i];
+        }
+
+        if(sum > 0)
+        {
+            hidden += (sum >> EVAL_SHIFT1) * evalW2[k];
+        }
+    }
+
+    return out + (hidden >> EVAL_SHIFT2);
+}
+
+// Network inputs for the board left by a placement on the board from
+// EvalPrepareIn
+void EvalFeaturesIn(tEvalBoard *board, int shape, const tPlacement *placement, int *features)
+{
+    int lines = Place(board, shape, placement);
+    Measure(board->rows, features, lines);
+}
+
+// Scores the board left by a placement on the board from EvalPrepareIn
+long EvalPlacementIn(tEvalBoard *board, int shape, const tPlacement *placement)
+{
+    int features[EVAL_INPUTS];
+    EvalFeaturesIn(board, shape, placement, features);
+
+    board->stats->boards++;
+    return EvalNetwork(features);
+}
+
+// Returns the index of the best scoring placement, -1 if there are none
+int EvalChooseIn(tEvalBoard *board, tGame *game, int shape, const tPlacement *placements, int count)
+{
+    board->stats->choices++;
+    EvalPrepareIn(board, game);
+
+    int best = -1;
+    long bestScore = 0;
+    int i;
+    for(i = 0; i < count; i++)
+    {
+        long score = EvalPlacementIn(board, shape, &placements[i]);
+        if(best < 0 || score > bestScore)
+        {
+            best = i;
+            bestScore = score;
+        }
+    }
+
+    return best;
+}
+
+// The In functions on the one board the firmware has, counting into
+// evalStats
+
+void EvalPrepare(tGame *game)
+{
+    evalBoard.stats = &evalStats;
+    EvalPrepareIn(&evalBoard, game);
+}
+
+long EvalPlacement(int shape, const tPlacement *placement)
+{
+    evalBoard.stats = &evalStats;
+    return EvalPlacementIn(&evalBoard, shape, placement);
+}
+
+int EvalChoose(tGame *game, int shape, const tPlacement *placements, int count)
+{
+    evalBoard.stats = &evalStats;
+    return EvalChooseIn(&evalBoard, game, shape, placements, count);
+}
@@ -0,0 +1,41 @@
+#ifndef __EVAL_H__
+#define __EVAL_H__
+
+#include "game.h"
+#include "place.h"
+
+// Small integer MLP scoring the board left by a placement. Inputs are the
+// column heights, total holes, row transitions and lines cleared; a ReLU
+// hidden layer and a direct linear term feed a single output, higher is
+// better.
+#define EVAL_INPUTS (GAME_COLS + 3)
+#define EVAL_HIDDEN (2 * (GAME_COLS - 1)) // Enough for the seed weights in evalweights.h
+
+typedef struct
+{
+    unsigned long boards;  // Boards scored
+    unsigned long choices; // Calls to EvalChoose
+} tEvalStats;
+
+// Board the placements are scored on. The firmware has one, which
+// EvalPrepare, EvalPlacement and EvalChoose use; host tools give each
+// thread its own.
+typedef struct
+{
+    tEvalStats *stats;                   // Where the scoring counts
+    unsigned short boardRows[GAME_ROWS]; // From EvalPrepareIn, a row per word
+    unsigned short rows[GAME_ROWS];      // Scratch copy each placement is dropped into
+} tEvalBoard;
+
+extern tEvalStats evalStats;
+
+extern void EvalPrepare(tGame *game);
+extern long EvalPlacement(int shape, const tPlacement *placement);
+extern int EvalChoose(tGame *game, int shape, const tPlacement *placements, int count);
+extern void EvalPrepareIn(tEvalBoard *board, tGame *game);
+extern long EvalPlacementIn(tEvalBoard *board, int shape, const tPlacement *placement);
+extern void EvalFeaturesIn(tEvalBoard *board, int shape, const tPlacement *placement, int *features);
+extern long EvalNetwork(const int *features);
+extern int EvalChooseIn(tEvalBoard *board, tGame *game, int shape, const tPlacement *placements, int count);
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef __EVALWEIGHTS_H__
+#define __EVALWEIGHTS_H__
+
+// Generated by EvalGen/evalgen.c, do not edit. Board widths without a
+// trained network get the seed weights, set so the network reproduces the
+// hand-tuned linear score: -0.51 per cell of aggregate height, -0.36 per
+// hole, +0.76 per line cleared, and -0.18 per cell of bumpiness, the height
+// step between neighbouring columns. Each step takes two hidden units,
+// relu(a - b) + relu(b - a).
+//
+// Inputs are plain integers, so any input scale is folded into the weights.
+// Hidden sums are shifted right by EVAL_SHIFT1 after the ReLU and their
+// weighted total by EVAL_SHIFT2 before it joins the linear term. The output
+// is in units of 1/16384 and only meaningful relative to other boards.
+
+#if GAME_COLS == 10
+
+#define EVAL_SHIFT1 0
+#define EVAL_SHIFT2 0
+
+static const short evalW1[EVAL_HIDDEN][EVAL_INPUTS] =
+{
+    {  1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    { -1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  1, -1,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  1, -1,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  0,  1, -1,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  0, -1,  1,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  0,  0,  1, -1,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  0,  0, -1,  1,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  0,  0,  0,  1, -1,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  0,  0,  0, -1,  1,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  0,  0,  0,  0,  1, -1,  0,  0,  0 },
+    {  0,  0,  0,  0,  0,  0,  0,  0, -1,  1,  0,  0,  0 }
+};
+
+static const short evalB1[EVAL_HIDDEN] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const short evalW2[EVAL_HIDDEN] =
+{
+    -2949, -2949, -2949, -2949, -2949, -2949, -2949, -2949, -2949,
+    -2949, -2949, -2949, -2949, -2949, -2949, -2949, -2949, -2949
+};
+
+static const short evalLinear[EVAL_INPUTS] =
+{
+    -8356, -8356, -8356, -8356, -8356, -8356, -8356, -8356, -8356,
+    -8356, -5898, 0, 12452
+};
+
+static const long evalB2 = 0;
+
+#elif GAME_COLS == 6
+
+#define EVAL_SHIFT1 0
+#define EVAL_SHIFT2 0
+
+static const short evalW1[EVAL_HIDDEN][EVAL_INPUTS] =
+{
+    {  1, -1,  0,  0,  0,  0,  0,  0,  0 },
+    { -1,  1,  0,  0,  0,  0,  0,  0,  0 },
+    {  0,  1, -1,  0,  0,  0,  0,  0,  0 },
+    {  0, -1,  1,  0,  0,  0,  0,  0,  0 },
+    {  0,  0,  1, -1,  0,  0,  0,  0,  0 },
+    {  0,  0, -1,  1,  0,  0,  0,  0,  0 },
+    {  0,  0,  0,  1, -1,  0,  0,  0,  0 },
+    {  0,  0,  0, -1,  1,  0,  0,  0,  0 },
+    {  0,  0,  0,  0,  1, -1,  0,  0,  0 },
+    {  0,  0,  0,  0, -1,  1,  0,  0,  0 }
+};
+
+static const short evalB1[EVAL_HIDDEN] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+static const short evalW2[EVAL_HIDDEN] =
+{
+    -2949, -2949, -2949, -2949, -2949, -2949, -2949, -2949, -2949,
+    -2949
+};
+
+static const short evalLinear[EVAL_INPUTS] =
+{
+    -8356, -8356, -8356, -8356, -8356, -8356, -5898, 0, 12452
+};
+
+static const long evalB2 = 0;
+
+#else
+#error No evaluator weights for this board width
+#endif
+
+#endif
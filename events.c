@@ -0,0 +1,136 @@
+#include "game.h"
+#include "events.h"
+
+tEventStats eventStats;
+
+static tEvent queue[EVENT_QUEUE];
+static volatile unsigned long head = 0; // Written by the producer only
+static volatile unsigned long tail = 0; // Written by the consumer only
+
+static void (*subscribers[EVENT_SUBSCRIBERS])(const tEvent *event);
+static int subscriberCount = 0;
+
+// Counts EventWatch saw after the previous step
+static unsigned long lastSpawns = 0;
+static unsigned long lastRotations = 0;
+static unsigned long lastLeft = 0;
+static unsigned long lastRight = 0;
+static unsigned long lastLocks = 0;
+static int lastGameover = 0;
+
+void EventSubscribe(void (*handler)(const tEvent *event))
+{
+    if(subscriberCount < EVENT_SUBSCRIBERS)
+    {
+        subscribers[subscriberCount++] = handler;
+    }
+}
+
+// Queues one event for the subscribers. Returns 0 and counts a drop if the
+// queue is full. The slot is filled before the head moves past it, so the
+// consumer never sees a half written event.
+int EventPost(int type, int value, const tGameLock *lock)
+{
+    unsigned long depth = head - tail;
+    if(depth >= EVENT_QUEUE)
+    {
+        eventStats.drops++;
+        return 0;
+    }
+
+    tEvent *event = &queue[head % EVENT_QUEUE];
+    event->type = type;
+    event->value = value;
+    if(lock)
+    {
+        event->lock = *lock;
+    }
+    head++;
+
+    eventStats.posted[type]++;
+    if(depth + 1 > eventStats.maxDepth)
+    {
+        eventStats.maxDepth = depth + 1;
+    }
+    return 1;
+}
+
+// Posts the events one game step caused from the engine's counts, which see
+// everything even when a piece is dealt, moved and locked in one step. The
+// engine does them in that order, so the events come out in it too.
+void EventWatch(const tGame *game)
+{
+    // A piece dealt and locked in the same step is the one in lastLock
+    int shape = game->shape >= 0 ? game->shape : game->lastLock.shape;
+
+    for(; lastSpawns != game->spawns; lastSpawns++)
+    {
+        EventPost(EVENT_SPAWN, shape, 0);
+    }
+    for(; lastRotations != game->rotations; lastRotations++)
+    {
+        EventPost(EVENT_ROTATE, 0, 0);
+    }
+    for(; lastLeft != game->movesLeft; lastLeft++)
+    {
+        EventPost(EVENT_MOVE, 0, 0);
+    }
+    for(; lastRight != game->movesRight; lastRight++)
+    {
+        EventPost(EVENT_MOVE, 1, 0);
+    }
+
+    if(game->locks != lastLocks)
+    {
+        EventPost(EVENT_LOCK, 0, &game->lastLock);
+        if(game->lastLock.lines)
+        {
+            EventPost(EVENT_LINES, game->lastLock.lines, 0);
+        }
+        if(game->lastLock.lines == 4)
+        {
+            EventPost(EVENT_TETRIS, 4, 0);
+        }
+        lastLocks = game->locks;
+    }
+
+    if(game->gameover && !lastGameover)
+    {
+        EventPost(EVENT_GAMEOVER, 0, 0);
+    }
+    lastGameover = game->gameover;
+}
+
+int EventPending(void)
+{
+    return head != tail;
+}
+
+// Hands up to EVENT_BATCH waiting events to every subscriber in turn.
+// Returns 1 if more are left for the next drain.
+int EventDrain(void)
+{
+    unsigned long end = head;
+    if(end - tail > EVENT_BATCH)
+    {
+        end = tail + EVENT_BATCH;
+    }
+    if(end == tail)
+    {
+        return 0;
+    }
+
+    unsigned long i;
+    for(i = tail; i != end; i++)
+    {
+        int s;
+        for(s = 0; s < subscriberCount; s++)
+        {
+            subscribers[s](&queue[i % EVENT_QUEUE]);
+        }
+    }
+    tail = end; // Frees the slots for the producer
+    eventStats.drains++;
+
+    return head != tail;
+}
@@ -0,0 +1,46 @@
+#ifndef __EVENTS_H__
+#define __EVENTS_H__
+
+#include "game.h"
+
+// Game events, posted by the one producer that steps the game and drained
+// by the main loop, which hands each to every subscriber. The queue is a
+// ring indexed by free running counts: the producer only writes the head
+// and the consumer only the tail, so neither masks interrupts.
+#define EVENT_SPAWN    0 // New piece in play, value holds its shape
+#define EVENT_MOVE     1 // Piece moved sideways, value 1 if to the right
+#define EVENT_ROTATE   2 // Piece turned clockwise
+#define EVENT_LOCK     3 // Piece locked, lock holds the details
+#define EVENT_LINES    4 // Lines cleared by the lock, value holds how many
+#define EVENT_TETRIS   5 // Follows EVENT_LINES for four lines
+#define EVENT_GAMEOVER 6 // Value 1 if the computer's board ended a split game
+#define EVENT_TYPES    7
+
+#define EVENT_QUEUE       32 // A power of two, so the counts wrap cleanly
+#define EVENT_BATCH       8  // Events handed to the subscribers per drain
+#define EVENT_SUBSCRIBERS 4
+
+typedef struct
+{
+    unsigned char type;
+    unsigned char value;
+    tGameLock lock; // EVENT_LOCK only
+} tEvent;
+
+typedef struct
+{
+    unsigned long posted[EVENT_TYPES];
+    unsigned long drops;    // Posts that found the queue full
+    unsigned long drains;   // Batches handed to the subscribers
+    unsigned long maxDepth; // Most events waiting at one post
+} tEventStats;
+
+extern tEventStats eventStats;
+
+extern void EventSubscribe(void (*handler)(const tEvent *event));
+extern int EventPost(int type, int value, const tGameLock *lock);
+extern void EventWatch(const tGame *game);
+extern int EventPending(void);
+extern int EventDrain(void);
+
+#endif
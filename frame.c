@@ -0,0 +1,256 @@
+#include <string.h>
+#include "frame.h"
+
+// 5x7 font for characters 0x20 to 0x7E, one byte per column with the top
+// row in bit 0. Characters take 6x8 pixels, like RIT128x96x4StringDraw.
+static const unsigned char font[95][5] =
+{
+    { 0x00, 0x00, 0x00, 0x00, 0x00 }, // " "
+    { 0x00, 0x00, 0x4F, 0x00, 0x00 }, // !
+    { 0x00, 0x07, 0x00, 0x07, 0x00 }, // "
+    { 0x14, 0x7F, 0x14, 0x7F, 0x14 }, // #
+    { 0x24, 0x2A, 0x7F, 0x2A, 0x12 }, // $
+    { 0x23, 0x13, 0x08, 0x64, 0x62 }, // %
+    { 0x36, 0x49, 0x55, 0x22, 0x50 }, // &
+    { 0x00, 0x05, 0x03, 0x00, 0x00 }, // '
+    { 0x00, 0x1C, 0x22, 0x41, 0x00 }, // (
+    { 0x00, 0x41, 0x22, 0x1C, 0x00 }, // )
+    { 0x14, 0x08, 0x3E, 0x08, 0x14 }, // *
+    { 0x08, 0x08, 0x3E, 0x08, 0x08 }, // +
+    { 0x00, 0x50, 0x30, 0x00, 0x00 }, // ,
+    { 0x08, 0x08, 0x08, 0x08, 0x08 }, // -
+    { 0x00, 0x60, 0x60, 0x00, 0x00 }, // .
+    { 0x20, 0x10, 0x08, 0x04, 0x02 }, // /
+    { 0x3E, 0x51, 0x49, 0x45, 0x3E }, // 0
+    { 0x00, 0x42, 0x7F, 0x40, 0x00 }, // 1
+    { 0x42, 0x61, 0x51, 0x49, 0x46 }, // 2
+    { 0x21, 0x41, 0x45, 0x4B, 0x31 }, // 3
+    { 0x18, 0x14, 0x12, 0x7F, 0x10 }, // 4
+    { 0x27, 0x45, 0x45, 0x45, 0x39 }, // 5
+    { 0x3C, 0x4A, 0x49, 0x49, 0x30 }, // 6
+    { 0x01, 0x71, 0x09, 0x05, 0x03 }, // 7
+    { 0x36, 0x49, 0x49, 0x49, 0x36 }, // 8
+    { 0x06, 0x49, 0x49, 0x29, 0x1E }, // 9
+    { 0x00, 0x36, 0x36, 0x00, 0x00 }, // :
+    { 0x00, 0x56, 0x36, 0x00, 0x00 }, // ;
+    { 0x08, 0x14, 0x22, 0x41, 0x00 }, // <
+    { 0x14, 0x14, 0x14, 0x14, 0x14 }, // =
+    { 0x00, 0x41, 0x22, 0x14, 0x08 }, // >
+    { 0x02, 0x01, 0x51, 0x09, 0x06 }, // ?
+    { 0x32, 0x49, 0x79, 0x41, 0x3E }, // @
+    { 0x7E, 0x11, 0x11, 0x11, 0x7E }, // A
+    { 0x7F, 0x49, 0x49, 0x49, 0x36 }, // B
+    { 0x3E, 0x41, 0x41, 0x41, 0x22 }, // C
+    { 0x7F, 0x41, 0x41, 0x22, 0x1C }, // D
+    { 0x7F, 0x49, 0x49, 0x49, 0x41 }, // E
+    { 0x7F, 0x09, 0x09, 0x09, 0x01 }, // F
+    { 0x3E, 0x41, 0x49, 0x49, 0x7A }, // G
+    { 0x7F, 0x08, 0x08, 0x08, 0x7F }, // H
+    { 0x00, 0x41, 0x7F, 0x41, 0x00 }, // I
+    { 0x20, 0x40, 0x41, 0x3F, 0x01 }, // J
+    { 0x7F, 0x08, 0x14, 0x22, 0x41 }, // K
+    { 0x7F, 0x40, 0x40, 0x40, 0x40 }, // L
+    { 0x7F, 0x02, 0x0C, 0x02, 0x7F }, // M
+    { 0x7F, 0x04, 0x08, 0x10, 0x7F }, // N
+    { 0x3E, 0x41, 0x41, 0x41, 0x3E }, // O
+    { 0x7F, 0x09, 0x09, 0x09, 0x06 }, // P
+    { 0x3E, 0x41, 0x51, 0x21, 0x5E }, // Q
+    { 0x7F, 0x09, 0x19, 0x29, 0x46 }, // R
+    { 0x46, 0x49, 0x49, 0x49, 0x31 }, // S
+    { 0x01, 0x01, 0x7F, 0x01, 0x01 }, // T
+    { 0x3F, 0x40, 0x40, 0x40, 0x3F }, // U
+    { 0x1F, 0x20, 0x40, 0x20, 0x1F }, // V
+    { 0x3F, 0x40, 0x38, 0x40, 0x3F }, // W
+    { 0x63, 0x14, 0x08, 0x14, 0x63 }, // X
+    { 0x07, 0x08, 0x70, 0x08, 0x07 }, // Y
+    { 0x61, 0x51, 0x49, 0x45, 0x43 }, // Z
+    { 0x00, 0x7F, 0x41, 0x41, 0x00 }, // [
+    { 0x02, 0x04, 0x08, 0x10, 0x20 }, // backslash
+    { 0x00, 0x41, 0x41, 0x7F, 0x00 }, // ]
+    { 0x04, 0x02, 0x01, 0x02, 0x04 }, // ^
+    { 0x40, 0x40, 0x40, 0x40, 0x40 }, // _
+    { 0x00, 0x01, 0x02, 0x04, 0x00 }, // `
+    { 0x20, 0x54, 0x54, 0x54, 0x78 }, // a
+    { 0x7F, 0x48, 0x44, 0x44, 0x38 }, // b
+    { 0x38, 0x44, 0x44, 0x44, 0x20 }, // c
+    { 0x38, 0x44, 0x44, 0x48, 0x7F }, // d
+    { 0x38, 0x54, 0x54, 0x54, 0x18 }, // e
+    { 0x08, 0x7E, 0x09, 0x01, 0x02 }, // f
+    { 0x0C, 0x52, 0x52, 0x52, 0x3E }, // g
+    { 0x7F, 0x08, 0x04, 0x04, 0x78 }, // h
+    { 0x00, 0x44, 0x7D, 0x40, 0x00 }, // i
+    { 0x20, 0x40, 0x44, 0x3D, 0x00 }, // j
+    { 0x7F, 0x10, 0x28, 0x44, 0x00 }, // k
+    { 0x00, 0x41, 0x7F, 0x40, 0x00 }, // l
+    { 0x7C, 0x04, 0x18, 0x04, 0x78 }, // m
+    { 0x7C, 0x08, 0x04, 0x04, 0x78 }, // n
+    { 0x38, 0x44, 0x44, 0x44, 0x38 }, // o
+    { 0x7C, 0x14, 0x14, 0x14, 0x08 }, // p
+    { 0x08, 0x14, 0x14, 0x18, 0x7C }, // q
+    { 0x7C, 0x08, 0x04, 0x04, 0x08 }, // r
+    { 0x48, 0x54, 0x54, 0x54, 0x20 }, // s
+    { 0x04, 0x3F, 0x44, 0x40, 0x20 }, // t
+    { 0x3C, 0x40, 0x40, 0x20, 0x7C }, // u
+    { 0x1C, 0x20, 0x40, 0x20, 0x1C }, // v
+    { 0x3C, 0x40, 0x30, 0x40, 0x3C }, // w
+    { 0x44, 0x28, 0x10, 0x28, 0x44 }, // x
+    { 0x0C, 0x50, 0x50, 0x50, 0x3C }, // y
+    { 0x44, 0x64, 0x54, 0x4C, 0x44 }, // z
+    { 0x00, 0x08, 0x36, 0x41, 0x00 }, // {
+    { 0x00, 0x00, 0x7F, 0x00, 0x00 }, // |
+    { 0x00, 0x41, 0x36, 0x08, 0x00 }, // }
+    { 0x0C, 0x02, 0x0C, 0x10, 0x0C }  // ~
+};
+
+// Copies a 4bpp image into the frame. x and width must be even, as for
+// RIT128x96x4ImageDraw.
+void FrameImageDraw(unsigned char *frame, const unsigned char *image,
+                    int x, int y, int width, int height)
+{
+    int i;
+    for(i = 0; i < height; i++)
+    {
+        memcpy(&frame[(y + i) * FRAME_STRIDE + x / 2], &image[i * (width / 2)], width / 2);
+    }
+}
+
+// Draws a string at brightness level 0 to 15 over a black background,
+// clipped at the right edge. x must be even.
+void FrameStringDraw(unsigned char *frame, const char *str, int x, int y, int level)
+{
+    for(; *str && x + 6 <= FRAME_WIDTH; str++, x += 6)
+    {
+        int c = *str;
+        const unsigned char *glyph = font[c >= ' ' && c <= '~' ? c - ' ' : 0];
+
+        int row;
+        for(row = 0; row < 8; row++)
+        {
+            unsigned char *out = &frame[(y + row) * FRAME_STRIDE + x / 2];
+
+            int col;
+            for(col = 0; col < 6; col += 2)
+            {
+                int left = col < 5 && (glyph[col] >> row) & 1 ? level : 0;
+                int right = col + 1 < 5 && (glyph[col + 1] >> row) & 1 ? level : 0;
+                out[col / 2] = (left << 4) | right;
+            }
+        }
+    }
+}
+
+// Frames are encoded as the XOR against the previous frame, run length
+// coded. Each token starts with a control byte:
+//   0x00-0x7F  (n & 0x7F) + 1 unchanged bytes
+//   0x80-0xBF  the next byte repeated (n & 0x3F) + 1 times
+//   0xC0-0xFF  (n & 0x3F) + 1 literal bytes follow
+// Decoding needs only the previous frame, so memory use does not grow with
+// the length of a recording.
+
+// Encodes frame against previous, then updates previous to match. out must
+// hold FRAME_DELTA_MAX bytes. Returns the encoded length.
+int FrameEncode(const unsigned char *frame, unsigned char *previous, unsigned char *out)
+{
+    int length = 0;
+    int i = 0;
+
+    while(i < FRAME_BYTES)
+    {
+        unsigned char delta = frame[i] ^ previous[i];
+        int limit = delta ? 64 : 128;
+
+        int run = 1;
+        while(i + run < FRAME_BYTES && run < limit && (frame[i + run] ^ previous[i + run]) == delta)
+        {
+            run++;
+        }
+
+        if(!delta)
+        {
+            out[length++] = run - 1;
+        }
+        else if(run >= 3)
+        {
+            out[length++] = 0x80 | (run - 1);
+            out[length++] = delta;
+        }
+        else
+        {
+            // Literals up to the next run of three, changed or not
+            run = 1;
+            while(i + run < FRAME_BYTES && run < 64)
+            {
+                unsigned char next = frame[i + run] ^ previous[i + run];
+                if(i + run + 2 < FRAME_BYTES &&
+                   next == (frame[i + run + 1] ^ previous[i + run + 1]) &&
+                   next == (frame[i + run + 2] ^ previous[i + run + 2]))
+                {
+                    break;
+                }
+                run++;
+            }
+
+            out[length++] = 0xC0 | (run - 1);
+            int j;
+            for(j = 0; j < run; j++)
+            {
+                out[length++] = frame[i + j] ^ previous[i + j];
+            }
+        }
+
+        i += run;
+    }
+
+    memcpy(previous, frame, FRAME_BYTES);
+    return length;
+}
+
+// Applies an encoded frame to the previous one in place. Returns 0 if the
+// data does not cover exactly one frame.
+int FrameDecode(const unsigned char *in, int length, unsigned char *frame)
+{
+    int i = 0;
+    int pos = 0;
+
+    while(pos < length)
+    {
+        int token = in[pos++];
+        int run = (token & (token & 0x80 ? 0x3F : 0x7F)) + 1;
+        if(i + run > FRAME_BYTES)
+        {
+            return 0;
+        }
+
+        if(token < 0x80)
+        {
+            i += run;
+        }
+        else if(token < 0xC0)
+        {
+            if(pos >= length)
+            {
+                return 0;
+            }
+
+            unsigned char delta = in[pos++];
+            while(run--)
+            {
+                frame[i++] ^= delta;
+            }
+        }
+        else
+        {
+            if(pos + run > length)
+            {
+                return 0;
+            }
+
+            while(run--)
+            {
+                frame[i++] ^= in[pos++];
+            }
+        }
+    }
+
+    return i == FRAME_BYTES;
+}
@@ -0,0 +1,20 @@
+#ifndef __FRAME_H__
+#define __FRAME_H__
+
+// In-memory copy of the 128x96 display, 4 bits per pixel with the left pixel
+// of each pair in the high nibble, the same layout RIT128x96x4ImageDraw takes
+#define FRAME_WIDTH  128
+#define FRAME_HEIGHT 96
+#define FRAME_STRIDE (FRAME_WIDTH / 2)
+#define FRAME_BYTES  (FRAME_STRIDE * FRAME_HEIGHT)
+
+// Largest encoded frame, no runs at all so everything is sent as literals
+#define FRAME_DELTA_MAX (FRAME_BYTES + FRAME_BYTES / 64 + 1)
+
+extern void FrameImageDraw(unsigned char *frame, const unsigned char *image,
+                           int x, int y, int width, int height);
+extern void FrameStringDraw(unsigned char *frame, const char *str, int x, int y, int level);
+extern int FrameEncode(const unsigned char *frame, unsigned char *previous, unsigned char *out);
+extern int FrameDecode(const unsigned char *in, int length, unsigned char *frame);
+
+#endif
@@ -0,0 +1,683 @@
+#include <string.h>
+#include "game.h"
+
+// Board limits
+#define maxX (GAME_COLS - 1)
+#define maxY (GAME_ROWS - 1)
+
+// Shape definitions rotated clockwise, generated from the original 2x2, 3x3
+// and 4x4 matrices so every orientation keeps its place in the bounding box
+const unsigned short shapeMasks[7][4] =
+{
+    { 0x0033, 0x0033, 0x0033, 0x0033 }, // O
+    { 0x2222, 0x00F0, 0x4444, 0x0F00 }, // I
+    { 0x0036, 0x0462, 0x0360, 0x0231 }, // S
+    { 0x0063, 0x0264, 0x0630, 0x0132 }, // Z
+    { 0x0311, 0x0017, 0x0446, 0x0740 }, // L
+    { 0x0322, 0x0071, 0x0226, 0x0470 }, // J
+    { 0x0027, 0x0464, 0x0720, 0x0131 }  // T
+};
+
+// Garbage lines sent to the opponent per number of lines cleared
+static const int garbageLines[5] = { 0, 0, 1, 2, 4 };
+
+// Same generator as the ANSI C rand() example, kept in the game state so a
+// snapshot captures it and the sequence is identical on host and target
+static int GameRand(tGame *game)
+{
+    game->seed = (game->seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return (int)((game->seed >> 16) & 0x7FFF);
+}
+
+static void SetCell(tGame *game, int x, int y, int value)
+{
+    unsigned char *pair = &game->grid[y][x >> 1];
+    int shift = (x & 1) << 2;
+    *pair = (*pair & ~(0xF << shift)) | (value << shift);
+}
+
+// A row is full when none of its nibbles is zero. Cells are at most 8, so
+// subtracting one from every nibble only borrows out of a zero one, which
+// tests eight cells with one subtract.
+static int RowFull(const unsigned char *row)
+{
+    int i, k;
+    for(i = 0; i < GAME_ROW_BYTES; i += 4)
+    {
+        unsigned long word = 0;
+        for(k = 0; k < 4; k++)
+        {
+            // Pad past the end of the row with filled cells
+            word |= (unsigned long)(i + k < GAME_ROW_BYTES ? row[i + k] : 0x11) << (8 * k);
+        }
+        if((word - 0x11111111UL) & ~word & 0x88888888UL)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int ValidButtonCombo(int input)
+{
+    // At most one button at a time
+    return (input & (input - 1)) == 0;
+}
+
+static int CheckPosition(tGame *game, int mask, int newX, int newY)
+{
+    int i, j;
+#ifdef __TI_COMPILER_VERSION__
+    #pragma UNROLL(4)
+#endif
+    for(i = 0; i < 4; i++)
+    {
+#ifdef __TI_COMPILER_VERSION__
+        #pragma UNROLL(4)
+#endif
+        for(j = 0; j < 4; j++)
+        {
+            if(mask & (1 << (i * 4 + j)))
+            {
+                int thisY = newY + i;
+                if(thisY < 0 || thisY > maxY)
+                {
+                    return 0;
+                }
+
+                int thisX = newX + j;
+                if(thisX < 0 || thisX > maxX)
+                {
+                    return 0;
+                }
+
+                if(GAME_CELL(game, thisX, thisY))
+                {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    return 1;
+}
+
+static int TryChangeOrientation(tGame *game)
+{
+    int next = (game->orientation + 1) & 3;
+
+    if(CheckPosition(game, shapeMasks[game->shape][next], game->locationX, game->locationY))
+    {
+        game->orientation = next;
+        game->rotations++;
+        return 1;
+    }
+
+    return 0;
+}
+
+static int TryMove(tGame *game, int newX, int newY)
+{
+    if(CheckPosition(game, shapeMasks[game->shape][game->orientation], newX, newY))
+    {
+        game->locationX = newX;
+        game->locationY = newY;
+        return 1;
+    }
+    return 0;
+}
+
+static void StoreShape(tGame *game)
+{
+    int mask = shapeMasks[game->shape][game->orientation];
+
+    int i, j;
+    for(i = 0; i < 4; i++)
+    {
+        for(j = 0; j < 4; j++)
+        {
+            if(mask & (1 << (i * 4 + j)))
+            {
+                int y = game->locationY + i;
+                int x = game->locationX + j;
+                SetCell(game, x, y, game->shape + 1);
+
+                int top = GAME_ROWS - game->heights[x];
+                if(y < top)
+                {
+                    // New top of the column, the gap below it becomes holes
+                    game->holes[x] += top - y - 1;
+                    game->heights[x] = GAME_ROWS - y;
+                }
+                else
+                {
+                    game->holes[x]--; // Filled a hole
+                }
+            }
+        }
+    }
+}
+
+static void RemoveLine(tGame *game, int lineIndex)
+{
+    // Move the rows above down over it and clear the top line
+    memmove(game->grid[1], game->grid[0], lineIndex * GAME_ROW_BYTES);
+    memset(game->grid[0], 0, GAME_ROW_BYTES);
+
+    int i, j;
+    // The line was full, so every column loses one cell
+    for(j = 0; j <= maxX; j++)
+    {
+        int top = GAME_ROWS - game->heights[j];
+        if(top < lineIndex)
+        {
+            game->heights[j]--; // The cells above drop one row
+        }
+        else
+        {
+            // The removed cell was the top, the next one down is the new top
+            for(i = lineIndex + 1; i <= maxY && !GAME_CELL(game, j, i); i++)
+            {
+                game->holes[j]--;
+            }
+            game->heights[j] = GAME_ROWS - i;
+        }
+    }
+}
+
+// Only the rows the piece landed in can have filled. They are removed from
+// the top down so the rows still to be removed stay where they are.
+static int ClearLines(tGame *game)
+{
+    int full = 0;
+    int i;
+    for(i = 0; i < 4; i++)
+    {
+        int y = game->locationY + i;
+        if(y >= 0 && y <= maxY && RowFull(game->grid[y]))
+        {
+            full |= 1 << i;
+        }
+    }
+
+    int linesRemoved = 0;
+    for(i = 0; i < 4; i++)
+    {
+        if(full & (1 << i))
+        {
+            RemoveLine(game, game->locationY + i);
+            linesRemoved++;
+        }
+    }
+
+    game->lastLock.cleared = full;
+    return linesRemoved;
+}
+
+static void UpdateScore(tGame *game, int numLines)
+{
+    if(numLines == 0)
+    {
+        game->score += 10;
+        return;
+    }
+    if(numLines == 4)
+    {
+        if(game->tetris)
+        {
+            game->score += 1200;
+        }
+        else
+        {
+            game->tetris = 1;
+            game->score += 800;
+        }
+        return;
+    }
+
+    game->tetris = 0;
+    game->score += numLines * 100;
+}
+
+// Measures the board metrics from the grid
+static void MeasureBoard(const tGame *game, unsigned char *heights, unsigned char *holes)
+{
+    int i, j;
+    memset(heights, 0, GAME_COLS);
+    memset(holes, 0, GAME_COLS);
+
+    for(i = 0; i <= maxY; i++)
+    {
+        for(j = 0; j <= maxX; j++)
+        {
+            if(GAME_CELL(game, j, i))
+            {
+                if(!heights[j])
+                {
+                    heights[j] = GAME_ROWS - i;
+                }
+            }
+            else if(heights[j])
+            {
+                holes[j]++;
+            }
+        }
+    }
+}
+
+// Rebuilds the board metrics after a bulk change
+static void ComputeMetrics(tGame *game)
+{
+    MeasureBoard(game, game->heights, game->holes);
+}
+
+// Pushes the board up and fills the bottom rows, leaving one open column
+static void AddGarbage(tGame *game, int numLines)
+{
+    int hole = GameRand(game) % (maxX + 1);
+
+    int i, j;
+    for(i = 0; i < numLines; i++)
+    {
+        for(j = 0; j < GAME_ROW_BYTES; j++)
+        {
+            if(game->grid[i][j])
+            {
+                game->gameover = 1; // Stack pushed out of the top
+            }
+        }
+    }
+
+    memmove(game->grid[0], game->grid[numLines], (GAME_ROWS - numLines) * GAME_ROW_BYTES);
+
+    for(j = 0; j <= maxX; j++)
+    {
+        SetCell(game, j, GAME_ROWS - numLines, j != hole ? GAME_CELL_GARBAGE : 0);
+    }
+    for(i = GAME_ROWS - numLines + 1; i <= maxY; i++)
+    {
+        memcpy(game->grid[i], game->grid[i - 1], GAME_ROW_BYTES);
+    }
+
+    ComputeMetrics(game);
+}
+
+static void LockShape(tGame *game)
+{
+    // Storing over filled cells would break the metrics, end the game instead
+    if(!CheckPosition(game, shapeMasks[game->shape][game->orientation], game->locationX, game->locationY))
+    {
+        game->gameover = 1;
+        return;
+    }
+
+    tGameLock *lock = &game->lastLock;
+    lock->shape = game->shape;
+    lock->orientation = game->orientation;
+    lock->x = game->locationX;
+    lock->y = game->locationY;
+    int score = game->score;
+
+    StoreShape(game);
+    int numLines = ClearLines(game);
+    UpdateScore(game, numLines);
+
+    lock->lines = numLines;
+    lock->score = game->score - score;
+    lock->height = 0;
+    int j;
+    for(j = 0; j <= maxX; j++)
+    {
+        if(game->heights[j] > lock->height)
+        {
+            lock->height = game->heights[j];
+        }
+    }
+    game->locks++;
+
+    // Cleared lines cancel queued garbage first, the rest goes to the opponent
+    int sent = garbageLines[numLines];
+    int cancelled = sent < game->garbageIn ? sent : game->garbageIn;
+    game->garbageIn -= cancelled;
+    game->garbageOut += sent - cancelled;
+
+    lock->garbage = 0;
+    if(game->garbageIn)
+    {
+        lock->garbage = game->garbageIn > maxY ? maxY : game->garbageIn;
+        AddGarbage(game, lock->garbage);
+        game->garbageIn = 0;
+    }
+
+    game->shape = -1;
+}
+
+static void GetNextShape(tGame *game)
+{
+    int r = GameRand(game);
+
+    if(game->nextShape < 0)
+    {
+        game->nextShape = r % 7;
+    }
+
+    game->shape = game->nextShape;
+    game->nextShape = r % 7;
+
+    game->locationX = GAME_SPAWN_X;
+    game->locationY = GAME_SPAWN_Y;
+    game->orientation = O_000;
+
+    if(!TryMove(game, game->locationX, game->locationY))
+    {
+        game->gameover = 1;
+        return;
+    }
+    game->spawns++;
+}
+
+// Returns 1 if the piece fits on the board at the given pose
+int GameFits(tGame *game, int shape, int orientation, int x, int y)
+{
+    return CheckPosition(game, shapeMasks[shape][orientation], x, y);
+}
+
+// Rows a piece at the given pose can fall before it lands. Each column of the
+// piece is compared against the column height; only a piece tucked under an
+// overhang needs the cell by cell search.
+int GameDropDistanceAt(tGame *game, int shape, int orientation, int x, int y)
+{
+    int mask = shapeMasks[shape][orientation];
+    int distance = maxY;
+
+    int j;
+    for(j = 0; j < 4; j++)
+    {
+        int column = (mask >> j) & 0x1111;
+        if(!column)
+        {
+            continue;
+        }
+
+        int bottom = y + (column & 0x1000 ? 3 : column & 0x0100 ? 2 : column & 0x0010 ? 1 : 0);
+        int top = GAME_ROWS - game->heights[x + j];
+        if(bottom >= top)
+        {
+            distance = 0;
+            while(CheckPosition(game, mask, x, y + distance + 1))
+            {
+                distance++;
+            }
+            return distance;
+        }
+
+        if(top - 1 - bottom < distance)
+        {
+            distance = top - 1 - bottom;
+        }
+    }
+
+    return distance;
+}
+
+// Rows the current piece can fall before it lands
+int GameDropDistance(tGame *game)
+{
+    return GameDropDistanceAt(game, game->shape, game->orientation, game->locationX, game->locationY);
+}
+
+void GameInit(tGame *game, unsigned long seed)
+{
+    memset(game, 0, sizeof(tGame));
+    game->shape = -1;
+    game->nextShape = -1;
+    game->seed = seed;
+}
+
+// Advances the game by one timer tick. Returns 1 if the board needs redrawing.
+int GameStep(tGame *game, int input)
+{
+    int changed = 0;
+
+    // Callers add garbage between steps, even to a board that is over
+    if(game->garbageIn > GAME_GARBAGE_MAX)
+    {
+        game->garbageIn = GAME_GARBAGE_MAX;
+    }
+
+    if(game->gameover)
+    {
+        return 0;
+    }
+
+    if(game->shape < 0)
+    {
+        GetNextShape(game);
+        changed = 1;
+        if(game->gameover)
+        {
+            return changed; // Blocked spawn, nothing may lock over the stack
+        }
+    }
+
+    int pressed = input & ~game->buttons;
+    int released = ~input & game->buttons;
+    if(ValidButtonCombo(input))
+    {
+        if(released & INPUT_RR)
+        {
+            if(TryChangeOrientation(game))
+            {
+                changed = 1;
+                game->seed = game->dropCounter;
+            }
+        }
+        if((pressed & INPUT_L) || ((input & INPUT_L) && game->dropCounter % 10 == 0)) // Throttle to 1/10th seconds
+        {
+            if(TryMove(game, game->locationX - 1, game->locationY))
+            {
+                game->movesLeft++;
+                changed = 1;
+                game->seed = game->dropCounter;
+            }
+        }
+        if((pressed & INPUT_R) || ((input & INPUT_R) && game->dropCounter % 10 == 0))
+        {
+            if(TryMove(game, game->locationX + 1, game->locationY))
+            {
+                game->movesRight++;
+                changed = 1;
+                game->seed = game->dropCounter;
+            }
+        }
+        if(input & INPUT_U) // Continuous press
+        {
+            if(TryMove(game, game->locationX, game->locationY + 1))
+            {
+                changed = 1;
+            }
+        }
+        if(pressed & INPUT_D)
+        {
+            game->locationY += GameDropDistance(game);
+            LockShape(game);
+            game->dropCounter = 0;
+            changed = 1;
+        }
+    }
+
+    game->buttons = input;
+
+    game->dropCounter++;
+    if(game->dropCounter == GAME_DROP_TICKS)
+    {
+        if(game->shape >= 0 && !TryMove(game, game->locationX, game->locationY + 1))
+        {
+            // Hit bottom or another piece
+            LockShape(game);
+        }
+
+        game->dropCounter = 0;
+        changed = 1;
+    }
+
+    return changed;
+}
+
+static void Write32(unsigned char *buf, unsigned long value)
+{
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+    buf[2] = (value >> 16) & 0xFF;
+    buf[3] = (value >> 24) & 0xFF;
+}
+
+static unsigned long Read32(const unsigned char *buf)
+{
+    return buf[0] | (buf[1] << 8) | ((unsigned long)buf[2] << 16) | ((unsigned long)buf[3] << 24);
+}
+
+// Packs the piece, counters and seed, the part of a snapshot after the grid:
+//  0     shape + 1
+//  1     next shape + 1
+//  2     orientation
+//  3-4   location (signed)
+//  5     drop counter
+//  6     previous input mask
+//  7     flags (bit 0 tetris, bit 1 game over)
+//  8-9   garbage in/out
+//  10-13 score
+//  14-17 random seed
+static void SaveState(const tGame *game, unsigned char *buf)
+{
+    buf[0] = game->shape + 1;
+    buf[1] = game->nextShape + 1;
+    buf[2] = game->orientation;
+    buf[3] = (unsigned char)game->locationX;
+    buf[4] = (unsigned char)game->locationY;
+    buf[5] = game->dropCounter;
+    buf[6] = game->buttons;
+    buf[7] = (game->tetris ? 1 : 0) | (game->gameover ? 2 : 0);
+    buf[8] = game->garbageIn;
+    buf[9] = game->garbageOut;
+    Write32(&buf[10], game->score);
+    Write32(&buf[14], game->seed);
+}
+
+// Packs the game into GAME_SNAPSHOT_SIZE bytes. The grid goes in as it is,
+// shades included, so a restored board draws and hashes the same.
+void GameSave(const tGame *game, unsigned char *buf)
+{
+    memcpy(buf, game->grid, GAME_BOARD_BYTES);
+    SaveState(game, &buf[GAME_BOARD_BYTES]);
+}
+
+void GameRestore(tGame *game, const unsigned char *buf)
+{
+    memcpy(game->grid, buf, GAME_BOARD_BYTES);
+
+    buf += GAME_BOARD_BYTES;
+    game->shape = buf[0] - 1;
+    game->nextShape = buf[1] - 1;
+    game->orientation = buf[2];
+    game->locationX = (signed char)buf[3];
+    game->locationY = (signed char)buf[4];
+    game->dropCounter = buf[5];
+    game->buttons = buf[6];
+    game->tetris = buf[7] & 1;
+    game->gameover = (buf[7] >> 1) & 1;
+    game->garbageIn = buf[8];
+    game->garbageOut = buf[9];
+    game->score = Read32(&buf[10]);
+    game->seed = Read32(&buf[14]);
+
+    ComputeMetrics(game);
+}
+
+// FNV-1a over the snapshot, chained through hash so several boards can be
+// combined. Start with 2166136261. The grid is read in place so only the
+// state after it needs a buffer.
+unsigned long GameHash(const tGame *game, unsigned long hash)
+{
+    unsigned char buf[GAME_SNAPSHOT_SIZE - GAME_BOARD_BYTES];
+    SaveState(game, buf);
+
+    const unsigned char *grid = (const unsigned char *)game->grid;
+    int i;
+    for(i = 0; i < GAME_BOARD_BYTES; i++)
+    {
+        hash = ((hash ^ grid[i]) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    for(i = 0; i < (int)sizeof(buf); i++)
+    {
+        hash = ((hash ^ buf[i]) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+
+    return hash;
+}
+
+// Filled columns of one row, bit j set for column j
+unsigned short GameRowBits(const tGame *game, int row)
+{
+    unsigned short bits = 0;
+    int i;
+    for(i = 0; i < GAME_ROW_BYTES; i++)
+    {
+        int pair = game->grid[row][i];
+        bits |= ((pair & 0x0F ? 1 : 0) | (pair & 0xF0 ? 2 : 0)) << (2 * i);
+    }
+    return bits;
+}
+
+// Checks the structural invariants that must hold between steps. Returns
+// GAME_OK or the first violation found.
+int GameCheck(tGame *game)
+{
+    unsigned char heights[GAME_COLS];
+    unsigned char holes[GAME_COLS];
+
+    int i;
+    for(i = 0; i < GAME_CELLS; i++)
+    {
+        if(GAME_CELL(game, i % GAME_COLS, i / GAME_COLS) > GAME_CELL_GARBAGE)
+        {
+            return GAME_BAD_CELL;
+        }
+    }
+
+    MeasureBoard(game, heights, holes);
+    if(memcmp(heights, game->heights, GAME_COLS) || memcmp(holes, game->holes, GAME_COLS))
+    {
+        return GAME_BAD_METRICS;
+    }
+
+    for(i = 0; i < GAME_ROWS; i++)
+    {
+        if(RowFull(game->grid[i]))
+        {
+            return GAME_FULL_ROW;
+        }
+    }
+
+    if(game->shape < -1 || game->shape > S_T || game->nextShape < -1 || game->nextShape > S_T ||
+       game->orientation < O_000 || game->orientation > O_270)
+    {
+        return GAME_BAD_PIECE;
+    }
+
+    // A piece that failed to spawn overlaps the stack at game over
+    if(game->shape >= 0 && !game->gameover &&
+       !CheckPosition(game, shapeMasks[game->shape][game->orientation], game->locationX, game->locationY))
+    {
+        return GAME_BAD_PIECE;
+    }
+
+    if(game->dropCounter < 0 || game->dropCounter >= GAME_DROP_TICKS ||
+       game->garbageIn < 0 || game->garbageIn > GAME_GARBAGE_MAX + 4 || // Plus one lock sent since
+       game->garbageOut < 0 || game->score < 0)
+    {
+        return GAME_BAD_COUNTER;
+    }
+
+    return GAME_OK;
+}
@@ -0,0 +1,153 @@
+#ifndef __GAME_H__
+#define __GAME_H__
+
+// Board variants, selected at build time with --define=BOARD_VARIANT=n. All
+// geometry is constant so the board loops can be unrolled for each variant.
+#define BOARD_STANDARD 0 // 10x20
+#define BOARD_BUFFERED 1 // 10x40, top 20 rows hidden above the spawn row
+#define BOARD_SPRINT   2 // 6x20
+
+#ifndef BOARD_VARIANT
+#define BOARD_VARIANT BOARD_STANDARD
+#endif
+
+// Board dimensions in cells, GAME_ROWS includes the hidden rows
+#if BOARD_VARIANT == BOARD_BUFFERED
+#define GAME_COLS 10
+#define GAME_ROWS 40
+#define GAME_HIDDEN_ROWS 20
+#elif BOARD_VARIANT == BOARD_SPRINT
+#define GAME_COLS 6
+#define GAME_ROWS 20
+#define GAME_HIDDEN_ROWS 0
+#else
+#define GAME_COLS 10
+#define GAME_ROWS 20
+#define GAME_HIDDEN_ROWS 0
+#endif
+
+#define GAME_VISIBLE_ROWS (GAME_ROWS - GAME_HIDDEN_ROWS)
+#define GAME_CELLS (GAME_COLS * GAME_ROWS)
+
+// The grid holds four bits per cell, two cells to a byte with the even
+// column in the low nibble; every variant is an even number of columns. A
+// cell is 0 while empty, else the shape locked there plus one, or
+// GAME_CELL_GARBAGE for a garbage line, so each piece keeps its own shade
+// once it has locked.
+#define GAME_ROW_BYTES (GAME_COLS / 2)
+#define GAME_CELL_GARBAGE 8
+#define GAME_CELL(game, x, y) (((game)->grid[y][(x) >> 1] >> (((x) & 1) << 2)) & 0xF)
+
+// Pieces enter at the top of the visible board
+#define GAME_SPAWN_X (GAME_COLS / 2 - 1)
+#define GAME_SPAWN_Y GAME_HIDDEN_ROWS
+
+// Shapes
+#define S_O 0
+#define S_I 1
+#define S_S 2
+#define S_Z 3
+#define S_L 4
+#define S_J 5
+#define S_T 6
+
+// Orientations
+#define O_000 0
+#define O_090 1
+#define O_180 2
+#define O_270 3
+
+// Input mask, one bit per gamepad button (set while pressed)
+#define INPUT_D  0x01 // b0, hard drop on press
+#define INPUT_U  0x02 // b1, soft drop
+#define INPUT_L  0x04 // b2, move left
+#define INPUT_R  0x08 // b3, move right
+#define INPUT_RR 0x10 // b4, rotate on release
+
+// Ticks between gravity steps
+#define GAME_DROP_TICKS 100
+
+// Bytes used by GameSave/GameRestore, the grid as it is held, four bits per
+// cell, then the piece, counters and seed
+#define GAME_BOARD_BYTES (GAME_ROWS * GAME_ROW_BYTES)
+#define GAME_SNAPSHOT_SIZE (GAME_BOARD_BYTES + 18)
+
+// Queued garbage is capped at this many lines. A lock pushes in at most
+// GAME_ROWS - 1 after cancelling up to four, so more lines play out the same,
+// and the counts stay within their snapshot bytes however long an opponent
+// keeps sending.
+#define GAME_GARBAGE_MAX (GAME_ROWS + 3)
+
+// GameCheck results
+#define GAME_OK          0
+#define GAME_BAD_CELL    1 // Cell above GAME_CELL_GARBAGE
+#define GAME_BAD_METRICS 2 // Heights or holes disagree with the grid
+#define GAME_FULL_ROW    3 // Full row left on the board
+#define GAME_BAD_PIECE   4 // Shape or orientation out of range, or piece overlapping
+#define GAME_BAD_COUNTER 5 // Counter out of range
+
+// One locked piece, filled in by the engine for logging
+typedef struct
+{
+    unsigned char shape;
+    unsigned char orientation;
+    signed char x;
+    signed char y;
+    unsigned char lines;  // Lines cleared by the piece
+    unsigned char cleared; // Bit i set if row y + i was one of them
+    unsigned char garbage; // Lines pushed in below after the clear
+    unsigned char height; // Stack height after the clear
+    unsigned short score; // Score gained
+} tGameLock;
+
+// Complete state of one board. Everything the game does is a function of
+// this struct and the input mask passed to GameStep, so two instances fed the
+// same inputs stay identical.
+typedef struct
+{
+    unsigned char grid[GAME_ROWS][GAME_ROW_BYTES];
+    int shape;       // -1 while no piece is in play
+    int nextShape;   // -1 until the first piece is dealt
+    int orientation;
+    int locationX;
+    int locationY;
+    int score;
+    int tetris;
+    int gameover;
+    int dropCounter;
+    int buttons;     // Input mask from the previous step
+    unsigned long seed;
+    int garbageIn;   // Lines queued to be pushed onto this board
+    int garbageOut;  // Lines sent to the opponent, collected by the caller
+
+    // Board metrics kept up to date as cells are stored and lines removed.
+    // Derived from grid, so not part of a snapshot.
+    unsigned char heights[GAME_COLS]; // Rows from the floor to the top filled cell
+    unsigned char holes[GAME_COLS];   // Empty cells below the top filled cell
+
+    // Last piece locked and counts of what the pieces did, for logging and
+    // events. Not part of a snapshot either.
+    unsigned long locks;      // Pieces locked since GameInit
+    unsigned long spawns;     // Pieces dealt into play
+    unsigned long rotations;  // Rotations made
+    unsigned long movesLeft;  // Moves made to each side
+    unsigned long movesRight;
+    tGameLock lastLock;
+} tGame;
+
+// Piece cells for each shape and orientation as a 4x4 bitmask, bit
+// (row * 4 + column) set for each filled cell.
+extern const unsigned short shapeMasks[7][4];
+
+extern void GameInit(tGame *game, unsigned long seed);
+extern int GameStep(tGame *game, int input);
+extern void GameSave(const tGame *game, unsigned char *buf);
+extern void GameRestore(tGame *game, const unsigned char *buf);
+extern unsigned long GameHash(const tGame *game, unsigned long hash);
+extern int GameDropDistance(tGame *game);
+extern int GameFits(tGame *game, int shape, int orientation, int x, int y);
+extern int GameDropDistanceAt(tGame *game, int shape, int orientation, int x, int y);
+extern unsigned short GameRowBits(const tGame *game, int row);
+extern int GameCheck(tGame *game);
+
+#endif
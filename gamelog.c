@@ -0,0 +1,254 @@
+#include <string.h>
+#include "inc/hw_types.h"
+#include "driverlib/flash.h"
+#include "globals.h"
+#include "game.h"
+#include "gamelog.h"
+
+// Per-piece records are collected column by column in RAM and written to
+// flash one packed block at a time, so a block costs one flash program of
+// about a kilobyte every GAMELOG_BLOCK_RECORDS pieces.
+
+#define GAMELOG_PAGE 0x400 // Flash erase size
+#define GAMELOG_COLUMNS 7
+#define GAMELOG_HEADER 12
+#define GAMELOG_FOOTER_MAX (8 + 8 * GAMELOG_INDEX_ENTRIES)
+
+// Bytes per record in each column, in file order
+static const unsigned char columnWidth[GAMELOG_COLUMNS] = { 1, 1, 1, 1, 1, 2, 1 };
+
+// Record bytes and the worst case block, every column packed as literals
+#define GAMELOG_RECORD_BYTES 8
+#define GAMELOG_BLOCK_BYTES (GAMELOG_HEADER + GAMELOG_COLUMNS * 4 + GAMELOG_RECORD_BYTES * GAMELOG_BLOCK_RECORDS)
+
+tGameLogStats gameLogStats;
+
+static unsigned char columns[GAMELOG_RECORD_BYTES * GAMELOG_BLOCK_RECORDS];
+static unsigned long block[(GAMELOG_BLOCK_BYTES + 3) / 4]; // Word aligned for FlashProgram
+static unsigned long footer[(GAMELOG_FOOTER_MAX + 3) / 4];
+
+static int records = 0;        // Records waiting in columns
+static int entries = 0;        // Blocks waiting for a footer
+static unsigned long pieces = 0;
+static unsigned long position = 0; // Next free byte of the region
+static int full = 0;
+
+static void Write16(unsigned char *buf, unsigned long value)
+{
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+}
+
+static void Write32(unsigned char *buf, unsigned long value)
+{
+    Write16(buf, value);
+    Write16(buf + 2, value >> 16);
+}
+
+static unsigned long Read16(const unsigned char *buf)
+{
+    return buf[0] | (buf[1] << 8);
+}
+
+static unsigned long Read32(const unsigned char *buf)
+{
+    return Read16(buf) | (Read16(buf + 2) << 16);
+}
+
+// PackBits, runs of three or more become a repeat. Returns the packed length.
+static int Pack(const unsigned char *in, int count, unsigned char *out)
+{
+    int length = 0;
+    int i = 0;
+
+    while(i < count)
+    {
+        int run = 1;
+        while(i + run < count && run < 128 && in[i + run] == in[i])
+        {
+            run++;
+        }
+
+        if(run >= 3)
+        {
+            out[length++] = 257 - run;
+            out[length++] = in[i];
+            i += run;
+            continue;
+        }
+
+        // Literals up to the next run of three
+        int literal = 1;
+        while(i + literal < count && literal < 128 &&
+              !(i + literal + 2 < count && in[i + literal] == in[i + literal + 1] && in[i + literal] == in[i + literal + 2]))
+        {
+            literal++;
+        }
+
+        out[length++] = literal - 1;
+        memcpy(&out[length], &in[i], literal);
+        length += literal;
+        i += literal;
+    }
+
+    return length;
+}
+
+static void Program(unsigned long *data, int bytes)
+{
+    FlashProgram(data, GAMELOG_BASE + position, bytes);
+    position += bytes;
+    gameLogStats.used = position;
+}
+
+static void WriteIndex(void)
+{
+    if(!entries)
+    {
+        return;
+    }
+
+    unsigned char *out = (unsigned char *)footer;
+    int bytes = 8 + 8 * entries;
+    Write32(out, GAMELOG_INDEX_MAGIC);
+    Write16(out + 4, bytes);
+    Write16(out + 6, entries);
+
+    // Space for the footer is kept free when each block is written
+    Program(footer, bytes);
+    entries = 0;
+}
+
+static void WriteBlock(void)
+{
+    unsigned char *out = (unsigned char *)block;
+    int length = GAMELOG_HEADER;
+    int start = 0;
+
+    int c;
+    for(c = 0; c < GAMELOG_COLUMNS; c++)
+    {
+        int packed = Pack(&columns[start * GAMELOG_BLOCK_RECORDS], columnWidth[c] * records, &out[length + 2]);
+        Write16(&out[length], packed);
+        length += 2 + packed;
+        start += columnWidth[c];
+    }
+
+    while(length & 3)
+    {
+        out[length++] = 0;
+    }
+
+    if(position + length + GAMELOG_FOOTER_MAX > GAMELOG_SIZE)
+    {
+        full = 1;
+        gameLogStats.dropped += records;
+        records = 0;
+        return;
+    }
+
+    unsigned long first = pieces - records;
+    Write32(out, GAMELOG_BLOCK_MAGIC);
+    Write16(out + 4, length);
+    Write16(out + 6, records);
+    Write32(out + 8, first);
+
+    unsigned char *entry = (unsigned char *)footer + 8 + 8 * entries;
+    Write32(entry, position);
+    Write32(entry + 4, first);
+    entries++;
+
+    Program(block, length);
+    gameLogStats.records += records;
+    gameLogStats.blocks++;
+    records = 0;
+
+    if(entries == GAMELOG_INDEX_ENTRIES)
+    {
+        WriteIndex();
+    }
+}
+
+// Finds the end of the log left by earlier games
+void GameLogInit(void)
+{
+    FlashUsecSet(g_ulSystemClock / 1000000);
+
+    unsigned long offset = 0;
+    while(offset + 8 <= GAMELOG_SIZE)
+    {
+        const unsigned char *header = (const unsigned char *)(GAMELOG_BASE + offset);
+        unsigned long magic = Read32(header);
+        unsigned long bytes = Read16(header + 4);
+
+        if(magic == 0xFFFFFFFF)
+        {
+            break; // Erased
+        }
+
+        if((magic != GAMELOG_BLOCK_MAGIC && magic != GAMELOG_INDEX_MAGIC) || bytes < 8 || (bytes & 3))
+        {
+            offset = GAMELOG_SIZE; // Not a log, leave it alone until erased
+            break;
+        }
+
+        offset += bytes;
+    }
+
+    position = offset < GAMELOG_SIZE ? offset : GAMELOG_SIZE;
+    full = position + GAMELOG_HEADER + GAMELOG_FOOTER_MAX > GAMELOG_SIZE;
+    gameLogStats.used = position;
+}
+
+void GameLogErase(void)
+{
+    unsigned long offset;
+    for(offset = 0; offset < GAMELOG_SIZE; offset += GAMELOG_PAGE)
+    {
+        FlashErase(GAMELOG_BASE + offset);
+    }
+
+    records = 0;
+    entries = 0;
+    position = 0;
+    full = 0;
+    gameLogStats.used = 0;
+}
+
+void GameLogAppend(const tGameLock *lock)
+{
+    if(full)
+    {
+        gameLogStats.dropped++;
+        return;
+    }
+
+    columns[0 * GAMELOG_BLOCK_RECORDS + records] = lock->shape;
+    columns[1 * GAMELOG_BLOCK_RECORDS + records] = lock->x;
+    columns[2 * GAMELOG_BLOCK_RECORDS + records] = lock->y;
+    columns[3 * GAMELOG_BLOCK_RECORDS + records] = lock->orientation;
+    columns[4 * GAMELOG_BLOCK_RECORDS + records] = lock->lines;
+    Write16(&columns[5 * GAMELOG_BLOCK_RECORDS + 2 * records], lock->score);
+    columns[7 * GAMELOG_BLOCK_RECORDS + records] = lock->height;
+
+    records++;
+    pieces++;
+    if(records == GAMELOG_BLOCK_RECORDS)
+    {
+        WriteBlock();
+    }
+}
+
+// Writes the partial block and the footer, called when a game ends. The
+// next game's pieces count from 0, which is how a reader tells the games
+// apart.
+void GameLogFlush(void)
+{
+    if(records)
+    {
+        WriteBlock();
+    }
+
+    WriteIndex();
+    pieces = 0;
+}
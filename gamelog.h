@@ -0,0 +1,54 @@
+#ifndef __GAMELOG_H__
+#define __GAMELOG_H__
+
+#include "game.h"
+
+// Flash region holding the log, reserved as LOG in timers_ccs.cmd
+#define GAMELOG_BASE 0x00030000
+#define GAMELOG_SIZE 0x00010000
+
+// Pieces per block, and blocks indexed by one footer
+#define GAMELOG_BLOCK_RECORDS 128
+#define GAMELOG_INDEX_ENTRIES 32
+
+// The log is a sequence of blocks and index footers appended to erased
+// flash, all fields little-endian and every block and footer padded to a
+// word. A footer ends each game, or follows every GAMELOG_INDEX_ENTRIES
+// blocks.
+//
+// Block:
+//   u32 GAMELOG_BLOCK_MAGIC
+//   u16 bytes, including this header and the padding
+//   u16 records
+//   u32 piece number of the first record, counted from the start of the game
+//   then for each column in order: u16 packed length, packed bytes
+//
+// Columns, one fixed-width value per record:
+//   u8 shape, i8 x, i8 y, u8 orientation, u8 lines, u16 score, u8 height
+//
+// Packed bytes use PackBits: a control byte n below 128 is followed by n + 1
+// literal bytes, n above 128 by one byte repeated 257 - n times.
+//
+// Footer:
+//   u32 GAMELOG_INDEX_MAGIC
+//   u16 bytes, u16 entries
+//   per entry: u32 block offset from GAMELOG_BASE, u32 first piece number
+#define GAMELOG_BLOCK_MAGIC 0x424C4754 // "TGLB"
+#define GAMELOG_INDEX_MAGIC 0x494C4754 // "TGLI"
+
+typedef struct
+{
+    unsigned long records; // Pieces written to flash
+    unsigned long blocks;
+    unsigned long used;    // Bytes of the region in use
+    unsigned long dropped; // Pieces lost because the region is full
+} tGameLogStats;
+
+extern tGameLogStats gameLogStats;
+
+extern void GameLogInit(void);
+extern void GameLogErase(void);
+extern void GameLogAppend(const tGameLock *lock);
+extern void GameLogFlush(void);
+
+#endif
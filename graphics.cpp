@@ -24,6 +24,14 @@ const unsigned char block[] =
     0xFF, 0xFF
 };
 
+const unsigned char ghost[] =
+{
+    0x33, 0x33, // Outline only, marks where the piece will land
+    0x30, 0x03,
+    0x30, 0x03,
+    0x33, 0x33
+};
+
 const unsigned char clear[] =
 {
     0x00, 0x00,
@@ -32,12 +40,24 @@ const unsigned char clear[] =
     0x00, 0x00
 };
 
-// Shape definitions
-const int SD_O[4] = { 1, 1, 1, 1 };
-const int SD_I[16] = { 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0 };
-const int SD_S[9] = { 0, 1, 1, 1, 1, 0, 0, 0, 0 };
-const int SD_Z[9] = { 1, 1, 0, 0, 1, 1, 0, 0, 0 };
-const int SD_L[9] = { 1, 0, 0, 1, 0, 0, 1, 1, 0 };
-const int SD_J[9] = { 0, 1, 0, 0, 1, 0, 1, 1, 0 };
-const int SD_T[9] = { 1, 1, 1, 0, 1, 0, 0, 0, 0 };
-const int SD_C[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }; // Used to clear a shape
+// Cell with one grey level round the edge and another in the centre
+#define CELL_SHADE(edge, centre) \
+{ \
+    (edge) << 4 | (edge), (edge) << 4 | (edge), \
+    (edge) << 4 | (centre), (centre) << 4 | (edge), \
+    (edge) << 4 | (centre), (centre) << 4 | (edge), \
+    (edge) << 4 | (edge), (edge) << 4 | (edge) \
+}
+
+// Edge and centre pairs picked to stay apart on the panel's grey levels
+const unsigned char shades[SHADES][CELL_SIZE * CELL_SIZE / 2] =
+{
+    CELL_SHADE(15, 15), // O, solid
+    CELL_SHADE(15, 0),  // I, hollow
+    CELL_SHADE(9, 9),   // S
+    CELL_SHADE(9, 0),   // Z
+    CELL_SHADE(15, 9),  // L
+    CELL_SHADE(9, 15),  // J
+    CELL_SHADE(15, 5),  // T, as block
+    CELL_SHADE(4, 4)    // Garbage
+};
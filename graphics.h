@@ -1,17 +1,17 @@
 #ifndef GRAPHICS_H_
 #define GRAPHICS_H_
 
+// Size in pixels of one board cell, block, ghost and clear are CELL_SIZE square
+#define CELL_SIZE 4
+
 extern const unsigned char wall[];
 extern const unsigned char block[];
+extern const unsigned char ghost[];
 extern const unsigned char clear[];
 
-extern const int SD_O[4];
-extern const int SD_I[16];
-extern const int SD_S[9];
-extern const int SD_Z[9];
-extern const int SD_L[9];
-extern const int SD_J[9];
-extern const int SD_T[9];
-extern const int SD_C[16];
+// One bitmap per filled cell value, shades[value - 1]: a shade for each
+// shape in shape order, then garbage
+#define SHADES 8
+extern const unsigned char shades[SHADES][CELL_SIZE * CELL_SIZE / 2];
 
 #endif
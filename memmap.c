@@ -0,0 +1,104 @@
+#include "inc/hw_types.h"
+#include "driverlib/mpu.h"
+#include "console.h"
+#include "memmap.h"
+
+// The stack is painted with a known word at boot. Words still holding it
+// were never used, so the lowest overwritten word is the high watermark,
+// covering interrupts as well since they share the one stack. An MPU region
+// at the bottom of the stack turns an overflow into a fault rather than
+// silent damage to whatever the linker placed below it.
+
+// Bottom of the system stack, and the initial SP the vector table loads.
+// __STACK_END follows --stack_size instead; timers_ccs.cmd sets both to
+// the same 1024 bytes, sized there from the measured depths.
+extern unsigned long __stack;
+extern unsigned long __STACK_TOP;
+
+#define MEM_PAINT 0xA5A5A5A5
+#define MEM_GUARD_SIZE 32 // Smallest MPU region, must be size aligned
+
+tMemStats memStats;
+
+// Called first thing in main, while only main's frame is on the stack
+void MemInit(void)
+{
+    unsigned long here;
+
+    // The guard takes the lowest aligned 32 bytes of the stack itself, so
+    // nothing outside the stack loses access
+    unsigned long guard = ((unsigned long)&__stack + MEM_GUARD_SIZE - 1) & ~(MEM_GUARD_SIZE - 1);
+    MPURegionSet(0, guard, MPU_RGN_SIZE_32B | MPU_RGN_PERM_NOEXEC | MPU_RGN_PERM_PRV_NO_USR_NO | MPU_RGN_ENABLE);
+    MPUEnable(MPU_CONFIG_PRIV_DEFAULT);
+
+    memStats.guard = guard;
+    memStats.stackBase = guard + MEM_GUARD_SIZE;
+    memStats.stackTop = (unsigned long)&__STACK_TOP;
+    memStats.stackSize = memStats.stackTop - memStats.stackBase;
+
+    // Paint up to a little below this frame, leaving room for the call
+    unsigned long *word;
+    for(word = (unsigned long *)memStats.stackBase; word < &here - 8; word++)
+    {
+        *word = MEM_PAINT;
+    }
+
+    MemSample();
+}
+
+// Bytes from the top of the stack down to the lowest overwritten word
+unsigned long MemDepth(void)
+{
+    unsigned long *word = (unsigned long *)memStats.stackBase;
+    while(word < (unsigned long *)memStats.stackTop && *word == MEM_PAINT)
+    {
+        word++;
+    }
+    return memStats.stackTop - (unsigned long)word;
+}
+
+// Updates the high watermark, cheap enough to run every second
+void MemSample(void)
+{
+    unsigned long depth = MemDepth();
+    if(depth > memStats.stackPeak)
+    {
+        memStats.stackPeak = depth; // Kept across MemRepaint
+    }
+    memStats.stackFree = memStats.stackSize - memStats.stackPeak;
+    memStats.samples++;
+}
+
+// Paints the stack below the caller again, so MemDepth measures the calls
+// that follow on their own. The watermark so far is taken first.
+void MemRepaint(void)
+{
+    unsigned long here;
+    MemSample();
+
+    unsigned long *word;
+    for(word = (unsigned long *)memStats.stackBase; word < &here - 8; word++)
+    {
+        *word = MEM_PAINT;
+    }
+}
+
+// Prints memStats on the console, one line
+void MemReport(void)
+{
+    ConsolePrint("stack guard ");
+    ConsoleHex(memStats.guard);
+    ConsolePrint(" base ");
+    ConsoleHex(memStats.stackBase);
+    ConsolePrint(" top ");
+    ConsoleHex(memStats.stackTop);
+    ConsolePrint(" size ");
+    ConsoleNumber(memStats.stackSize);
+    ConsolePrint(" peak ");
+    ConsoleNumber(memStats.stackPeak);
+    ConsolePrint(" free ");
+    ConsoleNumber(memStats.stackFree);
+    ConsolePrint(" samples ");
+    ConsoleNumber(memStats.samples);
+    ConsolePrint("\r\n");
+}
@@ -0,0 +1,24 @@
+#ifndef __MEMMAP_H__
+#define __MEMMAP_H__
+
+// Stack layout and use, sampled at run time. Addresses are byte addresses.
+typedef struct
+{
+    unsigned long guard;      // MPU no-access region at the bottom of the stack
+    unsigned long stackBase;  // Lowest usable stack address, above the guard
+    unsigned long stackTop;   // One past the highest stack address, the initial SP
+    unsigned long stackSize;  // Usable bytes
+    unsigned long stackPeak;  // Most bytes ever in use
+    unsigned long stackFree;  // Bytes never touched
+    unsigned long samples;
+} tMemStats;
+
+extern tMemStats memStats;
+
+extern void MemInit(void);
+extern void MemSample(void);
+extern unsigned long MemDepth(void);
+extern void MemRepaint(void);
+extern void MemReport(void);
+
+#endif
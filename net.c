@@ -0,0 +1,346 @@
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/ethernet.h"
+#include "driverlib/flash.h"
+#include "driverlib/sysctl.h"
+#include <string.h>
+#include "game.h"
+#include "net.h"
+
+// Versus games run over raw Ethernet frames. Both boards simulate both
+// players; each tick the local input is sent to the opponent and the remote
+// input is predicted until it arrives. A wrong prediction restores the
+// snapshot taken before that tick and simulates forward again.
+
+#define NET_ETHERTYPE 0x88B5 // IEEE 802 local experimental
+#define NET_VERSION 1
+#define NET_HISTORY 16       // Power of two, more than 2 * NET_ROLLBACK_TICKS
+#define NET_REDUNDANCY 8     // Past inputs repeated in every packet
+#define NET_MAX_RX 8         // Packets handled per tick
+#define NET_NO_HASH 0xFFFFFFFFUL
+#define NET_HASH_BASIS 2166136261UL
+
+// Packet layout after the 14 byte Ethernet header:
+//  14    version
+//  15    number of inputs carried
+//  16-19 tick following the last input carried
+//  20-23 tick of the hash, NET_NO_HASH if none
+//  24-27 state hash after that tick
+//  28-   inputs, oldest first
+#define NET_INPUTS 28
+#define NET_PACKET_SIZE (NET_INPUTS + NET_REDUNDANCY)
+
+tNetStats netStats;
+
+static const unsigned char broadcast[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+static unsigned char mac[6];
+static unsigned char peer[6];
+
+static int state = NET_OFF;
+static int local; // Index of the local player in games
+static tGame games[2];
+
+static unsigned long frame;     // Next tick to simulate
+static unsigned long confirmed; // Ticks with a known remote input
+static unsigned long rewindTick; // Earliest mispredicted tick, frame if none
+static unsigned long hashTick = NET_NO_HASH;
+static unsigned long hashValue;
+
+static unsigned char inputs[2][NET_HISTORY];
+static unsigned char snapshots[NET_HISTORY][2][GAME_SNAPSHOT_SIZE];
+static unsigned long hashes[NET_HISTORY];
+static unsigned char packet[64];
+
+static void Write32(unsigned char *buf, unsigned long value)
+{
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+    buf[2] = (value >> 16) & 0xFF;
+    buf[3] = (value >> 24) & 0xFF;
+}
+
+static unsigned long Read32(const unsigned char *buf)
+{
+    return buf[0] | (buf[1] << 8) | ((unsigned long)buf[2] << 16) | ((unsigned long)buf[3] << 24);
+}
+
+static int Simulate(unsigned long t)
+{
+    int i = t & (NET_HISTORY - 1);
+
+    GameSave(&games[0], snapshots[i][0]);
+    GameSave(&games[1], snapshots[i][1]);
+
+    int changed = GameStep(&games[local], inputs[local][i]);
+    GameStep(&games[!local], inputs[!local][i]);
+
+    // Exchange garbage
+    games[0].garbageIn += games[1].garbageOut;
+    games[1].garbageIn += games[0].garbageOut;
+    games[0].garbageOut = 0;
+    games[1].garbageOut = 0;
+
+    hashes[i] = GameHash(&games[1], GameHash(&games[0], NET_HASH_BASIS));
+
+    return changed;
+}
+
+static void Rollback(unsigned long from)
+{
+    int i = from & (NET_HISTORY - 1);
+
+    GameRestore(&games[0], snapshots[i][0]);
+    GameRestore(&games[1], snapshots[i][1]);
+
+    unsigned long t;
+    for(t = from; t < frame; t++)
+    {
+        Simulate(t);
+    }
+
+    netStats.rollbacks++;
+    netStats.resimulated += frame - from;
+    if(frame - from > netStats.maxRollback)
+    {
+        netStats.maxRollback = frame - from;
+    }
+}
+
+static void Start(const unsigned char *from)
+{
+    memcpy(peer, from, 6);
+    local = memcmp(mac, peer, 6) < 0 ? 0 : 1;
+
+    // Both sides derive the same seed from the pair of addresses
+    unsigned long seed = 0;
+    int i;
+    for(i = 0; i < 6; i++)
+    {
+        seed = seed * 31 + (mac[i] ^ peer[i]);
+    }
+
+    GameInit(&games[0], seed);
+    GameInit(&games[1], seed);
+
+    memset(inputs, 0, sizeof(inputs));
+    frame = 0;
+    confirmed = 0;
+    rewindTick = 0;
+    state = NET_RUNNING;
+}
+
+static void Receive(const unsigned char *buf, long len)
+{
+    if(len < NET_INPUTS || buf[12] != (NET_ETHERTYPE >> 8) ||
+       buf[13] != (NET_ETHERTYPE & 0xFF) || buf[14] != NET_VERSION)
+    {
+        return;
+    }
+
+    if(state == NET_WAITING)
+    {
+        Start(&buf[6]);
+    }
+    else if(memcmp(&buf[6], peer, 6))
+    {
+        return; // Not our opponent
+    }
+
+    int count = buf[15];
+    if(count > NET_REDUNDANCY || len < NET_INPUTS + count)
+    {
+        return;
+    }
+
+    netStats.rxPackets++;
+
+    // Take any inputs that follow on from the ones already confirmed
+    int remote = !local;
+    unsigned long end = Read32(&buf[16]);
+    int k;
+    for(k = 0; k < count; k++)
+    {
+        unsigned long t = end - count + k;
+        if(t != confirmed || t >= frame + NET_ROLLBACK_TICKS)
+        {
+            continue;
+        }
+
+        int i = t & (NET_HISTORY - 1);
+        if(t < frame && inputs[remote][i] != buf[NET_INPUTS + k] && t < rewindTick)
+        {
+            rewindTick = t;
+        }
+        inputs[remote][i] = buf[NET_INPUTS + k];
+        confirmed++;
+    }
+
+    // Predict the rest with the newest confirmed input
+    if(confirmed)
+    {
+        unsigned char last = inputs[remote][(confirmed - 1) & (NET_HISTORY - 1)];
+        unsigned long t;
+        for(t = confirmed; t < frame; t++)
+        {
+            int i = t & (NET_HISTORY - 1);
+            if(inputs[remote][i] != last)
+            {
+                inputs[remote][i] = last;
+                if(t < rewindTick)
+                {
+                    rewindTick = t;
+                }
+            }
+        }
+    }
+
+    hashTick = Read32(&buf[20]);
+    hashValue = Read32(&buf[24]);
+}
+
+static void CheckHash(void)
+{
+    // Only ticks with both inputs known locally, still in the history
+    if(hashTick != NET_NO_HASH && hashTick < confirmed && hashTick < frame &&
+       frame - hashTick <= NET_HISTORY)
+    {
+        if(hashes[hashTick & (NET_HISTORY - 1)] != hashValue)
+        {
+            netStats.desyncs++;
+        }
+    }
+
+    hashTick = NET_NO_HASH;
+}
+
+static void Send(void)
+{
+    memcpy(&packet[0], state == NET_RUNNING ? peer : broadcast, 6);
+    memcpy(&packet[6], mac, 6);
+    packet[12] = NET_ETHERTYPE >> 8;
+    packet[13] = NET_ETHERTYPE & 0xFF;
+    packet[14] = NET_VERSION;
+
+    int count = frame < NET_REDUNDANCY ? frame : NET_REDUNDANCY;
+    packet[15] = count;
+    Write32(&packet[16], frame);
+
+    unsigned long final = confirmed < frame ? confirmed : frame;
+    Write32(&packet[20], final ? final - 1 : NET_NO_HASH);
+    Write32(&packet[24], final ? hashes[(final - 1) & (NET_HISTORY - 1)] : 0);
+
+    int k;
+    for(k = 0; k < count; k++)
+    {
+        packet[NET_INPUTS + k] = inputs[local][(frame - count + k) & (NET_HISTORY - 1)];
+    }
+
+    if(EthernetPacketPutNonBlocking(ETH_BASE, packet, NET_PACKET_SIZE) > 0)
+    {
+        netStats.txPackets++;
+    }
+}
+
+// Brings up the Ethernet controller and returns the board's MAC address.
+// Shared with the self-play sample stream.
+void NetOpen(unsigned char *address)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_ETH);
+    SysCtlPeripheralReset(SYSCTL_PERIPH_ETH);
+
+    EthernetInitExpClk(ETH_BASE, SysCtlClockGet());
+    EthernetConfigSet(ETH_BASE, ETH_CFG_TX_DPLXEN | ETH_CFG_TX_CRCEN | ETH_CFG_TX_PADEN);
+
+    // The MAC address is programmed into the user registers at the factory
+    unsigned long user0, user1;
+    FlashUserGet(&user0, &user1);
+    address[0] = user0 & 0xFF;
+    address[1] = (user0 >> 8) & 0xFF;
+    address[2] = (user0 >> 16) & 0xFF;
+    address[3] = user1 & 0xFF;
+    address[4] = (user1 >> 8) & 0xFF;
+    address[5] = (user1 >> 16) & 0xFF;
+    EthernetMACAddrSet(ETH_BASE, address);
+
+    EthernetEnable(ETH_BASE);
+}
+
+void NetInit(void)
+{
+    NetOpen(mac);
+    state = NET_WAITING;
+}
+
+// Runs one timer tick of the versus session with the local input mask.
+// Returns 1 if the local board needs redrawing.
+int NetStep(int input)
+{
+    if(state == NET_OFF)
+    {
+        return 0;
+    }
+
+    rewindTick = frame;
+
+    int n;
+    for(n = 0; n < NET_MAX_RX; n++)
+    {
+        long len = EthernetPacketGetNonBlocking(ETH_BASE, packet, sizeof(packet));
+        if(len == 0)
+        {
+            break;
+        }
+        if(len > 0)
+        {
+            Receive(packet, len);
+        }
+    }
+
+    int changed = 0;
+    if(state == NET_RUNNING)
+    {
+        if(rewindTick < frame)
+        {
+            Rollback(rewindTick);
+            changed = 1;
+        }
+
+        CheckHash();
+
+        if(frame >= confirmed && frame - confirmed >= NET_ROLLBACK_TICKS)
+        {
+            netStats.stalls++;
+        }
+        else
+        {
+            int i = frame & (NET_HISTORY - 1);
+            inputs[local][i] = input;
+            if(frame >= confirmed)
+            {
+                inputs[!local][i] = confirmed ? inputs[!local][(confirmed - 1) & (NET_HISTORY - 1)] : 0;
+            }
+
+            changed |= Simulate(frame);
+            frame++;
+        }
+    }
+
+    Send();
+
+    return changed;
+}
+
+int NetState(void)
+{
+    return state;
+}
+
+tGame *NetLocalGame(void)
+{
+    return &games[local];
+}
+
+tGame *NetRemoteGame(void)
+{
+    return &games[!local];
+}
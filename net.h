@@ -0,0 +1,35 @@
+#ifndef __NET_H__
+#define __NET_H__
+
+#include "game.h"
+
+// Ticks the local game may run ahead of the last confirmed remote input. A
+// late input costs at most this many re-simulated ticks.
+#define NET_ROLLBACK_TICKS 8
+
+// Session states
+#define NET_OFF     0
+#define NET_WAITING 1 // Looking for an opponent
+#define NET_RUNNING 2
+
+typedef struct
+{
+    unsigned long rollbacks;   // Mispredicted remote inputs corrected
+    unsigned long resimulated; // Ticks simulated again after a rollback
+    unsigned long maxRollback; // Deepest rollback seen
+    unsigned long stalls;      // Ticks spent waiting on the remote player
+    unsigned long desyncs;     // State hash mismatches with the opponent
+    unsigned long rxPackets;
+    unsigned long txPackets;
+} tNetStats;
+
+extern tNetStats netStats;
+
+extern void NetOpen(unsigned char *address);
+extern void NetInit(void);
+extern int NetStep(int input);
+extern int NetState(void);
+extern tGame *NetLocalGame(void);
+extern tGame *NetRemoteGame(void);
+
+#endif
@@ -0,0 +1,447 @@
+#include <string.h>
+#include "game.h"
+#include "pc.h"
+
+// Depth-first search over the window as one 64-bit word, bit
+// (row * GAME_COLS + column) with row 0 the top of the window. Lock
+// positions for each piece come from a breadth-first search over poses with
+// the same moves as PlaceFind: left, right, down and rotate in place. The
+// board above the window is empty, so every pose above it is reachable.
+//
+// A board is dropped without expanding it when:
+//  - the pieces left cannot fill the empty cells of the lines still to clear
+//  - filled cells wall off an area of empty cells that is not a multiple of
+//    four
+//  - the empty cells cannot be covered given how many more fall in even
+//    columns than odd. Only I, L, J and T pieces can cover uneven numbers,
+//    and line clears leave the columns where they are.
+//  - the same board was already searched at the same queue position
+
+typedef unsigned long long tBits;
+
+#define FULL_ROW ((1ULL << GAME_COLS) - 1)
+#define WINDOW_CELLS (PC_ROWS * GAME_COLS)
+
+tPcStats pcStats;
+unsigned long pcNodeLimit = 0;
+
+// The search PcSolve and PcSolvePart run in
+static tPcSearch pcSearch;
+
+static int BitCount32(unsigned long bits)
+{
+    bits = bits - ((bits >> 1) & 0x55555555UL);
+    bits = (bits & 0x33333333UL) + ((bits >> 2) & 0x33333333UL);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0FUL;
+    return ((bits * 0x01010101UL) & 0xFFFFFFFFUL) >> 24;
+}
+
+static int BitCount(tBits bits)
+{
+    return BitCount32((unsigned long)bits) + BitCount32((unsigned long)(bits >> 32));
+}
+
+static int Pose(int orientation, int x, int y)
+{
+    return (orientation * PC_POSE_Y_SPAN + y + 4) * PC_POSE_X_SPAN + x + 3;
+}
+
+// Fills the search's table of the piece being placed in each orientation
+// and column
+static void ShapeTable(tPcSearch *search, int shape)
+{
+    int orientation, x, i;
+    for(orientation = 0; orientation < 4; orientation++)
+    {
+        int mask = shapeMasks[shape][orientation];
+        for(i = 0; i < 4; i++)
+        {
+            if((mask >> (4 * i)) & 0xF)
+            {
+                search->shapeBottom[orientation] = i;
+            }
+        }
+
+        for(x = -3; x < GAME_COLS; x++)
+        {
+            tBits bits = 0;
+            for(i = 0; i < 4; i++)
+            {
+                int row = (mask >> (4 * i)) & 0xF;
+                int cells = x >= 0 ? row << x : row >> -x;
+                if((x < 0 && (row & ((1 << -x) - 1))) || (cells & ~FULL_ROW))
+                {
+                    bits = 0;
+                    break;
+                }
+                bits |= (tBits)cells << (i * GAME_COLS);
+            }
+            search->shapeBits[orientation][x + 3] = bits;
+        }
+    }
+}
+
+// Cells the piece from ShapeTable covers in the window, 0 if it is off the
+// board or overlaps a filled cell, ~0 if it fits wholly above the window
+static tBits PieceBits(const tPcSearch *search, tBits board, int pose)
+{
+    int x = pose % PC_POSE_X_SPAN;
+    int y = (pose / PC_POSE_X_SPAN) % PC_POSE_Y_SPAN - 4;
+    int orientation = pose / (PC_POSE_X_SPAN * PC_POSE_Y_SPAN);
+
+    tBits bits = search->shapeBits[orientation][x];
+    if(!bits || y + search->shapeBottom[orientation] >= PC_ROWS)
+    {
+        return 0;
+    }
+
+    bits = y >= 0 ? bits << (y * GAME_COLS) : bits >> (-y * GAME_COLS);
+    if(bits & board)
+    {
+        return 0;
+    }
+    return bits ? bits : ~0ULL;
+}
+
+// Cells a lock position from Generate covers in the window
+static tBits LockBits(int shape, int pose)
+{
+    int x = pose % PC_POSE_X_SPAN - 3;
+    int y = (pose / PC_POSE_X_SPAN) % PC_POSE_Y_SPAN - 4;
+    int mask = shapeMasks[shape][pose / (PC_POSE_X_SPAN * PC_POSE_Y_SPAN)];
+
+    tBits bits = 0;
+    int i;
+    for(i = 0; i < 4; i++)
+    {
+        int row = (mask >> (4 * i)) & 0xF;
+        if(row && y + i >= 0)
+        {
+            bits |= (tBits)(x >= 0 ? row << x : row >> -x) << ((y + i) * GAME_COLS);
+        }
+    }
+    return bits;
+}
+
+static void Visit(tPcSearch *search, tBits board, int pose, int *tail)
+{
+    if(search->visited[pose >> 5] & (1UL << (pose & 31)))
+    {
+        return;
+    }
+    search->visited[pose >> 5] |= 1UL << (pose & 31);
+
+    if(PieceBits(search, board, pose))
+    {
+        search->poseQueue[(*tail)++] = pose;
+    }
+}
+
+// Fills the search's moves[level] with the distinct lock positions inside
+// the lines still to clear
+static void Generate(tPcSearch *search, int level, int shape)
+{
+    tBits board = search->boards[level];
+    tBits allowed = ~0ULL << ((PC_ROWS - search->lines[level]) * GAME_COLS);
+    allowed &= (1ULL << WINDOW_CELLS) - 1;
+
+    ShapeTable(search, shape);
+    memset(search->visited, 0, sizeof(search->visited));
+    int head = 0;
+    int tail = 0;
+    int count = 0;
+
+    // Every pose wholly above the window is free to reach
+    int orientation, x;
+    for(orientation = 0; orientation < 4; orientation++)
+    {
+        for(x = -3; x < GAME_COLS; x++)
+        {
+            Visit(search, board, Pose(orientation, x, -4), &tail);
+        }
+    }
+
+    while(head < tail)
+    {
+        int pose = search->poseQueue[head++];
+        int y = (pose / PC_POSE_X_SPAN) % PC_POSE_Y_SPAN - 4;
+        int x = pose % PC_POSE_X_SPAN - 3;
+        int o = pose / (PC_POSE_X_SPAN * PC_POSE_Y_SPAN);
+
+        if(x > -3)
+        {
+            Visit(search, board, pose - 1, &tail);
+        }
+        if(x < GAME_COLS - 1)
+        {
+            Visit(search, board, pose + 1, &tail);
+        }
+        Visit(search, board, Pose((o + 1) & 3, x, y), &tail);
+
+        if(y < PC_ROWS - 1 && PieceBits(search, board, pose + PC_POSE_X_SPAN))
+        {
+            Visit(search, board, pose + PC_POSE_X_SPAN, &tail);
+            continue;
+        }
+
+        // Resting here. Keep it if it lies within the lines to clear and
+        // no other pose covers the same cells.
+        tBits bits = PieceBits(search, board, pose);
+        if(bits == ~0ULL || (bits & ~allowed))
+        {
+            continue;
+        }
+
+        int i;
+        for(i = 0; i < count && search->lockMasks[i] != bits; i++)
+        {
+        }
+        if(i < count)
+        {
+            continue;
+        }
+        if(count == PC_MAX_MOVES)
+        {
+            search->stats->truncated++;
+            continue;
+        }
+
+        search->lockMasks[count] = bits;
+        search->moves[level][count++] = pose;
+    }
+
+    search->moveCount[level] = count;
+    search->moveNext[level] = 0;
+}
+
+// Removes full rows, the rows above drop into their place. Returns the
+// number removed.
+static int ClearRows(tBits *board)
+{
+    int cleared = 0;
+    int row;
+    for(row = 0; row < PC_ROWS; row++)
+    {
+        int shift = row * GAME_COLS;
+        if(((*board >> shift) & FULL_ROW) == FULL_ROW)
+        {
+            tBits above = *board & ((1ULL << shift) - 1);
+            tBits below = *board & ~((1ULL << (shift + GAME_COLS)) - 1);
+            *board = (above << GAME_COLS) | below;
+            cleared++;
+        }
+    }
+    return cleared;
+}
+
+// Returns 1 if the board cannot be cleared with the pieces from next on
+static int Hopeless(const tPcSearch *search, tBits board, int clear, const unsigned char *queue, int next, int count)
+{
+    tBits empty = ~board & (~0ULL << ((PC_ROWS - clear) * GAME_COLS)) & ((1ULL << WINDOW_CELLS) - 1);
+    int cells = BitCount(empty);
+    int needed = cells / 4;
+    if(cells % 4 || needed > count - next)
+    {
+        return 1;
+    }
+
+    // Pieces cannot cross filled cells, so every enclosed area of empty
+    // cells must be filled on its own
+    tBits rest = empty;
+    while(rest)
+    {
+        tBits area = rest & (~rest + 1);
+        tBits grown;
+        do
+        {
+            grown = area;
+            area |= ((area << 1) & ~search->firstColumn) | ((area >> 1) & ~search->lastColumn) |
+                    (area << GAME_COLS) | (area >> GAME_COLS);
+            area &= empty;
+        } while(area != grown);
+
+        if(BitCount(area) % 4)
+        {
+            return 1;
+        }
+        rest &= ~area;
+    }
+
+    int imbalance = BitCount(empty & search->evenColumns) - BitCount(empty & ~search->evenColumns);
+    if(imbalance < 0)
+    {
+        imbalance = -imbalance;
+    }
+
+    int reach = 0;
+    int fixed = 0; // L and J always cover three columns of one parity
+    int anyT = 0;  // T can cover either way
+    int i;
+    for(i = next; i < next + needed; i++)
+    {
+        switch(queue[i])
+        {
+        case S_I: reach += 4; break;
+        case S_L: case S_J: reach += 2; fixed++; break;
+        case S_T: reach += 2; anyT = 1; break;
+        }
+    }
+
+    return imbalance > reach || (!anyT && (imbalance - 2 * fixed) % 4);
+}
+
+static unsigned long MemoSlot(tBits key)
+{
+    key *= 0x9E3779B97F4A7C15ULL;
+    return (unsigned long)(key >> 32) & (PC_MEMO - 1);
+}
+
+static tBits MemoKey(const tPcSearch *search, int level)
+{
+    return search->boards[level] | ((tBits)level << 48) | ((tBits)search->lines[level] << 56);
+}
+
+// Searches root moves part, part + parts, ... only, so a caller can split
+// one problem across several searches, each in its own search state and
+// counting into its own stats. Returns the pieces in the solution found, 0
+// if there is none, or -1 if pcNodeLimit ran out first.
+int PcSolveIn(tPcSearch *search, tGame *game, const unsigned char *queue, int count, int part, int parts,
+              tPcMove *solution)
+{
+    search->stats->solves++;
+    if(count > PC_MAX_PIECES)
+    {
+        count = PC_MAX_PIECES;
+    }
+
+    // Pack the window, nothing may sit above it
+    tBits board = 0;
+    int i, j;
+    for(i = 0; i < GAME_ROWS; i++)
+    {
+        tBits row = GameRowBits(game, i);
+        if(!row)
+        {
+            continue;
+        }
+        if(i < GAME_ROWS - PC_ROWS)
+        {
+            return 0;
+        }
+        board |= row << ((i - (GAME_ROWS - PC_ROWS)) * GAME_COLS);
+    }
+
+    search->evenColumns = 0;
+    search->firstColumn = 0;
+    search->lastColumn = 0;
+    for(i = 0; i < PC_ROWS; i++)
+    {
+        for(j = 0; j < GAME_COLS; j += 2)
+        {
+            search->evenColumns |= 1ULL << (i * GAME_COLS + j);
+        }
+        search->firstColumn |= 1ULL << (i * GAME_COLS);
+        search->lastColumn |= 1ULL << (i * GAME_COLS + GAME_COLS - 1);
+    }
+
+    int height = 0;
+    for(i = 0; i < PC_ROWS && !height; i++)
+    {
+        if((board >> (i * GAME_COLS)) & FULL_ROW)
+        {
+            height = PC_ROWS - i;
+        }
+    }
+
+    unsigned long nodes = 0;
+
+    // Fewest lines first, each needs its own search
+    int clear;
+    for(clear = height ? height : 1; clear <= PC_ROWS; clear++)
+    {
+        if(Hopeless(search, board, clear, queue, 0, count))
+        {
+            continue;
+        }
+
+        memset(search->memo, 0, sizeof(search->memo));
+        search->boards[0] = board;
+        search->lines[0] = clear;
+        Generate(search, 0, queue[0]);
+        search->moveNext[0] = part;
+
+        int level = 0;
+        while(level >= 0)
+        {
+            int step = level ? 1 : parts;
+            if(search->moveNext[level] >= search->moveCount[level])
+            {
+                search->memo[MemoSlot(MemoKey(search, level))] = MemoKey(search, level);
+                level--;
+                continue;
+            }
+
+            int pose = search->moves[level][search->moveNext[level]];
+            search->moveNext[level] += step;
+
+            tBits next = search->boards[level] | LockBits(queue[level], pose);
+            int left = search->lines[level] - ClearRows(&next);
+
+            if(!left)
+            {
+                // Solved, read the poses back off the stack
+                for(i = 0; i <= level; i++)
+                {
+                    int p = search->moves[i][search->moveNext[i] - (i ? 1 : parts)];
+                    solution[i].shape = queue[i];
+                    solution[i].orientation = p / (PC_POSE_X_SPAN * PC_POSE_Y_SPAN);
+                    solution[i].x = p % PC_POSE_X_SPAN - 3;
+                    solution[i].y = (p / PC_POSE_X_SPAN) % PC_POSE_Y_SPAN - 4 + GAME_ROWS - PC_ROWS;
+                }
+                return level + 1;
+            }
+
+            if(level + 1 == count || Hopeless(search, next, left, queue, level + 1, count))
+            {
+                search->stats->pruned++;
+                continue;
+            }
+
+            search->boards[level + 1] = next;
+            search->lines[level + 1] = left;
+            tBits key = MemoKey(search, level + 1);
+            if(search->memo[MemoSlot(key)] == key)
+            {
+                search->stats->memoHits++;
+                continue;
+            }
+
+            if(pcNodeLimit && ++nodes > pcNodeLimit)
+            {
+                search->stats->limited++;
+                return -1;
+            }
+
+            level++;
+            search->stats->nodes++;
+            Generate(search, level, queue[level]);
+        }
+    }
+
+    return 0;
+}
+
+// As PcSolveIn, in the one search state the firmware has, counting into
+// pcStats
+int PcSolvePart(tGame *game, const unsigned char *queue, int count, int part, int parts, tPcMove *solution)
+{
+    pcSearch.stats = &pcStats;
+    return PcSolveIn(&pcSearch, game, queue, count, part, parts, solution);
+}
+
+// Returns the pieces in a perfect clear using queue in order, 0 if there is
+// none, or -1 if pcNodeLimit ran out first
+int PcSolve(tGame *game, const unsigned char *queue, int count, tPcMove *solution)
+{
+    return PcSolvePart(game, queue, count, 0, 1, solution);
+}
@@ -0,0 +1,79 @@
+#ifndef __PC_H__
+#define __PC_H__
+
+#include "game.h"
+
+// Perfect clear solver. Searches the bottom PC_ROWS rows of the board as a
+// bitboard, placing pieces from a known queue in order, for a sequence that
+// leaves the board empty. Everything above the window must already be empty.
+#define PC_ROWS 4
+#define PC_MAX_PIECES 12 // Longest queue searched
+#define PC_MAX_MOVES 80  // Lock positions kept per piece
+
+// One piece of a solution, as a lock position on the board at the time
+// it is placed
+typedef struct
+{
+    unsigned char shape;
+    unsigned char orientation;
+    signed char x;
+    signed char y;
+} tPcMove;
+
+typedef struct
+{
+    unsigned long solves;
+    unsigned long nodes;     // Boards expanded
+    unsigned long pruned;    // Boards cut by the cell count, area and parity checks
+    unsigned long memoHits;  // Boards already known to fail
+    unsigned long truncated; // Lock positions dropped over PC_MAX_MOVES
+    unsigned long limited;   // Searches stopped by pcNodeLimit
+} tPcStats;
+
+// Poses searched, y from 4 rows above the window to its bottom row
+#define PC_POSE_X_SPAN (GAME_COLS + 3)
+#define PC_POSE_Y_SPAN (PC_ROWS + 4)
+#define PC_POSES (4 * PC_POSE_Y_SPAN * PC_POSE_X_SPAN)
+#define PC_MEMO 512 // Failed boards remembered, a power of two
+
+// Everything one search writes. The firmware has one, which PcSolve and
+// PcSolvePart use; host tools give each thread its own for PcSolveIn.
+typedef struct
+{
+    // Search stack, one level per piece placed
+    unsigned long long boards[PC_MAX_PIECES + 1];
+    unsigned char lines[PC_MAX_PIECES + 1]; // Lines still to clear
+    unsigned short moves[PC_MAX_PIECES][PC_MAX_MOVES];
+    unsigned char moveCount[PC_MAX_PIECES];
+    unsigned char moveNext[PC_MAX_PIECES];
+
+    // Pose search, shared by every level
+    unsigned long visited[(PC_POSES + 31) / 32];
+    unsigned short poseQueue[PC_POSES];
+    unsigned long long lockMasks[PC_MAX_MOVES];
+
+    // The piece being placed in each orientation and column, as window
+    // bits with the top of its box on row 0, and the lowest row of the box
+    // it fills. Columns where it would hang off the side are 0.
+    unsigned long long shapeBits[4][PC_POSE_X_SPAN];
+    int shapeBottom[4];
+
+    // Bits of the even columns for the parity check, and of the first and
+    // last columns
+    unsigned long long evenColumns;
+    unsigned long long firstColumn;
+    unsigned long long lastColumn;
+
+    unsigned long long memo[PC_MEMO];
+    tPcStats *stats; // Where the search counts
+} tPcSearch;
+
+extern tPcStats pcStats;
+extern unsigned long pcNodeLimit; // Boards expanded per search, 0 for no limit
+
+extern int PcSolve(tGame *game, const unsigned char *queue, int count, tPcMove *solution);
+extern int PcSolvePart(tGame *game, const unsigned char *queue, int count, int part, int parts, tPcMove *solution);
+extern int PcSolveIn(tPcSearch *search, tGame *game, const unsigned char *queue, int count, int part, int parts,
+                     tPcMove *solution);
+
+#endif
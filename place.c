@@ -0,0 +1,266 @@
+#include <string.h>
+#include "game.h"
+#include "place.h"
+
+// Breadth-first search over piece poses (x, y, orientation) from a starting
+// pose. Each move is one button action, so the first time a pose is reached
+// is along a shortest path. Gravity is not modelled; it is slow next to
+// button presses. Collisions are tested on a copy of the board a row per
+// word, which gives the same answers as GameFits in a few operations per
+// row of the piece instead of a cell read per square of its box.
+
+// Poses in one orientation
+#define PLACE_LAYER (GAME_ROWS * PLACE_X_SPAN)
+
+#define FULL_ROW ((1 << GAME_COLS) - 1)
+
+// Orientation and box offset covering the same cells as each orientation,
+// so a lock position reachable in two orientation indices counts once
+static const signed char sameCells[7][4][3] =
+{
+    { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0,  0, 0 } }, // O
+    { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 1,  0, 1 } }, // I
+    { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 0, 1 }, { 1, -1, 0 } }, // S
+    { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 0, 1 }, { 1, -1, 0 } }, // Z
+    { { 0, 0, 0 }, { 1, 0, 0 }, { 2, 0, 0 }, { 3,  0, 0 } }, // L
+    { { 0, 0, 0 }, { 1, 0, 0 }, { 2, 0, 0 }, { 3,  0, 0 } }, // J
+    { { 0, 0, 0 }, { 1, 0, 0 }, { 2, 0, 0 }, { 3,  0, 0 } }  // T
+};
+
+tPlaceStats placeStats;
+
+// The search PlaceFind and PlacePath use
+static tPlaceSearch placeSearch;
+
+static int Node(int orientation, int x, int y)
+{
+    return orientation * PLACE_LAYER + y * PLACE_X_SPAN + x + 3;
+}
+
+// Sets a bit, returns 1 if it was already set
+static int TestAndSet(unsigned long *bits, int node)
+{
+    unsigned long bit = 1UL << (node & 31);
+    if(bits[node >> 5] & bit)
+    {
+        return 1;
+    }
+
+    bits[node >> 5] |= bit;
+    return 0;
+}
+
+// GameFits on the search's copy of the board
+static int Fits(const tPlaceSearch *search, int shape, int orientation, int x, int y)
+{
+    int mask = shapeMasks[shape][orientation];
+    int i;
+    for(i = 0; i < 4; i++)
+    {
+        int bits = (mask >> (4 * i)) & 0xF;
+        if(!bits)
+        {
+            continue;
+        }
+
+        int row = y + i;
+        if(row < 0 || row >= GAME_ROWS)
+        {
+            return 0;
+        }
+
+        if(x < 0)
+        {
+            if(bits & ((1 << -x) - 1))
+            {
+                return 0; // Off the left edge
+            }
+            bits >>= -x;
+        }
+        else
+        {
+            bits <<= x;
+        }
+
+        if((bits & ~FULL_ROW) || (bits & search->rows[row]))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void Visit(tPlaceSearch *search, int shape, int orientation, int x, int y, int move, int *tail)
+{
+    if(!Fits(search, shape, orientation, x, y))
+    {
+        return;
+    }
+
+    int node = Node(orientation, x, y);
+    if(TestAndSet(search->visited, node))
+    {
+        return;
+    }
+
+    search->moveTo[node] = move;
+    search->queue[(*tail)++] = node;
+    search->stats->nodes++;
+}
+
+// Records a lock position the first time its cells are reached. Returns the
+// new placement count.
+static int Record(tPlaceSearch *search, int shape, int orientation, int x, int y, int node, int drop,
+                  int presses, tPlacement *placements, int count, int max)
+{
+    const signed char *same = sameCells[shape][orientation];
+    if(TestAndSet(search->placed, Node(same[0], x + same[1], y + same[2])))
+    {
+        return count;
+    }
+
+    if(count < max)
+    {
+        tPlacement *placement = &placements[count];
+        placement->x = x;
+        placement->y = y;
+        placement->orientation = orientation;
+        placement->drop = drop;
+        placement->presses = presses;
+        placement->node = node;
+    }
+
+    search->stats->placements++;
+    return count + 1;
+}
+
+// Finds every lock position the piece can reach from the given pose, along
+// with the fewest moves to get there, in the caller's search state. Stores
+// at most max placements, in order of increasing presses, and returns how
+// many were found.
+int PlaceFindIn(tPlaceSearch *search, tGame *game, int shape, int orientation, int x, int y,
+                tPlacement *placements, int max)
+{
+    memset(search->visited, 0, sizeof(search->visited));
+    memset(search->placed, 0, sizeof(search->placed));
+    search->stats->searches++;
+
+    int i;
+    for(i = 0; i < GAME_ROWS; i++)
+    {
+        search->rows[i] = GameRowBits(game, i);
+    }
+
+    if(y < 0 || !Fits(search, shape, orientation, x, y))
+    {
+        return 0;
+    }
+
+    int head = 0;
+    int tail = 0;
+    int count = 0;
+    int presses = 0;
+    Visit(search, shape, orientation, x, y, MOVE_NONE, &tail);
+
+    // One layer of the queue per press count. Poses in a layer that have
+    // landed are recorded before the hard drops out of the same layer, which
+    // cost one press more, so every lock position is first recorded along a
+    // shortest path.
+    while(head < tail)
+    {
+        int end = tail;
+
+        for(i = head; i < end; i++)
+        {
+            int node = search->queue[i];
+            int o = node / PLACE_LAYER;
+            int nodeY = (node % PLACE_LAYER) / PLACE_X_SPAN;
+            int nodeX = node % PLACE_X_SPAN - 3;
+
+            if(!Fits(search, shape, o, nodeX, nodeY + 1))
+            {
+                count = Record(search, shape, o, nodeX, nodeY, node, 0, presses, placements, count, max);
+            }
+        }
+
+        for(i = head; i < end; i++)
+        {
+            int node = search->queue[i];
+            int o = node / PLACE_LAYER;
+            int nodeY = (node % PLACE_LAYER) / PLACE_X_SPAN;
+            int nodeX = node % PLACE_X_SPAN - 3;
+
+            int distance = GameDropDistanceAt(game, shape, o, nodeX, nodeY);
+            if(distance)
+            {
+                count = Record(search, shape, o, nodeX, nodeY + distance, node, 1, presses + 1, placements, count, max);
+            }
+
+            Visit(search, shape, o, nodeX - 1, nodeY, MOVE_LEFT, &tail);
+            Visit(search, shape, o, nodeX + 1, nodeY, MOVE_RIGHT, &tail);
+            Visit(search, shape, (o + 1) & 3, nodeX, nodeY, MOVE_ROTATE, &tail);
+            Visit(search, shape, o, nodeX, nodeY + 1, MOVE_DOWN, &tail);
+        }
+
+        head = end;
+        presses++;
+    }
+
+    return count;
+}
+
+// Writes the moves leading to a placement from the search's most recent
+// PlaceFindIn, at most max of them. Returns the full path length.
+int PlacePathIn(const tPlaceSearch *search, const tPlacement *placement, unsigned char *moves, int max)
+{
+    int i = placement->presses;
+    int node = placement->node;
+
+    if(placement->drop && --i < max)
+    {
+        moves[i] = MOVE_DROP;
+    }
+
+    // Walk back to the start, undoing each move
+    while(search->moveTo[node] != MOVE_NONE)
+    {
+        int move = search->moveTo[node];
+        if(--i < max)
+        {
+            moves[i] = move;
+        }
+
+        switch(move)
+        {
+        case MOVE_LEFT:
+            node++;
+            break;
+        case MOVE_RIGHT:
+            node--;
+            break;
+        case MOVE_DOWN:
+            node -= PLACE_X_SPAN;
+            break;
+        case MOVE_ROTATE:
+            node += node < PLACE_LAYER ? 3 * PLACE_LAYER : -PLACE_LAYER;
+            break;
+        }
+    }
+
+    return placement->presses;
+}
+
+// As PlaceFindIn, in the one search state the firmware has, counting into
+// placeStats
+int PlaceFind(tGame *game, int shape, int orientation, int x, int y, tPlacement *placements, int max)
+{
+    placeSearch.stats = &placeStats;
+    return PlaceFindIn(&placeSearch, game, shape, orientation, x, y, placements, max);
+}
+
+// Path to a placement from the most recent PlaceFind
+int PlacePath(const tPlacement *placement, unsigned char *moves, int max)
+{
+    return PlacePathIn(&placeSearch, placement, moves, max);
+}
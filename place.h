@@ -0,0 +1,58 @@
+#ifndef __PLACE_H__
+#define __PLACE_H__
+
+#include "game.h"
+
+// Moves making up a placement path, one button action each
+#define MOVE_NONE   0
+#define MOVE_LEFT   1
+#define MOVE_RIGHT  2
+#define MOVE_ROTATE 3
+#define MOVE_DOWN   4 // Soft drop one row
+#define MOVE_DROP   5 // Hard drop, only ever the last move
+
+// Piece poses searched. The 4x4 box can hang up to 3 columns off the left
+// edge; it never starts above the top row.
+#define PLACE_X_SPAN (GAME_COLS + 3)
+#define PLACE_NODES (4 * GAME_ROWS * PLACE_X_SPAN)
+
+// One reachable lock position, the pose the piece rests in after its path
+typedef struct
+{
+    signed char x;
+    signed char y;
+    unsigned char orientation;
+    unsigned char drop;     // Path ends with MOVE_DROP from node
+    unsigned short presses; // Moves in the shortest path
+    unsigned short node;    // Search node the path leads to
+} tPlacement;
+
+typedef struct
+{
+    unsigned long searches;
+    unsigned long nodes;      // Poses visited
+    unsigned long placements; // Distinct lock positions found
+} tPlaceStats;
+
+// Everything one search writes, kept for PlacePathIn until the next
+// search. The firmware has one, which PlaceFind and PlacePath use; host
+// tools give each thread its own.
+typedef struct
+{
+    tPlaceStats *stats; // Where the search counts
+    unsigned short rows[GAME_ROWS]; // The board a row per word, bit j for column j
+    unsigned long visited[(PLACE_NODES + 31) / 32];
+    unsigned long placed[(PLACE_NODES + 31) / 32];
+    unsigned short queue[PLACE_NODES];
+    unsigned char moveTo[PLACE_NODES]; // Move that first reached each pose
+} tPlaceSearch;
+
+extern tPlaceStats placeStats;
+
+extern int PlaceFind(tGame *game, int shape, int orientation, int x, int y, tPlacement *placements, int max);
+extern int PlacePath(const tPlacement *placement, unsigned char *moves, int max);
+extern int PlaceFindIn(tPlaceSearch *search, tGame *game, int shape, int orientation, int x, int y,
+                       tPlacement *placements, int max);
+extern int PlacePathIn(const tPlaceSearch *search, const tPlacement *placement, unsigned char *moves, int max);
+
+#endif
@@ -0,0 +1,159 @@
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/cpu.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/systick.h"
+#include "driverlib/timer.h"
+#include "drivers/rit128x96x4.h"
+#include "globals.h"
+#include "power.h"
+
+// SysTick free runs over its full 24 bits as a cycle counter. Its interrupt
+// wakes the core at least once per wrap so no measured interval is longer
+// than the counter.
+#define POWER_SYSTICK_PERIOD 0x1000000
+#define POWER_SYSTICK_MASK 0xFFFFFF
+
+tPowerStats powerStats;
+unsigned long powerDisplayTimeout = POWER_DISPLAY_TIMEOUT;
+
+static unsigned long idleTicks = 0;
+static int displayOn = 1;
+static int deepIdle = 0;
+
+static unsigned long lastCount;
+static unsigned long windowActive;
+static unsigned long windowTotal;
+
+static void Account(int sleeping)
+{
+    unsigned long now = SysTickValueGet();
+    unsigned long elapsed = (lastCount - now) & POWER_SYSTICK_MASK; // Counts down
+    lastCount = now;
+
+    if(sleeping)
+    {
+        powerStats.sleepCycles += elapsed;
+    }
+    else
+    {
+        powerStats.activeCycles += elapsed;
+        windowActive += elapsed;
+    }
+
+    windowTotal += elapsed;
+    if(windowTotal >= g_ulSystemClock)
+    {
+        powerStats.dutyCycle = windowActive / (windowTotal / 1000);
+        windowActive = 0;
+        windowTotal = 0;
+    }
+}
+
+static void UpdateDisplay(void)
+{
+    int idle = powerDisplayTimeout && idleTicks >= powerDisplayTimeout;
+
+    if(displayOn && idle)
+    {
+        RIT128x96x4DisplayOff();
+        displayOn = 0;
+        powerStats.displayOffs++;
+    }
+    else if(!displayOn && !idle)
+    {
+        RIT128x96x4DisplayOn();
+        displayOn = 1;
+    }
+}
+
+void PowerInit(void)
+{
+    SysTickPeriodSet(POWER_SYSTICK_PERIOD);
+    SysTickIntEnable();
+    SysTickEnable();
+    lastCount = SysTickValueGet();
+
+    // Button edges only wake the core from deep idle, masked otherwise
+    GPIOIntTypeSet(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3, GPIO_FALLING_EDGE);
+    GPIOIntTypeSet(GPIO_PORTF_BASE, GPIO_PIN_1, GPIO_FALLING_EDGE);
+    IntEnable(INT_GPIOE);
+    IntEnable(INT_GPIOF);
+}
+
+// Called once per game tick with the buttons held and whether a game is
+// being played. A live game keeps the display on however long it goes
+// without a press, so only the time since the last press at game over
+// counts. Returns 1 if the display should come back.
+int PowerTick(int input, int playing)
+{
+    if(input || playing)
+    {
+        idleTicks = 0;
+        return !displayOn;
+    }
+
+    if(idleTicks != 0xFFFFFFFF)
+    {
+        idleTicks++;
+    }
+
+    return 0;
+}
+
+// Switches the display to match the idle state. Returns 1 while it is on.
+int PowerDisplay(void)
+{
+    UpdateDisplay();
+    return displayOn;
+}
+
+// Sleeps until the next interrupt. Called with interrupts masked so an event
+// arriving just before WFI still wakes it; the handler runs before returning.
+// With deep set and the display off the game timer is stopped and only a
+// button press wakes the core.
+void PowerIdle(int deep)
+{
+    Account(0);
+
+    UpdateDisplay();
+    if(deep && !displayOn && !deepIdle)
+    {
+        deepIdle = 1;
+        TimerDisable(TIMER0_BASE, TIMER_A);
+        GPIOPinIntClear(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3);
+        GPIOPinIntClear(GPIO_PORTF_BASE, GPIO_PIN_1);
+        GPIOPinIntEnable(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3);
+        GPIOPinIntEnable(GPIO_PORTF_BASE, GPIO_PIN_1);
+    }
+
+    CPUwfi();
+
+    Account(1);
+    powerStats.wakeups++;
+
+    IntMasterEnable();
+    IntMasterDisable();
+}
+
+void PowerButtonIntHandler(void)
+{
+    GPIOPinIntDisable(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3);
+    GPIOPinIntDisable(GPIO_PORTF_BASE, GPIO_PIN_1);
+    GPIOPinIntClear(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3);
+    GPIOPinIntClear(GPIO_PORTF_BASE, GPIO_PIN_1);
+
+    // Restart the game timer and bring the display back on the next idle pass
+    idleTicks = 0;
+    if(deepIdle)
+    {
+        deepIdle = 0;
+        TimerEnable(TIMER0_BASE, TIMER_A);
+    }
+}
+
+void PowerSysTickIntHandler(void)
+{
+}
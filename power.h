@@ -0,0 +1,27 @@
+#ifndef __POWER_H__
+#define __POWER_H__
+
+// Ticks without a button press, once no game is being played, before the
+// display is switched off (30 s). The console's idle command changes it.
+#define POWER_DISPLAY_TIMEOUT 3000
+
+typedef struct
+{
+    unsigned long long activeCycles; // Cycles spent running since reset
+    unsigned long long sleepCycles;  // Cycles spent in WFI since reset
+    unsigned long dutyCycle;         // Active cycles per 1000 over the last second
+    unsigned long wakeups;
+    unsigned long displayOffs;
+} tPowerStats;
+
+extern tPowerStats powerStats;
+extern unsigned long powerDisplayTimeout; // 0 keeps the display on
+
+extern void PowerInit(void);
+extern int PowerTick(int input, int playing);
+extern int PowerDisplay(void);
+extern void PowerIdle(int deep);
+extern void PowerButtonIntHandler(void);
+extern void PowerSysTickIntHandler(void);
+
+#endif
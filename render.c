@@ -0,0 +1,148 @@
+#include <stddef.h>
+#include "anim.h"
+#include "game.h"
+#include "graphics.h"
+#include "frame.h"
+#include "render.h"
+
+// Draws the game into a frame buffer rather than straight to the display, so
+// the same code renders on the target and off it
+
+const tBoardView singleView = { BOARD_X, BOARD_Y, PREVIEW_X, PREVIEW_Y, 1 };
+
+const tBoardView splitViews[2] =
+{
+    { SPLIT_LEFT_X, BOARD_Y, SPLIT_PREVIEW_X, BOARD_Y, 1 },
+    { SPLIT_RIGHT_X, BOARD_Y, SPLIT_PREVIEW_X, BOARD_Y + 6 * CELL_SIZE, 0 },
+};
+
+void IntToString(int input, char *str)
+{
+    // Writes six digits and a terminator, only works with non-negative
+    // values 0 - 999999. Kept off the heap, which is empty in Release.
+    int i;
+    for(i = 5; i >= 0; i--)
+    {
+        str[i] = (input % 10) + '0';
+        input /= 10;
+    }
+    str[6] = '\0';
+}
+
+// Locked cells are drawn in the shade of the piece they came from. Cells of
+// rows being wiped by the clear animation are gone from the grid and drawn
+// as plain blocks.
+static void DrawBoard(unsigned char *frame, const tGame *game, const tBoardView *view)
+{
+    int animating = view->animated && AnimActive();
+
+    int i, j;
+    for(i = 0; i < GAME_VISIBLE_ROWS; i++)
+    {
+        int source = GAME_HIDDEN_ROWS + i;
+        if(animating)
+        {
+            source = AnimSourceRow(source); // Board as it was before the clear
+        }
+
+        for(j = 0; j < GAME_COLS; j++)
+        {
+            const unsigned char *bitmap = clear;
+            if(source < 0)
+            {
+                bitmap = AnimCellShown(j) ? block : clear;
+            }
+            else if(source < GAME_ROWS)
+            {
+                int cell = GAME_CELL(game, j, source);
+                bitmap = cell ? shades[cell - 1] : clear;
+            }
+            FrameImageDraw(frame, bitmap,
+                           view->x + (CELL_SIZE * j), view->y + (CELL_SIZE * i),
+                           CELL_SIZE, CELL_SIZE);
+        }
+    }
+}
+
+static void DrawPiece(unsigned char *frame, int mask, int xAbs, int yAbs, const unsigned char *bufferT, const unsigned char *bufferF)
+{
+    int i, j;
+#ifdef __TI_COMPILER_VERSION__
+    #pragma UNROLL(4)
+#endif
+    for(i = 0; i < 4; i++)
+    {
+#ifdef __TI_COMPILER_VERSION__
+        #pragma UNROLL(4)
+#endif
+        for(j = 0; j < 4; j++)
+        {
+            if(mask & (1 << (i * 4 + j)))
+            {
+                FrameImageDraw(frame, bufferT, xAbs + (CELL_SIZE * j), yAbs + (CELL_SIZE * i), CELL_SIZE, CELL_SIZE);
+            }
+            else if(bufferF)
+            {
+                FrameImageDraw(frame, bufferF, xAbs + (CELL_SIZE * j), yAbs + (CELL_SIZE * i), CELL_SIZE, CELL_SIZE);
+            }
+        }
+    }
+}
+
+static void DrawBoardPiece(unsigned char *frame, const tBoardView *view, int mask, int x, int y, const unsigned char *bitmap)
+{
+    // Drop the rows still above the visible board
+    int hidden = GAME_HIDDEN_ROWS - y;
+    if(hidden > 0)
+    {
+        mask = hidden < 4 ? mask & (0xFFFF << (4 * hidden)) : 0;
+    }
+
+    DrawPiece(frame, mask, view->x + CELL_SIZE * x, view->y + CELL_SIZE * (y - GAME_HIDDEN_ROWS), bitmap, NULL);
+}
+
+// Draws the walls either side of a board
+void RenderWalls(unsigned char *frame, const tBoardView *view)
+{
+    FrameImageDraw(frame, wall, view->x - 2, 0, 2, 96);
+    FrameImageDraw(frame, wall, view->x + GAME_COLS * CELL_SIZE, 0, 2, 96);
+}
+
+void RenderInit(unsigned char *frame)
+{
+    RenderWalls(frame, &singleView);
+}
+
+// Draws the board, piece, ghost and preview of one game
+void RenderBoard(unsigned char *frame, tGame *game, const tBoardView *view)
+{
+    DrawBoard(frame, game, view);
+
+    if(game->shape >= 0)
+    {
+        int mask = shapeMasks[game->shape][game->orientation];
+        if(!view->animated || !AnimActive()) // The ghost would land on the collapsed board
+        {
+            DrawBoardPiece(frame, view, mask, game->locationX, game->locationY + GameDropDistance(game), ghost);
+        }
+        DrawBoardPiece(frame, view, mask, game->locationX, game->locationY, shades[game->shape]);
+    }
+    if(game->nextShape >= 0)
+    {
+        DrawPiece(frame, shapeMasks[game->nextShape][O_000], view->previewX, view->previewY, shades[game->nextShape], clear); // Clears previous
+    }
+}
+
+void RenderGame(unsigned char *frame, tGame *game)
+{
+    RenderBoard(frame, game, &singleView);
+}
+
+// Draws the score beside the board, separate so it can be refreshed less often
+void RenderScore(unsigned char *frame, tGame *game)
+{
+    char scoreSt[7];
+    IntToString(game->score, scoreSt);
+    FrameStringDraw(frame, "Score:", 0, 70, 15);
+    FrameStringDraw(frame, scoreSt, 0, 80, 15);
+}
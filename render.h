@@ -0,0 +1,42 @@
+#ifndef __RENDER_H__
+#define __RENDER_H__
+
+#include "frame.h"
+#include "game.h"
+#include "graphics.h"
+
+// Board placement on the 128x96 display, only the visible rows are drawn
+#define BOARD_X ((128 - GAME_COLS * CELL_SIZE) / 2)
+#define BOARD_Y (96 - GAME_VISIBLE_ROWS * CELL_SIZE)
+#define PREVIEW_X (BOARD_X + (GAME_COLS + 3) * CELL_SIZE)
+#define PREVIEW_Y (BOARD_Y - 2 * CELL_SIZE)
+
+// Split screen, the player on the left and the computer on the right with
+// both previews and scores in the column between them
+#define SPLIT_LEFT_X 4
+#define SPLIT_RIGHT_X (FRAME_WIDTH - 4 - GAME_COLS * CELL_SIZE)
+#define SPLIT_MIDDLE_X (SPLIT_LEFT_X + GAME_COLS * CELL_SIZE + 2)
+#define SPLIT_MIDDLE_WIDTH (SPLIT_RIGHT_X - 2 - SPLIT_MIDDLE_X)
+#define SPLIT_PREVIEW_X (SPLIT_MIDDLE_X + (SPLIT_MIDDLE_WIDTH - 4 * CELL_SIZE) / 2)
+
+// Where one board is drawn
+typedef struct
+{
+    int x;        // Left of the board, even
+    int y;        // Top of the visible rows
+    int previewX; // Top left of the next piece, even
+    int previewY;
+    int animated; // Shows the line clear animation
+} tBoardView;
+
+extern const tBoardView singleView;
+extern const tBoardView splitViews[2];
+
+extern void IntToString(int input, char *str);
+extern void RenderWalls(unsigned char *frame, const tBoardView *view);
+extern void RenderInit(unsigned char *frame);
+extern void RenderBoard(unsigned char *frame, tGame *game, const tBoardView *view);
+extern void RenderGame(unsigned char *frame, tGame *game);
+extern void RenderScore(unsigned char *frame, tGame *game);
+
+#endif
@@ -0,0 +1,261 @@
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_pwm.h"
+#include "inc/hw_timer.h"
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/pwm.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#include "audio.h"
+#include "globals.h"
+#include "sched.h"
+#include "sample.h"
+
+// Samples play by setting the PWM duty from the Timer1 interrupt, once per
+// sample. The PWM clock is undivided while samples play so the carrier is
+// well above hearing. The audio task decodes and mixes the voices into a
+// ring ahead of the interrupt, which only copies one byte per sample.
+#define SAMPLE_PWM_PERIOD 256 // Up/down counting, 31.25 kHz carrier at 8 MHz
+#define SAMPLE_LEVELS (SAMPLE_PWM_PERIOD / 2)
+#define SAMPLE_SILENCE (SAMPLE_LEVELS / 2)
+
+// 64 ms of output, so a long render does not starve the interrupt
+#define SAMPLE_RING 512
+
+typedef struct
+{
+    const unsigned char *data; // 0 once the sample has finished
+    unsigned long samples;
+    unsigned long position;
+    int predictor;
+    int index;
+} tVoice;
+
+// IMA-ADPCM quantizer steps and step index changes
+static const short stepTable[89] =
+{
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209,
+    230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876,
+    963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749,
+    3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623,
+    27086, 29794, 32767
+};
+
+static const signed char indexTable[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+tSampleStats sampleStats;
+
+static tVoice voices[SAMPLE_VOICES];
+static int active = 0;  // A voice still has samples to decode
+static int playing = 0; // Timer and PWM set up for samples
+
+static volatile unsigned char ring[SAMPLE_RING]; // Volatile too, so a level is stored before ringHead moves past it
+static volatile unsigned long ringHead = 0; // Written by the audio task only
+static volatile unsigned long ringTail = 0; // Written by the interrupt only
+
+static int Decode(tVoice *voice)
+{
+    int code = voice->data[voice->position >> 1];
+    code = voice->position & 1 ? code >> 4 : code & 0x0F;
+
+    int step = stepTable[voice->index];
+    int diff = step >> 3;
+    if(code & 1)
+    {
+        diff += step >> 2;
+    }
+    if(code & 2)
+    {
+        diff += step >> 1;
+    }
+    if(code & 4)
+    {
+        diff += step;
+    }
+
+    voice->predictor += code & 8 ? -diff : diff;
+    if(voice->predictor > 32767)
+    {
+        voice->predictor = 32767;
+    }
+    else if(voice->predictor < -32768)
+    {
+        voice->predictor = -32768;
+    }
+
+    voice->index += indexTable[code & 7];
+    if(voice->index < 0)
+    {
+        voice->index = 0;
+    }
+    else if(voice->index > 88)
+    {
+        voice->index = 88;
+    }
+
+    if(++voice->position == voice->samples)
+    {
+        voice->data = 0;
+    }
+
+    return voice->predictor;
+}
+
+// Decodes and mixes the voices until the ring is full or they finish
+static void Fill(void)
+{
+    int volume = AudioVolumeGet();
+
+    while(ringHead - ringTail < SAMPLE_RING)
+    {
+        int mix = 0;
+        active = 0;
+
+        int i;
+        for(i = 0; i < SAMPLE_VOICES; i++)
+        {
+            if(voices[i].data)
+            {
+                mix += Decode(&voices[i]);
+                active = 1;
+            }
+        }
+
+        if(!active)
+        {
+            break;
+        }
+
+        // One full scale voice spans the duty range at full volume, two
+        // together may clip
+        int level = SAMPLE_SILENCE + (mix >> 9) * volume / 100;
+        if(level < 0)
+        {
+            level = 0;
+        }
+        else if(level > SAMPLE_LEVELS - 1)
+        {
+            level = SAMPLE_LEVELS - 1;
+        }
+
+        ring[ringHead % SAMPLE_RING] = level;
+        ringHead++;
+    }
+}
+
+static void Start(void)
+{
+    AudioOff();
+
+    PWMGenDisable(PWM0_BASE, PWM_GEN_0);
+    SysCtlPWMClockSet(SYSCTL_PWMDIV_1);
+
+    // Compare updates take effect at the next zero count without a global
+    // sync, so the interrupt only has to write the register
+    PWMGenConfigure(PWM0_BASE, PWM_GEN_0, PWM_GEN_MODE_UP_DOWN | PWM_GEN_MODE_NO_SYNC);
+    PWMGenPeriodSet(PWM0_BASE, PWM_GEN_0, SAMPLE_PWM_PERIOD);
+    HWREG(PWM0_BASE + PWM_GEN_0_OFFSET + PWM_O_X_CMPB) = SAMPLE_SILENCE;
+    PWMGenEnable(PWM0_BASE, PWM_GEN_0);
+    PWMOutputState(PWM0_BASE, PWM_OUT_1_BIT, true);
+    PWMOutputInvert(PWM0_BASE, PWM_OUT_1_BIT, true);
+
+    TimerEnable(TIMER1_BASE, TIMER_A);
+    playing = 1;
+}
+
+static void Stop(void)
+{
+    TimerDisable(TIMER1_BASE, TIMER_A);
+    SysCtlPWMClockSet(SYSCTL_PWMDIV_8);
+    AudioOn(); // Back to muted tones
+    playing = 0;
+}
+
+void SampleInit(void)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
+    TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC);
+    TimerLoadSet(TIMER1_BASE, TIMER_A, g_ulSystemClock / SAMPLE_RATE);
+    TimerIntEnable(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+    IntEnable(INT_TIMER1A);
+}
+
+// Starts a 4 bit IMA-ADPCM sample of length bytes on a free voice, or on
+// the voice furthest through its sample. Tones stop while samples play.
+void SamplePlay(const unsigned char *data, unsigned long length)
+{
+    tVoice *voice = &voices[0];
+
+    int i;
+    for(i = 0; i < SAMPLE_VOICES; i++)
+    {
+        if(!voices[i].data)
+        {
+            voice = &voices[i];
+            break;
+        }
+        if(voices[i].position > voice->position)
+        {
+            voice = &voices[i];
+        }
+    }
+
+    voice->samples = 2 * length;
+    voice->position = 0;
+    voice->predictor = 0;
+    voice->index = 0;
+    voice->data = data;
+
+    Fill();
+    if(!playing)
+    {
+        Start();
+    }
+}
+
+// Keeps the ring ahead of the interrupt, called once per tick. Returns 1
+// while samples are playing.
+int SampleTask(void)
+{
+    if(!playing)
+    {
+        return 0;
+    }
+
+    Fill();
+    if(!active && ringHead == ringTail)
+    {
+        Stop();
+    }
+
+    return playing;
+}
+
+// Timer1 interrupt, once per sample
+void SampleIntHandler(void)
+{
+    unsigned long start = SchedTimestamp();
+
+    HWREG(TIMER1_BASE + TIMER_O_ICR) = TIMER_TIMA_TIMEOUT;
+
+    if(ringTail != ringHead)
+    {
+        HWREG(PWM0_BASE + PWM_GEN_0_OFFSET + PWM_O_X_CMPB) = ring[ringTail % SAMPLE_RING];
+        ringTail++;
+    }
+    else if(active)
+    {
+        sampleStats.underruns++;
+    }
+
+    unsigned long cycles = SchedElapsed(start, SchedTimestamp());
+    sampleStats.interrupts++;
+    sampleStats.cycles += cycles;
+    if(cycles > sampleStats.wcet)
+    {
+        sampleStats.wcet = cycles;
+    }
+}
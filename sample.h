@@ -0,0 +1,23 @@
+#ifndef __SAMPLE_H__
+#define __SAMPLE_H__
+
+// Sample playback rate in Hz, and voices mixed together
+#define SAMPLE_RATE 8000
+#define SAMPLE_VOICES 2
+
+typedef struct
+{
+    unsigned long interrupts;
+    unsigned long cycles;     // Total cycles spent in the sample interrupt
+    unsigned long wcet;       // Worst case cycles for one sample
+    unsigned long underruns;  // Samples due with the ring empty
+} tSampleStats;
+
+extern tSampleStats sampleStats;
+
+extern void SampleInit(void);
+extern void SamplePlay(const unsigned char *data, unsigned long length);
+extern int SampleTask(void);
+extern void SampleIntHandler(void);
+
+#endif
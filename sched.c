@@ -0,0 +1,134 @@
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/systick.h"
+#include "sched.h"
+
+// Run-to-completion scheduler. The timer interrupt only releases periodic
+// tasks; the main loop runs the highest priority released task and keeps
+// timing statistics for it. Timestamps come from SysTick, which PowerInit
+// leaves free running as a 24 bit down counter.
+#define SCHED_TIMESTAMP_MASK 0xFFFFFF
+
+tTask schedTasks[SCHED_MAX_TASKS];
+
+unsigned long SchedTimestamp(void)
+{
+    return SysTickValueGet();
+}
+
+// Cycles between two timestamps, valid for spans under 2^24 cycles
+unsigned long SchedElapsed(unsigned long from, unsigned long to)
+{
+    return (from - to) & SCHED_TIMESTAMP_MASK;
+}
+
+static void Release(tTask *task, unsigned long now)
+{
+    if(task->pending)
+    {
+        task->merged++;
+        return;
+    }
+
+    task->released = now;
+    task->pending = 1;
+}
+
+void SchedAdd(int priority, void (*run)(void), unsigned long period, unsigned long deadline)
+{
+    tTask *task = &schedTasks[priority];
+
+    task->run = run;
+    task->period = period;
+    task->countdown = period;
+    task->deadline = deadline;
+}
+
+// Called from the timer interrupt once per tick
+void SchedTick(void)
+{
+    unsigned long now = SchedTimestamp();
+
+    int i;
+    for(i = 0; i < SCHED_MAX_TASKS; i++)
+    {
+        tTask *task = &schedTasks[i];
+        if(task->period && --task->countdown == 0)
+        {
+            task->countdown = task->period;
+            Release(task, now);
+        }
+    }
+}
+
+void SchedPost(int priority)
+{
+    tBoolean masked = IntMasterDisable();
+    Release(&schedTasks[priority], SchedTimestamp());
+    if(!masked)
+    {
+        IntMasterEnable();
+    }
+}
+
+int SchedReady(void)
+{
+    int i;
+    for(i = 0; i < SCHED_MAX_TASKS; i++)
+    {
+        if(schedTasks[i].pending)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void SchedRunNext(void)
+{
+    int i;
+    for(i = 0; i < SCHED_MAX_TASKS; i++)
+    {
+        if(schedTasks[i].pending)
+        {
+            break;
+        }
+    }
+
+    if(i == SCHED_MAX_TASKS)
+    {
+        return;
+    }
+
+    tTask *task = &schedTasks[i];
+
+    tBoolean masked = IntMasterDisable();
+    unsigned long released = task->released;
+    task->pending = 0;
+    if(!masked)
+    {
+        IntMasterEnable();
+    }
+
+    unsigned long start = SchedTimestamp();
+    task->run();
+    unsigned long end = SchedTimestamp();
+
+    unsigned long execution = SchedElapsed(start, end);
+    unsigned long response = SchedElapsed(released, end);
+
+    task->runs++;
+    if(execution > task->wcet)
+    {
+        task->wcet = execution;
+    }
+    if(response > task->wcrt)
+    {
+        task->wcrt = response;
+    }
+    if(response > task->deadline)
+    {
+        task->overruns++;
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef __SCHED_H__
+#define __SCHED_H__
+
+// Task slots, the index is the priority (0 runs first)
+#define SCHED_MAX_TASKS 8
+
+typedef struct
+{
+    void (*run)(void);
+    unsigned long period;   // Ticks between releases, 0 if released by SchedPost
+    unsigned long deadline; // Cycles allowed from release to completion
+    unsigned long countdown;
+    int pending;            // Released and waiting to run
+    unsigned long released; // Timestamp of the waiting release
+
+    unsigned long runs;
+    unsigned long merged;   // Releases that arrived while one was still waiting
+    unsigned long overruns; // Runs that completed after their deadline
+    unsigned long wcet;     // Worst-case execution time in cycles
+    unsigned long wcrt;     // Worst-case release to completion in cycles
+} tTask;
+
+extern tTask schedTasks[SCHED_MAX_TASKS];
+
+extern void SchedAdd(int priority, void (*run)(void), unsigned long period, unsigned long deadline);
+extern void SchedTick(void);
+extern void SchedPost(int priority);
+extern int SchedReady(void);
+extern void SchedRunNext(void);
+extern unsigned long SchedTimestamp(void);
+extern unsigned long SchedElapsed(unsigned long from, unsigned long to);
+
+#endif
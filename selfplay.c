@@ -0,0 +1,196 @@
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/ethernet.h"
+#include <string.h>
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "net.h"
+#include "selfplay.h"
+
+// Games run a piece at a time so no run holds up the other tasks for more
+// than one decision. Samples wait in a bounded queue until a frame's worth
+// is ready; the transmitter FIFO sends it while the next pieces are played.
+// When the queue is full the games wait for the link rather than drop data.
+
+#define SELFPLAY_ETHERTYPE 0x88B6 // IEEE 802 local experimental, after versus
+#define SELFPLAY_VERSION 1
+
+// Frame layout after the 14 byte Ethernet header:
+//  14    version
+//  15    number of samples
+//  16-19 sequence number, so the host can count lost frames
+//  20-   samples
+#define SELFPLAY_HEADER 20
+#define SELFPLAY_PER_FRAME ((1514 - SELFPLAY_HEADER) / SELFPLAY_SAMPLE_SIZE)
+
+// Power of two, two frames so one can fill while the other waits to go out
+#define SELFPLAY_QUEUE 64
+
+// Placements kept per decision, more than any piece has on an open board
+#define SELFPLAY_PLACEMENTS 64
+
+tSelfPlayStats selfPlayStats;
+
+static const unsigned char broadcast[6] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+static unsigned char mac[6];
+
+static tPolicy policy;
+static tGame game;
+static unsigned long seed;
+static unsigned short pieces; // Placed in the current game
+
+static tPlacement placements[SELFPLAY_PLACEMENTS];
+static unsigned char queue[SELFPLAY_QUEUE][SELFPLAY_SAMPLE_SIZE];
+static unsigned long queueHead = 0;
+static unsigned long queueTail = 0;
+static unsigned long sequence = 0;
+static unsigned char frame[SELFPLAY_HEADER + SELFPLAY_PER_FRAME * SELFPLAY_SAMPLE_SIZE];
+
+// Default policy, the board evaluator
+static int EvalPolicy(tGame *game, const tPlacement *placements, int count)
+{
+    return EvalChoose(game, game->shape, placements, count);
+}
+
+static void Write32(unsigned char *buf, unsigned long value)
+{
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+    buf[2] = (value >> 16) & 0xFF;
+    buf[3] = (value >> 24) & 0xFF;
+}
+
+// Snapshot of the game in the next queue slot, the caller fills the rest
+static unsigned char *Reserve(void)
+{
+    unsigned char *sample = queue[queueHead % SELFPLAY_QUEUE];
+    GameSave(&game, sample);
+
+    unsigned char *tail = &sample[GAME_SNAPSHOT_SIZE];
+    tail[4] = selfPlayStats.games & 0xFF;
+    tail[5] = (selfPlayStats.games >> 8) & 0xFF;
+    tail[6] = pieces & 0xFF;
+    tail[7] = pieces >> 8;
+    return tail;
+}
+
+static void Commit(void)
+{
+    queueHead++;
+    selfPlayStats.samples++;
+}
+
+static void NewGame(void)
+{
+    seed = seed * 1103515245UL + 12345UL;
+    GameInit(&game, seed);
+    GameStep(&game, 0); // Deal the first piece
+    pieces = 0;
+}
+
+// Sends one frame of samples once enough are queued
+static void Send(void)
+{
+    int count = queueHead - queueTail;
+    if(count < SELFPLAY_PER_FRAME)
+    {
+        return;
+    }
+    count = SELFPLAY_PER_FRAME;
+
+    memcpy(&frame[0], broadcast, 6);
+    memcpy(&frame[6], mac, 6);
+    frame[12] = SELFPLAY_ETHERTYPE >> 8;
+    frame[13] = SELFPLAY_ETHERTYPE & 0xFF;
+    frame[14] = SELFPLAY_VERSION;
+    frame[15] = count;
+    Write32(&frame[16], sequence);
+
+    int i;
+    for(i = 0; i < count; i++)
+    {
+        memcpy(&frame[SELFPLAY_HEADER + i * SELFPLAY_SAMPLE_SIZE],
+               queue[(queueTail + i) % SELFPLAY_QUEUE], SELFPLAY_SAMPLE_SIZE);
+    }
+
+    if(EthernetPacketPutNonBlocking(ETH_BASE, frame, SELFPLAY_HEADER + count * SELFPLAY_SAMPLE_SIZE) <= 0)
+    {
+        selfPlayStats.busy++;
+        return;
+    }
+
+    queueTail += count;
+    sequence++;
+    selfPlayStats.frames++;
+}
+
+// Brings up Ethernet and starts the first game. A null policy plays the
+// board evaluator.
+void SelfPlayInit(tPolicy play, unsigned long firstSeed)
+{
+    NetOpen(mac);
+
+    policy = play ? play : EvalPolicy;
+    seed = firstSeed;
+    NewGame();
+}
+
+// Places one piece, or ends the game, then sends a frame if one is ready.
+// Returns 1 when a game finished, the board is worth showing.
+int SelfPlayRun(void)
+{
+    Send();
+
+    if(queueHead - queueTail >= SELFPLAY_QUEUE)
+    {
+        selfPlayStats.held++;
+        return 0;
+    }
+
+    int count = 0;
+    if(!game.gameover)
+    {
+        count = PlaceFind(&game, game.shape, game.orientation, game.locationX, game.locationY,
+                          placements, SELFPLAY_PLACEMENTS);
+        if(count > SELFPLAY_PLACEMENTS)
+        {
+            count = SELFPLAY_PLACEMENTS;
+        }
+    }
+
+    unsigned char *tail = Reserve();
+
+    if(!count)
+    {
+        // Out of room, the final snapshot closes the game
+        memset(tail, 0xFF, 4);
+        Commit();
+        selfPlayStats.games++;
+        NewGame();
+        return 1;
+    }
+
+    const tPlacement *placement = &placements[policy(&game, placements, count)];
+    tail[0] = (unsigned char)placement->x;
+    tail[1] = placement->y;
+    tail[2] = placement->orientation;
+
+    // Drop straight from the chosen pose, then deal the next piece
+    game.orientation = placement->orientation;
+    game.locationX = placement->x;
+    game.locationY = placement->y;
+    game.buttons = 0;
+    GameStep(&game, INPUT_D);
+    GameStep(&game, 0);
+
+    tail[3] = game.lastLock.lines;
+    Commit();
+    pieces++;
+    return 0;
+}
+
+tGame *SelfPlayGame(void)
+{
+    return &game;
+}
@@ -0,0 +1,43 @@
+#ifndef __SELFPLAY_H__
+#define __SELFPLAY_H__
+
+#include "game.h"
+#include "place.h"
+
+// Self-play games for training data. A policy picks one of the placements
+// PlaceFind returns for each piece; every decision becomes a fixed size
+// sample streamed over raw Ethernet to a collector on the host. The board
+// is a demonstration source; bulk data comes from SelfPlay/selfplay.c,
+// which writes the same samples from many threads on the host.
+
+// Sample layout:
+//  0-     game snapshot before the placement, as GameSave
+//  +0     placement x (signed)
+//  +1     placement y
+//  +2     placement orientation
+//  +3     lines cleared by the placement
+//  +4-5   game number
+//  +6-7   piece number within the game
+// The last sample of each game is the final snapshot, flagged game over,
+// with the placement bytes set to 0xFF.
+#define SELFPLAY_SAMPLE_SIZE (GAME_SNAPSHOT_SIZE + 8)
+
+// Returns the index of the placement to play
+typedef int (*tPolicy)(tGame *game, const tPlacement *placements, int count);
+
+typedef struct
+{
+    unsigned long games;
+    unsigned long samples; // Samples queued
+    unsigned long frames;  // Ethernet frames sent
+    unsigned long held;    // Runs that placed nothing because the queue was full
+    unsigned long busy;    // Sends put off while the transmitter was busy
+} tSelfPlayStats;
+
+extern tSelfPlayStats selfPlayStats;
+
+extern void SelfPlayInit(tPolicy policy, unsigned long seed);
+extern int SelfPlayRun(void);
+extern tGame *SelfPlayGame(void);
+
+#endif
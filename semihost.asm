@@ -0,0 +1,18 @@
+; Semihosting call for the benchmark build. The operation arrives in r0 and
+; its argument in r1, where the AAPCS puts the first two arguments, and the
+; host reads them at the breakpoint. Kept out of C so no compiler can move
+; the arguments or inline the trap. In its own section, so builds that do
+; not call it drop it at link time.
+;
+; void Semihost(int operation, unsigned long argument)
+
+        .thumb
+        .sect   ".text:Semihost"
+        .global Semihost
+
+Semihost: .asmfunc
+        bkpt    #0xAB
+        bx      lr
+        .endasmfunc
+
+        .end
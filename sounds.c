@@ -12,3 +12,297 @@ const unsigned short fireEffect[120] =
     500, 510, 520, 530, 540, 550, 560, 570, 580, 590, 600, 610, 620, 630, 640,
     650, 660, 670, 680, 690, 700, 710, 720, 730, 740, 750, 760, 770, 780, 790
 };
+
+// 4 bit IMA-ADPCM at SAMPLE_RATE, low nibble first, starting from a zero
+// predictor and step index
+const unsigned char lineClearSample[1000] =
+{
+    0x70, 0x77, 0x77, 0xF7, 0x8F, 0x11, 0xBB, 0x7C, 0x15, 0x11, 0x99, 0xFA,
+    0x1B, 0x01, 0xBA, 0x7B, 0x17, 0x80, 0x98, 0xF9, 0x00, 0x80, 0x89, 0x16,
+    0x00, 0x80, 0x99, 0x8F, 0x01, 0x88, 0x99, 0x17, 0x10, 0x89, 0xF9, 0x10,
+    0x80, 0x98, 0x79, 0x01, 0x80, 0x89, 0x0F, 0x01, 0x98, 0x58, 0x01, 0x00,
+    0x99, 0xF9, 0x10, 0x90, 0x98, 0x07, 0x10, 0x89, 0xE9, 0x00, 0x81, 0x89,
+    0x05, 0x01, 0x88, 0xF9, 0x18, 0x80, 0x98, 0x05, 0x01, 0x90, 0xF9, 0x00,
+    0x00, 0x99, 0x05, 0x01, 0x90, 0xF9, 0x00, 0x80, 0x98, 0x06, 0x10, 0x98,
+    0xE9, 0x10, 0x80, 0x99, 0x06, 0x01, 0x89, 0xD9, 0x10, 0x90, 0x99, 0x17,
+    0x00, 0x89, 0x0E, 0x10, 0x98, 0x69, 0x10, 0x90, 0x98, 0x1D, 0x80, 0x98,
+    0x06, 0x10, 0x89, 0xE9, 0x10, 0x88, 0x59, 0x10, 0x80, 0x99, 0x1E, 0x80,
+    0x98, 0x06, 0x10, 0x99, 0xD8, 0x10, 0x98, 0x79, 0x00, 0x80, 0xD9, 0x00,
+    0x91, 0x98, 0x07, 0x00, 0x89, 0x0D, 0x81, 0x98, 0x05, 0x01, 0x89, 0x0F,
+    0x10, 0x89, 0x69, 0x10, 0x98, 0xD8, 0x10, 0x88, 0x59, 0x10, 0x90, 0xE9,
+    0x10, 0x88, 0x59, 0x10, 0x90, 0xE9, 0x10, 0x90, 0x48, 0x10, 0x90, 0xF8,
+    0x00, 0x90, 0x48, 0x01, 0x80, 0xF9, 0x00, 0x90, 0x48, 0x11, 0x98, 0xE9,
+    0x10, 0x98, 0x68, 0x10, 0x98, 0xD8, 0x10, 0x98, 0x79, 0x00, 0x88, 0x0D,
+    0x81, 0x88, 0x04, 0x81, 0x89, 0x0E, 0x81, 0x99, 0x07, 0x80, 0xD8, 0x00,
+    0x80, 0x59, 0x00, 0x90, 0xB9, 0x10, 0x99, 0x07, 0x01, 0x99, 0x1E, 0x80,
+    0x89, 0x06, 0x80, 0xC9, 0x10, 0x88, 0x69, 0x10, 0x89, 0x0D, 0x81, 0x89,
+    0x15, 0x90, 0xE8, 0x10, 0x88, 0x59, 0x10, 0x89, 0x0D, 0x81, 0x39, 0x11,
+    0x90, 0xF9, 0x10, 0x99, 0x05, 0x81, 0x98, 0x1D, 0x90, 0x69, 0x10, 0x98,
+    0x0E, 0x81, 0x98, 0x05, 0x80, 0xB9, 0x10, 0x99, 0x16, 0x00, 0xF9, 0x00,
+    0x80, 0x59, 0x00, 0x98, 0x1C, 0x80, 0x49, 0x11, 0x99, 0x0F, 0x81, 0x28,
+    0x11, 0x90, 0xEA, 0x01, 0x99, 0x07, 0x80, 0xB9, 0x10, 0x99, 0x07, 0x91,
+    0xC9, 0x01, 0x98, 0x05, 0x81, 0xE9, 0x10, 0x98, 0x04, 0x81, 0xE9, 0x10,
+    0x98, 0x04, 0x81, 0xE9, 0x10, 0x98, 0x04, 0x91, 0xE8, 0x10, 0x98, 0x04,
+    0x91, 0xD8, 0x10, 0x99, 0x15, 0x90, 0xC9, 0x01, 0x99, 0x07, 0x80, 0xB9,
+    0x81, 0x59, 0x11, 0x99, 0x0E, 0x81, 0x49, 0x11, 0xA9, 0x1D, 0x90, 0x79,
+    0x00, 0xC9, 0x01, 0x98, 0x14, 0x80, 0xD9, 0x10, 0x99, 0x06, 0x90, 0x0C,
+    0x81, 0x49, 0x11, 0x99, 0x0D, 0x90, 0x79, 0x81, 0xB9, 0x10, 0x99, 0x16,
+    0x90, 0x0D, 0x81, 0x49, 0x10, 0x99, 0x1C, 0x98, 0x14, 0x81, 0xEA, 0x01,
+    0x99, 0x07, 0x88, 0x0B, 0x91, 0x69, 0x00, 0xC9, 0x10, 0x89, 0x05, 0x90,
+    0x1D, 0x80, 0x59, 0x00, 0xC9, 0x10, 0x89, 0x05, 0x90, 0x1D, 0x80, 0x49,
+    0x01, 0xE9, 0x01, 0x89, 0x14, 0x98, 0x0C, 0x91, 0x69, 0x81, 0xC9, 0x01,
+    0x39, 0x11, 0x99, 0x1E, 0x98, 0x14, 0x91, 0xCA, 0x81, 0x7A, 0x81, 0xD8,
+    0x10, 0x89, 0x14, 0x98, 0x1C, 0x88, 0x13, 0xA2, 0xDA, 0x81, 0x7A, 0x81,
+    0xC9, 0x01, 0x39, 0x21, 0xA9, 0x1F, 0x98, 0x05, 0x90, 0x0C, 0x91, 0x69,
+    0x91, 0xB8, 0x81, 0x59, 0x01, 0xDA, 0x01, 0x39, 0x21, 0xAA, 0x1D, 0xA8,
+    0x17, 0x98, 0x1B, 0x98, 0x15, 0x90, 0x0E, 0x91, 0x12, 0xA2, 0xD9, 0x81,
+    0x7A, 0x00, 0xB9, 0x81, 0x59, 0x81, 0xC9, 0x81, 0x59, 0x10, 0xE9, 0x01,
+    0x29, 0x11, 0xF9, 0x01, 0x89, 0x04, 0x98, 0x1A, 0x99, 0x07, 0x88, 0x1B,
+    0x98, 0x15, 0x98, 0x1C, 0x98, 0x15, 0x98, 0x1C, 0x98, 0x15, 0x98, 0x1C,
+    0x98, 0x15, 0x89, 0x1B, 0xA9, 0x17, 0x98, 0x1B, 0xA8, 0x17, 0x89, 0x0A,
+    0x39, 0x12, 0xFA, 0x00, 0x28, 0x11, 0xF9, 0x00, 0x38, 0x81, 0xD9, 0x81,
+    0x59, 0x81, 0xC9, 0x81, 0x59, 0x91, 0xA9, 0x91, 0x23, 0xA1, 0x0F, 0x90,
+    0x14, 0xA0, 0x1D, 0x98, 0x15, 0x98, 0x1B, 0x39, 0x22, 0xFB, 0x00, 0x5A,
+    0x81, 0xC9, 0x81, 0x69, 0x91, 0x1D, 0x90, 0x03, 0x90, 0x1C, 0x98, 0x15,
+    0x98, 0x1B, 0x5A, 0x01, 0xE9, 0x81, 0x59, 0x80, 0xA9, 0x91, 0x23, 0xA0,
+    0x1F, 0x98, 0x15, 0xD9, 0x01, 0x39, 0x81, 0xC9, 0x91, 0x23, 0x90, 0x0F,
+    0x90, 0x14, 0xA8, 0x1A, 0x5A, 0x01, 0xCA, 0x91, 0x23, 0xA1, 0x0F, 0x98,
+    0x16, 0xC9, 0x81, 0x38, 0x81, 0xC9, 0x91, 0x14, 0xA0, 0x1D, 0x39, 0x12,
+    0xFB, 0x81, 0x59, 0x91, 0x1C, 0x98, 0x14, 0xD8, 0x00, 0x38, 0x91, 0xB9,
+    0xA1, 0x16, 0x98, 0x1B, 0x5A, 0x82, 0xCA, 0x91, 0x14, 0xA0, 0x1D, 0x49,
+    0x01, 0xCA, 0x91, 0x14, 0xA0, 0x1D, 0x49, 0x01, 0xCA, 0x91, 0x14, 0xA0,
+    0x1D, 0x49, 0x01, 0xCA, 0x91, 0x14, 0xA0, 0x1C, 0x5A, 0x81, 0xC9, 0x91,
+    0x14, 0x98, 0x1C, 0x6A, 0x91, 0x1D, 0x90, 0x23, 0xE9, 0x81, 0x49, 0x91,
+    0x1C, 0x98, 0x05, 0xA9, 0x91, 0x13, 0xA0, 0x1C, 0x5A, 0x81, 0xB9, 0xA0,
+    0x17, 0xC9, 0x81, 0x59, 0x80, 0x1B, 0x39, 0x01, 0xDA, 0x91, 0x24, 0xF9,
+    0x81, 0x38, 0x91, 0x1D, 0x28, 0x01, 0xCA, 0x91, 0x24, 0xF9, 0x81, 0x38,
+    0x91, 0x1C, 0x39, 0x01, 0xCA, 0xA1, 0x16, 0xD9, 0x81, 0x59, 0x90, 0x1A,
+    0x39, 0x81, 0x1F, 0x88, 0x13, 0xBA, 0x91, 0x24, 0xF9, 0x81, 0x49, 0x91,
+    0x1B, 0x39, 0x82, 0x0F, 0x90, 0x04, 0xA9, 0xA1, 0x14, 0xE8, 0x81, 0x59,
+    0x90, 0x1A, 0x39, 0x91, 0x1D, 0x28, 0x01, 0xBA, 0xA0, 0x17, 0xC9, 0x91,
+    0x14, 0xD9, 0x81, 0x59, 0x90, 0x1A, 0x49, 0x91, 0x1C, 0x39, 0x81, 0x1F,
+    0x98, 0x04, 0xA9, 0x91, 0x14, 0xC9, 0x91, 0x23, 0xF9, 0x81, 0x21, 0xE8,
+    0x81, 0x38, 0x90, 0x1B, 0x59, 0x91, 0x1C, 0x39, 0x92, 0x1F, 0x28, 0x91,
+    0x1D, 0x28, 0x01, 0xBA, 0xA0, 0x17, 0xB9, 0xA1, 0x06, 0xA9, 0x91, 0x23,
+    0xDA, 0x91, 0x14, 0xD9, 0x81, 0x22, 0xE9, 0x81, 0x12, 0xD8, 0x00, 0x21,
+    0xE8, 0x81, 0x11, 0xA0, 0x0A, 0x7A, 0x90, 0x09, 0x6A, 0x90, 0x0A, 0x59,
+    0x90, 0x0A, 0x59, 0x90, 0x0A, 0x59, 0x90, 0x0A, 0x69, 0x90, 0x0A, 0x59,
+    0x90, 0x0A, 0x6A, 0x90, 0x89, 0x59, 0x90, 0x89, 0x12, 0xE8, 0x81, 0x12,
+    0xE8, 0x81, 0x12, 0xC9, 0x81, 0x22, 0xE9, 0x91, 0x13, 0xC9, 0x91, 0x14,
+    0xC9, 0x91, 0x04, 0xB9, 0xA1, 0x07, 0xA9, 0x90, 0x05, 0x1C, 0x18, 0x81,
+    0x1C, 0x39, 0xA2, 0x1C, 0x49, 0x91, 0x1C, 0x5A, 0x90, 0x0A, 0x69, 0xB8,
+    0x81, 0x22, 0xD9, 0x91, 0x23, 0xCA, 0xA1, 0x06, 0xA9, 0xA0, 0x87, 0x0A,
+    0x28, 0x81, 0x1C, 0x39, 0x91, 0x0C, 0x69, 0xC0, 0x00, 0x11, 0xC8, 0x91,
+    0x13, 0xC9, 0xA1, 0x06, 0x1C, 0x18, 0x81, 0x1C, 0x39, 0x91, 0x0B, 0x7A,
+    0xC0, 0x81, 0x02, 0xB8, 0xA1, 0x05, 0xA9, 0x20, 0x92, 0x1E, 0x39, 0x91,
+    0x0B, 0x7A, 0xC0, 0x81, 0x12, 0xB9, 0xA0, 0x87, 0x1B, 0x28, 0x92, 0x1C,
+    0x5A, 0xC0, 0x81, 0x11, 0xB8, 0x90, 0x05, 0x0C, 0x10, 0x92, 0x1C, 0x49,
+    0xC0, 0x00, 0x11, 0xA9, 0x90, 0x05, 0x1C, 0x39, 0xA1, 0x0A, 0x7A, 0xA8,
+    0x80, 0x12, 0xA9, 0x10, 0x92, 0x1D, 0x49, 0x90, 0x89, 0x12, 0xB9, 0xA1,
+    0x86, 0x1B, 0x38, 0x90, 0x0A, 0x21, 0xC9, 0x91, 0x13, 0x1D, 0x18, 0x91,
+    0x09, 0x00, 0x88, 0x00
+};
+
+const unsigned char tetrisSample[2400] =
+{
+    0x70, 0x77, 0x77, 0xF7, 0xAA, 0xCB, 0xDB, 0x7B, 0x17, 0x01, 0x21, 0xAF,
+    0x98, 0x99, 0xA9, 0x47, 0x10, 0x10, 0x21, 0xBF, 0x89, 0x99, 0x79, 0x02,
+    0x10, 0x10, 0xF0, 0x89, 0x89, 0x98, 0x78, 0x01, 0x10, 0x00, 0x8E, 0x88,
+    0x89, 0x98, 0x07, 0x01, 0x00, 0x10, 0x8F, 0x89, 0x88, 0x58, 0x00, 0x01,
+    0x00, 0xF1, 0x88, 0x89, 0x88, 0x79, 0x00, 0x01, 0x00, 0x8D, 0x88, 0x89,
+    0x98, 0x07, 0x10, 0x00, 0x00, 0x8F, 0x88, 0x88, 0x58, 0x00, 0x00, 0x10,
+    0xF0, 0x88, 0x88, 0x89, 0x05, 0x10, 0x00, 0x01, 0x8F, 0x98, 0x88, 0x98,
+    0x07, 0x10, 0x00, 0xD0, 0x88, 0x98, 0x88, 0x79, 0x00, 0x01, 0x00, 0xF0,
+    0x88, 0x88, 0x88, 0x05, 0x00, 0x00, 0x01, 0x8F, 0x88, 0x98, 0x88, 0x07,
+    0x00, 0x00, 0xC0, 0x98, 0x88, 0x89, 0x79, 0x01, 0x10, 0x00, 0xF1, 0x89,
+    0x88, 0x98, 0x06, 0x00, 0x10, 0x00, 0x8F, 0x88, 0x88, 0x98, 0x07, 0x00,
+    0x00, 0xC0, 0x98, 0x88, 0x98, 0x78, 0x01, 0x00, 0x10, 0x8E, 0x88, 0x89,
+    0x98, 0x07, 0x00, 0x01, 0x00, 0x8F, 0x88, 0x88, 0x58, 0x00, 0x00, 0x10,
+    0xF0, 0x88, 0x88, 0x98, 0x78, 0x00, 0x00, 0x00, 0x8C, 0x89, 0x88, 0x89,
+    0x07, 0x01, 0x00, 0x10, 0x9F, 0x88, 0x88, 0x58, 0x00, 0x01, 0x10, 0xF0,
+    0x98, 0x88, 0x88, 0x79, 0x01, 0x00, 0x00, 0x8D, 0x98, 0x88, 0x89, 0x07,
+    0x01, 0x00, 0x10, 0x9F, 0x90, 0x88, 0x58, 0x00, 0x01, 0x00, 0xF1, 0x98,
+    0x88, 0x88, 0x78, 0x00, 0x00, 0x00, 0x8D, 0x88, 0x88, 0x89, 0x07, 0x00,
+    0x10, 0xD0, 0x88, 0x89, 0x88, 0x79, 0x00, 0x10, 0x00, 0xF0, 0x88, 0x88,
+    0x88, 0x05, 0x00, 0x00, 0x01, 0x8F, 0x88, 0x88, 0x89, 0x07, 0x00, 0x00,
+    0xC0, 0x98, 0x88, 0x89, 0x78, 0x10, 0x00, 0x10, 0xF0, 0x89, 0x88, 0x88,
+    0x05, 0x01, 0x00, 0x01, 0x9F, 0x88, 0x88, 0x98, 0x17, 0x00, 0x00, 0xD0,
+    0x88, 0x89, 0x88, 0x79, 0x00, 0x01, 0x00, 0xF0, 0x88, 0x88, 0x88, 0x05,
+    0x00, 0x00, 0x01, 0x8F, 0x88, 0x88, 0x59, 0x00, 0x10, 0x00, 0xF1, 0x88,
+    0x98, 0x88, 0x78, 0x00, 0x00, 0x00, 0x8D, 0x88, 0x88, 0x98, 0x07, 0x00,
+    0x00, 0x10, 0x8F, 0x88, 0x88, 0x48, 0x10, 0x00, 0x10, 0xF0, 0x88, 0x89,
+    0x88, 0x78, 0x00, 0x00, 0x00, 0x8D, 0x88, 0x88, 0x89, 0x07, 0x00, 0x00,
+    0x10, 0x8F, 0x88, 0x88, 0x58, 0x00, 0x00, 0x00, 0xE0, 0x88, 0x88, 0x98,
+    0x78, 0x00, 0x00, 0x00, 0x8C, 0x89, 0x88, 0x89, 0x17, 0x00, 0x00, 0xD0,
+    0x88, 0x89, 0x98, 0x78, 0x00, 0x01, 0x00, 0xF0, 0x88, 0x88, 0x88, 0x05,
+    0x00, 0x00, 0x10, 0x8F, 0x88, 0x88, 0x88, 0x06, 0x00, 0x00, 0xD0, 0x88,
+    0x88, 0x88, 0x68, 0x00, 0x00, 0x00, 0xE0, 0x88, 0x88, 0x88, 0x05, 0x00,
+    0x00, 0x00, 0x8E, 0x88, 0x88, 0x88, 0x06, 0x00, 0x08, 0xB0, 0x88, 0x88,
+    0x88, 0x58, 0x80, 0x80, 0x38, 0x9D, 0xCB, 0xBD, 0x57, 0x21, 0x31, 0xCF,
+    0x99, 0xA9, 0x27, 0x11, 0x12, 0xAF, 0x99, 0x99, 0x27, 0x10, 0x11, 0x9F,
+    0x98, 0x98, 0x06, 0x01, 0x10, 0x9D, 0x88, 0x99, 0x78, 0x01, 0x01, 0xE0,
+    0x88, 0x89, 0x68, 0x00, 0x00, 0xD0, 0x88, 0x88, 0x69, 0x00, 0x00, 0xD1,
+    0x88, 0x89, 0x58, 0x00, 0x01, 0xD0, 0x98, 0x88, 0x69, 0x00, 0x01, 0xD0,
+    0x88, 0x89, 0x69, 0x00, 0x01, 0xD0, 0x88, 0x98, 0x58, 0x00, 0x01, 0xE1,
+    0x88, 0x98, 0x98, 0x07, 0x01, 0x00, 0x8D, 0x89, 0x88, 0x06, 0x00, 0x00,
+    0x8D, 0x88, 0x98, 0x06, 0x00, 0x10, 0x8D, 0x98, 0x88, 0x05, 0x10, 0x00,
+    0x8D, 0x89, 0x98, 0x06, 0x10, 0x00, 0x8D, 0x98, 0x98, 0x06, 0x10, 0x00,
+    0x8D, 0x88, 0x89, 0x05, 0x10, 0x10, 0x8E, 0x88, 0x89, 0x79, 0x10, 0x00,
+    0xD0, 0x98, 0x88, 0x68, 0x00, 0x00, 0xD0, 0x88, 0x88, 0x69, 0x00, 0x00,
+    0xD1, 0x88, 0x89, 0x58, 0x00, 0x01, 0xD0, 0x98, 0x88, 0x69, 0x00, 0x01,
+    0xD0, 0x88, 0x89, 0x69, 0x00, 0x01, 0xD0, 0x88, 0x98, 0x58, 0x00, 0x01,
+    0xE1, 0x88, 0x98, 0x48, 0x01, 0x01, 0x11, 0xAF, 0x88, 0x89, 0x07, 0x00,
+    0x10, 0x8D, 0x98, 0x88, 0x05, 0x10, 0x00, 0x8D, 0x89, 0x98, 0x06, 0x01,
+    0x00, 0x8D, 0x98, 0x98, 0x06, 0x10, 0x00, 0x8D, 0x88, 0x89, 0x05, 0x01,
+    0x10, 0x8E, 0x98, 0x88, 0x05, 0x10, 0x00, 0x8D, 0x89, 0x98, 0x06, 0x10,
+    0x00, 0xF1, 0x98, 0x88, 0x58, 0x10, 0x00, 0xE0, 0x88, 0x88, 0x69, 0x00,
+    0x00, 0xC0, 0x98, 0x88, 0x69, 0x00, 0x01, 0xD0, 0x88, 0x98, 0x58, 0x10,
+    0x00, 0xE1, 0x88, 0x89, 0x58, 0x00, 0x01, 0xD0, 0x98, 0x88, 0x69, 0x00,
+    0x01, 0xD0, 0x88, 0x89, 0x58, 0x10, 0x00, 0x11, 0x9F, 0x98, 0x88, 0x06,
+    0x00, 0x01, 0x8E, 0x88, 0x88, 0x14, 0x00, 0x10, 0x8E, 0x89, 0x88, 0x05,
+    0x10, 0x10, 0x8E, 0x98, 0x88, 0x05, 0x00, 0x01, 0x8D, 0x89, 0x98, 0x06,
+    0x10, 0x00, 0x8D, 0x88, 0x89, 0x05, 0x10, 0x10, 0x8E, 0x88, 0x89, 0x14,
+    0x10, 0x10, 0x8E, 0x89, 0x89, 0x79, 0x01, 0x00, 0xE1, 0x88, 0x98, 0x58,
+    0x10, 0x00, 0xD0, 0x88, 0x89, 0x58, 0x10, 0x00, 0xE1, 0x98, 0x88, 0x58,
+    0x00, 0x01, 0xD0, 0x98, 0x88, 0x69, 0x00, 0x01, 0xD0, 0x88, 0x98, 0x58,
+    0x00, 0x01, 0xE1, 0x88, 0x98, 0x48, 0x01, 0x10, 0xE1, 0x98, 0x88, 0x99,
+    0x17, 0x00, 0x10, 0x8E, 0x88, 0x98, 0x05, 0x00, 0x01, 0x8D, 0x88, 0x89,
+    0x05, 0x10, 0x00, 0x8D, 0x98, 0x88, 0x05, 0x10, 0x10, 0x8E, 0x98, 0x88,
+    0x05, 0x00, 0x01, 0x8D, 0x98, 0x88, 0x05, 0x00, 0x01, 0x8D, 0x98, 0x88,
+    0x05, 0x10, 0x00, 0x8D, 0x98, 0x88, 0x79, 0x10, 0x00, 0xD0, 0x88, 0x98,
+    0x58, 0x00, 0x10, 0xD0, 0x88, 0x88, 0x48, 0x00, 0x10, 0xD0, 0x88, 0x98,
+    0x58, 0x00, 0x80, 0xB0, 0x88, 0x08, 0x38, 0x80, 0x48, 0xF4, 0xAA, 0xDA,
+    0x37, 0x21, 0xF2, 0xAB, 0xA9, 0x37, 0x11, 0xF2, 0x9A, 0x99, 0x17, 0x10,
+    0xE1, 0x98, 0x98, 0x05, 0x11, 0xD0, 0x98, 0x89, 0x05, 0x01, 0x11, 0x9F,
+    0x88, 0x69, 0x00, 0x10, 0x8D, 0x98, 0x48, 0x01, 0x10, 0x8D, 0x89, 0x59,
+    0x10, 0x10, 0x8D, 0x89, 0x59, 0x10, 0x00, 0x8C, 0x89, 0x99, 0x17, 0x00,
+    0xD1, 0x98, 0x88, 0x05, 0x00, 0xD1, 0x88, 0x89, 0x05, 0x00, 0xD1, 0x88,
+    0x98, 0x14, 0x00, 0xD1, 0x98, 0x98, 0x05, 0x01, 0xD1, 0x88, 0x89, 0x79,
+    0x00, 0x10, 0x8D, 0x88, 0x59, 0x00, 0x00, 0x8C, 0x88, 0x59, 0x00, 0x01,
+    0x9C, 0x88, 0x59, 0x10, 0x10, 0x8D, 0x89, 0x59, 0x10, 0x10, 0x8D, 0x89,
+    0x89, 0x07, 0x10, 0xD0, 0x88, 0x98, 0x05, 0x00, 0xD1, 0x88, 0x88, 0x13,
+    0x01, 0xF1, 0x88, 0x98, 0x04, 0x01, 0xD1, 0x98, 0x88, 0x04, 0x11, 0xD0,
+    0x98, 0x89, 0x79, 0x01, 0x10, 0x8E, 0x88, 0x48, 0x00, 0x01, 0x8D, 0x98,
+    0x48, 0x01, 0x01, 0x8D, 0x89, 0x59, 0x10, 0x10, 0x8D, 0x89, 0x59, 0x10,
+    0x00, 0x8C, 0x89, 0x99, 0x17, 0x00, 0xD1, 0x98, 0x98, 0x06, 0x00, 0xB0,
+    0x89, 0x99, 0x07, 0x00, 0xC1, 0x98, 0x98, 0x05, 0x01, 0xC0, 0x98, 0x98,
+    0x05, 0x01, 0xD1, 0x98, 0x98, 0x79, 0x01, 0x10, 0x8D, 0x89, 0x48, 0x01,
+    0x10, 0x8E, 0x88, 0x49, 0x01, 0x10, 0x8D, 0x89, 0x59, 0x10, 0x10, 0x8D,
+    0x98, 0x48, 0x10, 0x10, 0xF1, 0x89, 0x98, 0x05, 0x01, 0xD0, 0x88, 0x98,
+    0x05, 0x10, 0xC0, 0x89, 0x98, 0x05, 0x01, 0xD1, 0x98, 0x98, 0x05, 0x01,
+    0xC0, 0x98, 0x98, 0x05, 0x01, 0x11, 0x9F, 0x88, 0x69, 0x00, 0x00, 0x8C,
+    0x88, 0x59, 0x00, 0x01, 0x8D, 0x88, 0x59, 0x00, 0x10, 0x9C, 0x88, 0x59,
+    0x00, 0x01, 0x8C, 0x89, 0x59, 0x10, 0x10, 0xF1, 0x89, 0x88, 0x14, 0x00,
+    0xE1, 0x88, 0x89, 0x05, 0x00, 0xD1, 0x88, 0x98, 0x14, 0x00, 0xD1, 0x88,
+    0x89, 0x04, 0x01, 0xD1, 0x98, 0x98, 0x05, 0x01, 0x01, 0x8F, 0x98, 0x58,
+    0x00, 0x10, 0x8D, 0x88, 0x59, 0x00, 0x00, 0x9B, 0x98, 0x69, 0x10, 0x10,
+    0x8D, 0x89, 0x48, 0x10, 0x01, 0x8D, 0x89, 0x59, 0x10, 0x10, 0xF0, 0x88,
+    0x89, 0x05, 0x00, 0xD1, 0x88, 0x98, 0x14, 0x00, 0xD1, 0x98, 0x88, 0x04,
+    0x01, 0xD1, 0x98, 0x98, 0x05, 0x01, 0xD1, 0x98, 0x98, 0x78, 0x00, 0x10,
+    0x8D, 0x88, 0x48, 0x00, 0x10, 0x8D, 0x98, 0x48, 0x01, 0x10, 0x8D, 0x89,
+    0x59, 0x10, 0x00, 0x8C, 0x89, 0x59, 0x10, 0x10, 0x8D, 0x98, 0x98, 0x07,
+    0x00, 0xD1, 0x88, 0x88, 0x04, 0x00, 0xD1, 0x88, 0x98, 0x14, 0x00, 0xD1,
+    0x98, 0x88, 0x04, 0x01, 0xD1, 0x98, 0x88, 0x04, 0x10, 0xD1, 0x98, 0x98,
+    0x78, 0x00, 0x00, 0x8C, 0x88, 0x48, 0x00, 0x01, 0x8D, 0x88, 0x38, 0x01,
+    0x10, 0x8D, 0x89, 0x48, 0x00, 0x01, 0x8C, 0x98, 0x48, 0x00, 0x08, 0x89,
+    0xA8, 0x7D, 0x22, 0xAE, 0xBA, 0x37, 0x32, 0xBF, 0xA9, 0x27, 0x11, 0x9F,
+    0x28, 0x11, 0xE2, 0x99, 0x69, 0x10, 0xD1, 0x89, 0x69, 0x10, 0xD0, 0x98,
+    0x13, 0x10, 0x9C, 0x99, 0x06, 0x11, 0x8D, 0x99, 0x15, 0x00, 0x8D, 0x39,
+    0x11, 0xD1, 0x89, 0x59, 0x10, 0xD1, 0x89, 0x59, 0x01, 0x8B, 0x99, 0x05,
+    0x11, 0x8D, 0x99, 0x05, 0x01, 0x9C, 0x98, 0x06, 0xB1, 0x89, 0x49, 0x11,
+    0xE1, 0x98, 0x59, 0x10, 0xD1, 0x89, 0x03, 0x11, 0x8D, 0x99, 0x05, 0x11,
+    0x8D, 0x89, 0x04, 0x11, 0x8E, 0x39, 0x01, 0xC1, 0x99, 0x69, 0x10, 0xD1,
+    0x98, 0x48, 0x01, 0x8B, 0x99, 0x14, 0x11, 0x8E, 0x99, 0x15, 0x10, 0x8D,
+    0x89, 0x14, 0xB0, 0x98, 0x59, 0x10, 0xD1, 0x89, 0x59, 0x01, 0xD1, 0x89,
+    0x48, 0x01, 0x9B, 0x98, 0x15, 0x10, 0x9D, 0x98, 0x15, 0x10, 0x9D, 0x28,
+    0x11, 0xD1, 0x98, 0x59, 0x10, 0xC0, 0x89, 0x69, 0x10, 0xD0, 0x98, 0x13,
+    0x10, 0x9C, 0x99, 0x06, 0x01, 0x9C, 0x98, 0x06, 0xB1, 0x98, 0x49, 0x11,
+    0xE1, 0x98, 0x48, 0x10, 0xD1, 0x89, 0x59, 0x01, 0x8B, 0x99, 0x05, 0x11,
+    0x8D, 0x89, 0x14, 0x10, 0x8E, 0x28, 0x10, 0xC1, 0x99, 0x69, 0x10, 0xC0,
+    0x98, 0x59, 0x01, 0xD1, 0x89, 0x03, 0x01, 0x8C, 0x99, 0x15, 0x10, 0x9D,
+    0x98, 0x15, 0xA0, 0x99, 0x59, 0x10, 0xD1, 0x98, 0x59, 0x10, 0xC0, 0x98,
+    0x69, 0x10, 0x8B, 0x99, 0x14, 0x01, 0x8D, 0x99, 0x15, 0x10, 0x8D, 0x99,
+    0x06, 0xA0, 0x89, 0x49, 0x11, 0xD0, 0x98, 0x59, 0x01, 0xD1, 0x89, 0x03,
+    0x11, 0x8D, 0x99, 0x05, 0x01, 0x9C, 0x98, 0x06, 0x10, 0x9C, 0x28, 0x11,
+    0xD1, 0x98, 0x59, 0x10, 0xC0, 0x89, 0x69, 0x00, 0x8A, 0x99, 0x14, 0x11,
+    0x9D, 0x98, 0x05, 0x01, 0x9C, 0x98, 0x06, 0xA0, 0x98, 0x49, 0x11, 0xD0,
+    0x98, 0x59, 0x01, 0xD1, 0x98, 0x12, 0x11, 0x8D, 0x99, 0x05, 0x01, 0x8C,
+    0x99, 0x15, 0x10, 0x9D, 0x38, 0x10, 0xD1, 0x98, 0x59, 0x10, 0xC0, 0x98,
+    0x69, 0x00, 0xD1, 0x88, 0x12, 0x10, 0x9C, 0x98, 0x05, 0x11, 0x9D, 0x98,
+    0x05, 0xB1, 0x98, 0x59, 0x10, 0xD1, 0x98, 0x48, 0x10, 0xD1, 0x89, 0x59,
+    0x01, 0x8B, 0x99, 0x05, 0x11, 0x8D, 0x89, 0x14, 0x10, 0x8E, 0x28, 0x10,
+    0xB0, 0x99, 0x7A, 0x10, 0xC0, 0x98, 0x69, 0x00, 0xC1, 0x89, 0x12, 0x11,
+    0x8D, 0x99, 0x05, 0x01, 0x8C, 0x99, 0x15, 0xA0, 0x99, 0x59, 0x10, 0xD1,
+    0x98, 0x48, 0x01, 0xD1, 0x89, 0x59, 0x01, 0x8B, 0x99, 0x05, 0x11, 0x8D,
+    0x99, 0x05, 0x01, 0x8C, 0x99, 0x06, 0xA0, 0x98, 0x48, 0x10, 0xC0, 0x99,
+    0x58, 0x01, 0xE1, 0x88, 0x02, 0x11, 0x9C, 0x89, 0x05, 0x11, 0x9D, 0x98,
+    0x05, 0x01, 0x9C, 0x38, 0x10, 0xD1, 0x98, 0x59, 0x10, 0xD1, 0x89, 0x59,
+    0x01, 0x9A, 0x99, 0x05, 0x11, 0x8D, 0x89, 0x04, 0x11, 0x9D, 0x98, 0x15,
+    0xB0, 0x98, 0x59, 0x10, 0xD1, 0x98, 0x48, 0x01, 0xE1, 0x88, 0x02, 0x01,
+    0x9B, 0xA9, 0x07, 0x01, 0x8C, 0x99, 0x06, 0x10, 0x9C, 0x28, 0x11, 0xD1,
+    0x98, 0x59, 0x10, 0xC0, 0x98, 0x59, 0x01, 0xD1, 0x89, 0x03, 0x11, 0x8D,
+    0x99, 0x05, 0x01, 0x9C, 0x98, 0x06, 0xA0, 0x98, 0x38, 0x11, 0xF2, 0x98,
+    0x48, 0x10, 0xE1, 0x88, 0x49, 0x01, 0x8B, 0x89, 0x14, 0x10, 0x9D, 0x98,
+    0x15, 0x10, 0x9D, 0x28, 0x11, 0xD1, 0x98, 0x59, 0x10, 0xC0, 0x89, 0x69,
+    0x00, 0xC1, 0x89, 0x12, 0x11, 0x8D, 0x99, 0x05, 0x01, 0x9C, 0x98, 0x06,
+    0xA0, 0x98, 0x38, 0x11, 0xF2, 0x98, 0x48, 0x10, 0xE1, 0x88, 0x49, 0x01,
+    0x9A, 0x99, 0x05, 0x11, 0x8D, 0x89, 0x14, 0x10, 0x8E, 0x98, 0x14, 0xB0,
+    0x98, 0x59, 0x01, 0xD1, 0x98, 0x48, 0x01, 0xE1, 0x88, 0x02, 0x01, 0x9B,
+    0xA9, 0x07, 0x01, 0x8C, 0x99, 0x06, 0x10, 0x9C, 0x38, 0x10, 0xC0, 0x89,
+    0x59, 0x01, 0xD1, 0x89, 0x59, 0x01, 0x9A, 0x99, 0x05, 0x11, 0x8D, 0x89,
+    0x14, 0x10, 0x8E, 0x98, 0x14, 0xA0, 0x99, 0x59, 0x10, 0xD1, 0x98, 0x48,
+    0x01, 0xE1, 0x88, 0x02, 0x11, 0x9C, 0x89, 0x14, 0x11, 0x8E, 0x99, 0x05,
+    0x01, 0x9C, 0x38, 0x10, 0xD1, 0x98, 0x59, 0x01, 0xD1, 0x89, 0x59, 0x01,
+    0xC0, 0x89, 0x13, 0x10, 0x8D, 0x99, 0x15, 0x10, 0x9D, 0x98, 0x15, 0xB0,
+    0x98, 0x59, 0x10, 0xD1, 0x98, 0x48, 0x01, 0xE1, 0x88, 0x49, 0x01, 0x9A,
+    0x99, 0x05, 0x11, 0x8D, 0x89, 0x14, 0x10, 0x8E, 0x28, 0x10, 0xB0, 0x99,
+    0x69, 0x10, 0xD1, 0x89, 0x59, 0x01, 0xD1, 0x89, 0x03, 0x01, 0x9C, 0x98,
+    0x15, 0x10, 0x9D, 0x98, 0x15, 0xA0, 0x99, 0x59, 0x10, 0xD1, 0x98, 0x48,
+    0x01, 0xE1, 0x88, 0x49, 0x01, 0x9A, 0x99, 0x05, 0x11, 0x8D, 0x89, 0x14,
+    0x10, 0x8E, 0x98, 0x05, 0xA0, 0x98, 0x49, 0x01, 0xD1, 0x98, 0x48, 0x01,
+    0xD1, 0x89, 0x03, 0x11, 0x8D, 0x99, 0x05, 0x11, 0x9D, 0x98, 0x05, 0x01,
+    0x9C, 0x38, 0x01, 0xD1, 0x98, 0x59, 0x01, 0xD1, 0x89, 0x59, 0x01, 0x9A,
+    0x89, 0x04, 0x11, 0x9D, 0x98, 0x15, 0x10, 0x9D, 0x98, 0x15, 0xB0, 0x98,
+    0x48, 0x10, 0xD1, 0x89, 0x59, 0x01, 0xD1, 0x89, 0x12, 0x11, 0x8D, 0x99,
+    0x05, 0x01, 0x8C, 0x99, 0x15, 0x10, 0x9D, 0x38, 0x10, 0xD1, 0x98, 0x59,
+    0x10, 0xC0, 0x89, 0x69, 0x00, 0xD1, 0x88, 0x02, 0x11, 0x9C, 0x98, 0x05,
+    0x01, 0x9C, 0x98, 0x06, 0xA0, 0x98, 0x49, 0x01, 0xC1, 0x99, 0x69, 0x10,
+    0xD1, 0x98, 0x48, 0x01, 0x8B, 0x99, 0x05, 0x11, 0x9D, 0x98, 0x05, 0x11,
+    0x8D, 0x29, 0x11, 0xC0, 0x98, 0x59, 0x01, 0xD1, 0x89, 0x59, 0x01, 0xC0,
+    0x89, 0x03, 0x11, 0x8D, 0x99, 0x15, 0x10, 0x9D, 0x98, 0x15, 0xA0, 0x99,
+    0x59, 0x10, 0xD1, 0x98, 0x48, 0x10, 0xD1, 0x89, 0x59, 0x01, 0x8B, 0x99,
+    0x05, 0x11, 0x8D, 0x89, 0x14, 0x10, 0x8E, 0x28, 0x10, 0xB0, 0x99, 0x7A,
+    0x10, 0xC0, 0x98, 0x59, 0x01, 0xD1, 0x98, 0x03, 0x01, 0x8C, 0x99, 0x15,
+    0x10, 0x9D, 0x98, 0x15, 0x10, 0x9D, 0x38, 0x10, 0xC0, 0x89, 0x59, 0x01,
+    0xD1, 0x89, 0x59, 0x01, 0x9A, 0x99, 0x05, 0x11, 0x8D, 0x89, 0x14, 0x10,
+    0x8E, 0x98, 0x14, 0xA0, 0x99, 0x59, 0x10, 0xD1, 0x98, 0x48, 0x01, 0xE1,
+    0x88, 0x02, 0x01, 0x9B, 0x99, 0x06, 0x11, 0x9D, 0x98, 0x15, 0x10, 0x9D,
+    0x28, 0x11, 0xC0, 0x98, 0x59, 0x01, 0xD1, 0x89, 0x59, 0x01, 0x9A, 0x99,
+    0x05, 0x11, 0x8D, 0x89, 0x04, 0x11, 0x9D, 0x98, 0x15, 0xB0, 0x98, 0x59,
+    0x10, 0xD1, 0x98, 0x48, 0x01, 0xE1, 0x88, 0x49, 0x01, 0x9A, 0x99, 0x05,
+    0x11, 0x8D, 0x89, 0x14, 0x10, 0x8E, 0x28, 0x10, 0xB0, 0x99, 0x69, 0x10,
+    0xD1, 0x89, 0x59, 0x01, 0xC0, 0x89, 0x03, 0x11, 0x8D, 0x99, 0x15, 0x10,
+    0x9D, 0x98, 0x15, 0xA0, 0x99, 0x59, 0x10, 0xD1, 0x98, 0x48, 0x10, 0xD1,
+    0x89, 0x59, 0x01, 0x8B, 0x99, 0x05, 0x11, 0x8D, 0x89, 0x04, 0x11, 0x9D,
+    0x28, 0x11, 0xD1, 0x98, 0x59, 0x10, 0xC0, 0x89, 0x59, 0x01, 0xD1, 0x89,
+    0x03, 0x11, 0x8D, 0x99, 0x05, 0x01, 0x8C, 0x99, 0x15, 0x10, 0x9D, 0x38,
+    0x10, 0xD1, 0x98, 0x59, 0x10, 0xC0, 0x89, 0x69, 0x00, 0x8A, 0x89, 0x13,
+    0x11, 0x8E, 0x99, 0x15, 0x10, 0x8D, 0x89, 0x14, 0xB0, 0x98, 0x59, 0x10,
+    0xD1, 0x89, 0x59, 0x01, 0xC0, 0x89, 0x03, 0x11, 0x8D, 0x99, 0x05, 0x11,
+    0x8D, 0x99, 0x15, 0x00, 0x9C, 0x38, 0x10, 0xD1, 0x98, 0x59, 0x01, 0xD1,
+    0x89, 0x59, 0x01, 0x9A, 0x89, 0x04, 0x11, 0x9D, 0x98, 0x05, 0x11, 0x9D,
+    0x88, 0x14, 0xB0, 0x98, 0x59, 0x10, 0xD1, 0x98, 0x59, 0x10, 0xD1, 0x89,
+    0x48, 0x01, 0x8B, 0x99, 0x05, 0x11, 0x9D, 0x98, 0x15, 0x00, 0x9C, 0x38,
+    0x10, 0xD1, 0x98, 0x59, 0x10, 0xD1, 0x98, 0x59, 0x01, 0xC0, 0x89, 0x03,
+    0x11, 0x8D, 0x99, 0x05, 0x11, 0x8D, 0x89, 0x14, 0xB0, 0x98, 0x59, 0x10,
+    0xD1, 0x98, 0x59, 0x10, 0xC0, 0x89, 0x69, 0x00, 0x8A, 0x89, 0x13, 0x21,
+    0x8F, 0x89, 0x04, 0x01, 0x9C, 0x28, 0x11, 0xD1, 0x98, 0x59, 0x10, 0xD1,
+    0x98, 0x59, 0x10, 0xC0, 0x89, 0x03, 0x11, 0x8D, 0x99, 0x15, 0x10, 0x8D,
+    0x89, 0x14, 0x10, 0x8E, 0x28, 0x10, 0xC0, 0x98, 0x48, 0x01, 0xD1, 0x89,
+    0x59, 0x01, 0x9A, 0x99, 0x05, 0x11, 0x8D, 0x89, 0x04, 0x11, 0x9D, 0x88,
+    0x14, 0xB0, 0x98, 0x59, 0x10, 0xD1, 0x98, 0x59, 0x10, 0xC0, 0x89, 0x03,
+    0x11, 0x8D, 0x89, 0x04, 0x11, 0x9D, 0x98, 0x05, 0x01, 0x9C, 0x38, 0x10,
+    0xD1, 0x98, 0x48, 0x10, 0xD1, 0x89, 0x59, 0x10, 0x9A, 0x89, 0x04, 0x01,
+    0x8C, 0x99, 0x15, 0x10, 0x8D, 0x89, 0x04, 0xB1, 0x98, 0x38, 0x11, 0xE1,
+    0x98, 0x48, 0x10, 0xC0, 0x98, 0x48, 0x01, 0x8B, 0x88, 0x12, 0x00, 0x0B
+};
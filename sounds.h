@@ -2,5 +2,7 @@
 #define __SOUNDS_H__
 
 extern const unsigned short fireEffect[120];
+extern const unsigned char lineClearSample[1000];
+extern const unsigned char tetrisSample[2400];
 
 #endif
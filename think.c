@@ -0,0 +1,268 @@
+#include <string.h>
+#include "game.h"
+#include "place.h"
+#include "eval.h"
+#include "sched.h"
+#include "think.h"
+
+// The search moves through phases, each done in steps small enough to stop
+// between: the placement search, scoring one placement, and at depth two
+// playing one placement and searching the next piece, then scoring one of
+// its placements. A slice runs steps until its cycles are spent. PlaceFind
+// and EvalPrepare each keep one board, so nothing else may search or score
+// while a search is running, and the commit searches again from the start
+// pose for PlacePath.
+
+#define PHASE_IDLE   0
+#define PHASE_FIND   1 // Search the piece in play
+#define PHASE_SCORE  2 // Score its placements
+#define PHASE_EXPAND 3 // Play the next one in order and search the piece after
+#define PHASE_CHILD  4 // Score that piece's placements
+#define PHASE_DONE   5
+
+#define LOST (-0x7FFFFFFFL) // A placement that tops out
+
+tThinkStats thinkStats;
+unsigned long thinkSlice = THINK_SLICE;
+
+static struct
+{
+    tGame board;  // As the search started
+    tGame after;  // Board left by the placement being expanded
+    tPlacement placements[THINK_PLACEMENTS];
+    tPlacement children[THINK_PLACEMENTS];
+    long scores[THINK_PLACEMENTS];         // Depth one
+    unsigned char order[THINK_PLACEMENTS]; // Placements by depth one score, best first
+    int count;
+    int childCount;
+    int next;      // Placement, or place in order, of the next step
+    int child;     // Next child to score
+    long value;    // Best child score so far
+    int phase;
+    int depth;     // Depths completed
+    int best;      // Best placement so far, -1 before depth one
+    long bestScore;
+    int deepBest;  // Best placement at depth two so far
+    long deepScore;
+    unsigned long cycles; // Spent up to depth one
+} arena;
+
+// Counts a search that has ended by the depth it reached
+static void End(void)
+{
+    if(arena.phase != PHASE_IDLE)
+    {
+        thinkStats.depths[arena.depth]++;
+        arena.phase = PHASE_IDLE;
+    }
+}
+
+// Starts searching the piece in play, ending any search still running
+void ThinkStart(tGame *game)
+{
+    End();
+    arena.board = *game;
+    arena.phase = PHASE_FIND;
+    arena.depth = 0;
+    arena.best = -1;
+    arena.deepBest = -1;
+    arena.cycles = 0;
+    thinkStats.searches++;
+}
+
+static void Find(void)
+{
+    tGame *board = &arena.board;
+    arena.count = PlaceFind(board, board->shape, board->orientation, board->locationX, board->locationY,
+                            arena.placements, THINK_PLACEMENTS);
+    if(arena.count > THINK_PLACEMENTS)
+    {
+        arena.count = THINK_PLACEMENTS;
+    }
+    EvalPrepare(board);
+    arena.next = 0;
+    arena.phase = arena.count ? PHASE_SCORE : PHASE_DONE; // Nowhere to go, gravity decides
+}
+
+static void Score(void)
+{
+    long score = EvalPlacement(arena.board.shape, &arena.placements[arena.next]);
+    arena.scores[arena.next] = score;
+    if(arena.best < 0 || score > arena.bestScore)
+    {
+        arena.best = arena.next;
+        arena.bestScore = score;
+    }
+
+    if(++arena.next < arena.count)
+    {
+        return;
+    }
+
+    // Expand the most promising placements first
+    int i, j;
+    for(i = 0; i < arena.count; i++)
+    {
+        for(j = i; j > 0 && arena.scores[arena.order[j - 1]] < arena.scores[i]; j--)
+        {
+            arena.order[j] = arena.order[j - 1];
+        }
+        arena.order[j] = i;
+    }
+
+    arena.depth = 1;
+    arena.next = 0;
+    arena.phase = PHASE_EXPAND;
+}
+
+// Plays the next placement in order on a copy of the board, deals the next
+// piece and searches it
+static void Expand(void)
+{
+    const tPlacement *placement = &arena.placements[arena.order[arena.next]];
+    tGame *after = &arena.after;
+    *after = arena.board;
+    after->orientation = placement->orientation;
+    after->locationX = placement->x;
+    after->locationY = placement->y;
+    after->buttons = 0;
+    GameStep(after, INPUT_D); // Locks where it rests
+    GameStep(after, 0);       // Deals the next piece
+
+    arena.childCount = 0;
+    if(!after->gameover)
+    {
+        arena.childCount = PlaceFind(after, after->shape, after->orientation, after->locationX, after->locationY,
+                                     arena.children, THINK_PLACEMENTS);
+        if(arena.childCount > THINK_PLACEMENTS)
+        {
+            arena.childCount = THINK_PLACEMENTS;
+        }
+        EvalPrepare(after);
+    }
+
+    arena.child = 0;
+    arena.value = LOST;
+    arena.phase = PHASE_CHILD;
+}
+
+// Placements expanded so far are compared with each other only, the first
+// being the best at depth one
+static void Expanded(void)
+{
+    int placement = arena.order[arena.next];
+    if(arena.deepBest < 0 || arena.value > arena.deepScore)
+    {
+        arena.deepBest = placement;
+        arena.deepScore = arena.value;
+    }
+    arena.best = arena.deepBest;
+    thinkStats.expanded++;
+
+    if(++arena.next < arena.count)
+    {
+        arena.phase = PHASE_EXPAND;
+        return;
+    }
+    arena.depth = 2;
+    arena.phase = PHASE_DONE;
+}
+
+static void Child(void)
+{
+    if(arena.child < arena.childCount)
+    {
+        long score = EvalPlacement(arena.after.shape, &arena.children[arena.child]);
+        if(score > arena.value)
+        {
+            arena.value = score;
+        }
+        arena.child++;
+    }
+
+    if(arena.child == arena.childCount)
+    {
+        Expanded();
+    }
+}
+
+// Runs search steps for up to budget cycles, at least one. Returns 1 while
+// the search has more to do.
+int ThinkSlice(unsigned long budget)
+{
+    if(!ThinkPending())
+    {
+        return 0;
+    }
+
+    // A slice stops at the end of depth one so its cost can be told apart
+    int shallow = arena.depth == 0;
+    unsigned long start = SchedTimestamp();
+    unsigned long cycles;
+    do
+    {
+        switch(arena.phase)
+        {
+        case PHASE_FIND:
+            Find();
+            break;
+        case PHASE_SCORE:
+            Score();
+            break;
+        case PHASE_EXPAND:
+            Expand();
+            break;
+        case PHASE_CHILD:
+            Child();
+            break;
+        }
+        cycles = SchedElapsed(start, SchedTimestamp());
+    } while(ThinkPending() && cycles < budget && (!shallow || !arena.depth));
+
+    if(shallow)
+    {
+        arena.cycles += cycles;
+    }
+    thinkStats.slices++;
+    if(cycles > thinkStats.sliceWcet)
+    {
+        thinkStats.sliceWcet = cycles;
+    }
+
+    return ThinkPending();
+}
+
+int ThinkPending(void)
+{
+    return arena.phase != PHASE_IDLE && arena.phase != PHASE_DONE;
+}
+
+// Depths completed by the running search
+int ThinkDepth(void)
+{
+    return arena.phase == PHASE_IDLE ? 0 : arena.depth;
+}
+
+// Cycles the search took to finish depth one
+unsigned long ThinkCost(void)
+{
+    return arena.cycles;
+}
+
+// Ends the search and writes the path to the best placement so far.
+// Returns its length, or -1 if the piece had nowhere to go.
+int ThinkCommit(unsigned char *moves, int max)
+{
+    int best = arena.best;
+    tGame *board = &arena.board;
+    End();
+    if(best < 0)
+    {
+        return -1;
+    }
+
+    // The same search again leaves the paths PlacePath reads
+    PlaceFind(board, board->shape, board->orientation, board->locationX, board->locationY,
+              arena.placements, THINK_PLACEMENTS);
+    return PlacePath(&arena.placements[best], moves, max);
+}
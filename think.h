@@ -0,0 +1,36 @@
+#ifndef __THINK_H__
+#define __THINK_H__
+
+#include "game.h"
+
+// Anytime placement search for the computer player, run a slice at a time
+// in whatever main loop time the tasks leave. Depth one scores every
+// placement of the piece in play; depth two then plays each of them, best
+// first, and scores the next piece's placements on the board it leaves. The
+// best placement so far is always ready, and only improves until it is
+// committed. All state lives in one static arena, and only the main loop
+// touches it, so the tick interrupt preempts a slice without any locking.
+#define THINK_DEPTHS 2
+#define THINK_PLACEMENTS 64 // More than any piece has on an open board
+#define THINK_SLICE 8000    // Cycles per slice, a tenth of a tick
+
+typedef struct
+{
+    unsigned long searches;
+    unsigned long slices;
+    unsigned long sliceWcet;  // Worst slice, a step can run past the slice
+    unsigned long depths[THINK_DEPTHS + 1]; // Searches by depth completed when they ended
+    unsigned long expanded;   // Placements searched at depth two
+} tThinkStats;
+
+extern tThinkStats thinkStats;
+extern unsigned long thinkSlice; // Cycles per slice
+
+extern void ThinkStart(tGame *game);
+extern int ThinkSlice(unsigned long budget);
+extern int ThinkPending(void);
+extern int ThinkDepth(void);
+extern unsigned long ThinkCost(void);
+extern int ThinkCommit(unsigned char *moves, int max);
+
+#endif
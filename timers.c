@@ -7,11 +7,28 @@
 #include "driverlib/sysctl.h"
 #include "driverlib/timer.h"
 #include "drivers/rit128x96x4.h"
-#include <stdlib.h>
+#include <string.h>
+#include "anim.h"
 #include "audio.h"
+#include "bench.h"
+#include "boot.h"
+#include "console.h"
+#include "cpu.h"
+#include "deadline.h"
+#include "events.h"
 #include "globals.h"
 #include "sounds.h"
-#include "graphics.h"
+#include "frame.h"
+#include "render.h"
+#include "game.h"
+#include "gamelog.h"
+#include "memmap.h"
+#include "net.h"
+#include "power.h"
+#include "sample.h"
+#include "sched.h"
+#include "selfplay.h"
+#include "think.h"
 
 // Called on driver library error
 #ifdef DEBUG
@@ -20,608 +37,608 @@ void __error__(char *pcFilename, unsigned long ulLine)
 }
 #endif
 
-// Shapes
-#define S_O 0
-#define S_I 1
-#define S_S 2
-#define S_Z 3
-#define S_L 4
-#define S_J 5
-#define S_T 6
-
-// Orientations
-#define O_000 0
-#define O_090 1
-#define O_180 2
-#define O_270 3
-
 // Timer stuff
 unsigned long g_ulSystemClock;
 const int timerDivisor = 100;
 
-// Control flags
-int tick = 0;
-int first = 1;
-int dropCounter = 0;
+// Tasks in priority order
+#define TASK_GAME   0
+#define TASK_EVENTS 1 // Ahead of the render so a clear animates from its first frame
+#define TASK_AUDIO  2
+#define TASK_RENDER 3
+#define TASK_MEMORY 4
+#define TASK_CONSOLE 5
+#define TASK_SELFPLAY 6
+#define TASK_THINK  7 // Last, it only has the time the others leave
+
+// Input masks sampled by the timer interrupt, waiting for the game task
+#define INPUT_QUEUE 8
+unsigned char inputQueue[INPUT_QUEUE];
+unsigned long inputHead = 0; // Written by the interrupt only
+unsigned long inputTail = 0; // Written by the game task only
+unsigned long inputDrops = 0;
+
+// Timer0 period as measured, to see what the sample interrupt costs it
+unsigned long tickPeriod;       // Nominal cycles per tick
+unsigned long tickLast = 0;
+unsigned long tickJitter = 0;   // Largest deviation from tickPeriod in cycles
 
 // Game state
-int shape = -1;
-int nextShape = -1;
-int *shapeDef = NULL;
-int *nextShapeDef = NULL;
-int shapeDefSize = 0;
-int nextShapeDefSize = 0;
-int orientation = -1;
-int locationX = -1;
-int locationY = -1;
-int grid[200] = { 0 };
-int score = 0;
-int tetris = 0;
-int gameover = 0;
-
-// Button states
-int b0 = 0; // D
-int b1 = 0; // U
-int b2 = 0; // L
-int b3 = 0; // R
-int b4 = 0; // RR
-
-// Graphics constants
-const int height = 4;
-const int width = 4;
-const int xOffset = 44;
-const int yOffset = 16;
-const int maxX = 9;
-const int maxY = 19;
-
-inline int ButtonUp(int curValue, int preValue)
+tGame game;
+tGame rival; // The computer's board in split screen
+int versus = 0;
+int selfPlay = 0;
+int split = 0;
+
+// Split screen boards changed since they were last drawn
+#define SPLIT_PLAYER 1
+#define SPLIT_RIVAL  2
+int splitDirty = SPLIT_PLAYER | SPLIT_RIVAL;
+int rivalOver = 0; // The computer's game over has been posted
+
+// Whether the game log was closed
+int logClosed = 0;
+
+// Frame the game is drawn into, and what the display currently shows
+unsigned char g_pucFrame[FRAME_BYTES];
+unsigned char shownFrame[FRAME_BYTES];
+
+inline int ReadButtons()
 {
-    if(!curValue && preValue)
-    {
-        return 1;
-    }
+    // Buttons pull low when pressed
+    unsigned long buttons;
+    buttons = (GPIOPinRead(GPIO_PORTE_BASE, (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)) |
+              (GPIOPinRead(GPIO_PORTF_BASE,  GPIO_PIN_1) << 3));
 
-    return 0;
+    return ~buttons & (INPUT_D | INPUT_U | INPUT_L | INPUT_R | INPUT_RR);
 }
 
-inline int ButtonDown(int curValue, int preValue)
+void Timer0IntHandler(void)
 {
-    if(curValue && !preValue)
+    unsigned long start = SchedTimestamp();
+
+    // Periods far off nominal follow a stopped timer, not jitter
+    unsigned long period = SchedElapsed(tickLast, start);
+    unsigned long deviation = period > tickPeriod ? period - tickPeriod : tickPeriod - period;
+    if(deviation < tickPeriod / 2 && deviation > tickJitter)
     {
-        return 1;
+        tickJitter = deviation;
     }
+    tickLast = start;
 
-    return 0;
-}
+    TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
 
-inline int ButtonChanged(int curValue, int preValue)
-{
-    return curValue != preValue;
-}
+    DeadlineTick(start, inputHead - inputTail);
 
-inline int ValidButtonCombo(int b0_t, int b1_t, int b2_t, int b3_t, int b4_t)
-{
-    if(b0_t)
+    if(inputHead - inputTail < INPUT_QUEUE)
     {
-        return 0;
+#ifdef BENCH
+        inputQueue[inputHead % INPUT_QUEUE] = BenchInput(inputHead); // Scripted buttons
+#else
+        inputQueue[inputHead % INPUT_QUEUE] = ReadButtons();
+#endif
+        inputHead++;
+    }
+    else
+    {
+        inputDrops++;
     }
 
-    return b1_t + b2_t + b3_t + b4_t <= 1;
-}
+    SchedTick();
 
-inline void Transpose(int *a, int *b, int *c, int *d)
-{
-   int temp = *a;
-   *a = *b;
-   *b = *c;
-   *c = *d;
-   *d = temp;
+#ifdef BENCH
+    BenchTimer(SchedElapsed(start, SchedTimestamp()));
+#endif
 }
 
-inline void Rotate(int *m, int n)
+// Writes locked pieces to the game log and closes it at game over, which
+// in split screen can be either board's
+void LogEvents(const tEvent *event)
 {
-    int i, j;
-    for(i = 0; i < n / 2; i++)
+    if(event->type == EVENT_LOCK)
     {
-       for(j = 0; j < (n + 1) / 2; j++)
-       {
-           Transpose(&(m[i*n+j]), &(m[(n-1-j)*n+i]), &(m[(n-1-i)*n+(n-1-j)]), &(m[j*n+(n-1-i)]));
-       }
+        GameLogAppend(&event->lock);
     }
-}
-
-inline void RotateShape(int *m, int n, int newOrientation)
-{
-    int rotations =
-        shape == S_O ? 0 :
-        (shape == S_I || shape == S_S || shape == S_Z) && (newOrientation == O_000 || newOrientation == O_180) ? 0 :
-        (shape == S_I || shape == S_S || shape == S_Z) ? 1 :
-        newOrientation == O_000 ? 0 :
-        newOrientation == O_090 ? 1 :
-        newOrientation == O_180 ? 2 : 3;
-
-    int i;
-    for(i = 0; i < rotations; i++)
+    else if(event->type == EVENT_GAMEOVER && !logClosed)
     {
-        Rotate(m, n);
+        GameLogFlush();
+        logClosed = 1;
     }
 }
 
-inline int * Copy(const int *src, int len)
+void AnimEvents(const tEvent *event)
 {
-    int *copy = malloc(len * sizeof(int));
-    memcpy(copy, src, len * sizeof(int));
-    return copy;
+    if(event->type == EVENT_LOCK)
+    {
+        AnimAbort(); // The board has changed again under any animation
+        AnimStart(&event->lock);
+        splitDirty |= SPLIT_PLAYER;
+        SchedPost(TASK_RENDER);
+    }
 }
 
-inline int CheckPosition(int *shape, int shapeSize, int newX, int newY)
+// Plays the line clear samples, or the fire effect tone while behind, as
+// samples cost a decode every tick. The tone also marks game over.
+void SoundEvents(const tEvent *event)
 {
-    int i, j;
-    for(i = 0; i < shapeSize; i++)
+    if(event->type == EVENT_LINES)
     {
-        for(j = 0; j < shapeSize; j++)
+        if(DeadlineLevel() == DEADLINE_SHED)
         {
-            if(shape[i * shapeSize + j])
-            {
-                int thisY = newY + i;
-                if(thisY < 0 || thisY > maxY)
-                {
-                    return 0;
-                }
-
-                int thisX = newX + j;
-                if(thisX < 0 || thisX > maxX)
-                {
-                    return 0;
-                }
-
-                if(grid[((newY + i) * (maxX + 1)) + newX + j])
-                {
-                    return 0;
-                }
-            }
+            AudioPlaySound(fireEffect, sizeof(fireEffect) / 2);
+        }
+        else if(event->value == 4)
+        {
+            SamplePlay(tetrisSample, sizeof(tetrisSample));
+        }
+        else
+        {
+            SamplePlay(lineClearSample, sizeof(lineClearSample));
         }
     }
-
-    return 1;
+    else if(event->type == EVENT_GAMEOVER)
+    {
+        AudioPlaySound(fireEffect, sizeof(fireEffect) / 2);
+    }
 }
 
-inline int GetNextOrientation()
+// Steps the player and the computer one tick each and exchanges garbage.
+// Both stop when either tops out.
+int SplitStep(int input)
 {
-    if(orientation == O_000)
+    if(game.gameover || rival.gameover)
     {
-        return O_090;
+        return 0;
     }
-    else if(orientation == O_090)
+
+    if(GameStep(&game, input))
     {
-        return O_180;
+        splitDirty |= SPLIT_PLAYER;
     }
-    else if(orientation == O_180)
+    if(GameStep(&rival, CpuTick(&rival)))
     {
-        return O_270;
+        splitDirty |= SPLIT_RIVAL;
     }
 
-    return  O_000;
+    game.garbageIn += rival.garbageOut;
+    rival.garbageIn += game.garbageOut;
+    game.garbageOut = 0;
+    rival.garbageOut = 0;
+
+    return splitDirty != 0;
 }
 
-inline int TryChangeOrientation()
+// Runs one game tick per sampled input so none are merged when a render
+// holds up the loop
+void GameTask(void)
 {
-    int next = GetNextOrientation();
+    while(inputTail != inputHead)
+    {
+        unsigned long index = inputTail;
+        int input = inputQueue[index % INPUT_QUEUE];
+        inputTail++;
 
-    int *copy = Copy(&shapeDef[0], shapeDefSize * shapeDefSize);
-    RotateShape(copy, shapeDefSize, next);
+        int changed = 0;
+        if(!selfPlay)
+        {
+            changed = versus ? NetStep(input) : split ? SplitStep(input) : GameStep(&game, input);
+            if(changed)
+            {
+                SchedPost(TASK_RENDER);
+            }
+            ASSERT(GameCheck(versus ? NetLocalGame() : &game) == GAME_OK);
 
-    if(CheckPosition(&copy[0], shapeDefSize, locationX, locationY))
-    {
-        free(shapeDef);
-        shapeDef = copy;
-        return 1;
-    }
+            // Rollbacks replay the versus game, so only local boards post
+            if(!versus)
+            {
+                EventWatch(&game);
+                if(split && rival.gameover && !rivalOver)
+                {
+                    EventPost(EVENT_GAMEOVER, 1, 0); // Ends the split game too
+                    rivalOver = 1;
+                }
+            }
+        }
+        // Idle time only counts once the game on screen is over
+        int playing = !selfPlay && !(versus ? NetLocalGame()->gameover : game.gameover || rival.gameover);
+        if(PowerTick(input, playing))
+        {
+            SchedPost(TASK_RENDER); // Wake the display
+        }
 
-    free(copy);
-    return 0;
-}
+        if(AnimTick(inputHead - inputTail))
+        {
+            splitDirty |= SPLIT_PLAYER;
+            SchedPost(TASK_RENDER);
+        }
 
-inline int TryMove(int newX, int newY)
-{
-    if(CheckPosition(&shapeDef[0], shapeDefSize, newX, newY))
+        DeadlineProcessed(inputHead - inputTail, changed);
+#ifdef BENCH
+        BenchStepped(index, changed);
+#endif
+    }
+
+    if(EventPending())
     {
-        locationX = newX;
-        locationY = newY;
-        return 1;
+        SchedPost(TASK_EVENTS);
+    }
+    if(ThinkPending())
+    {
+        SchedPost(TASK_THINK);
     }
-    return 0;
-}
 
-inline void StoreShape()
-{
-    int i, j;
-    for(i = 0; i < shapeDefSize; i++)
+#ifdef BENCH
+    if(BenchDone())
     {
-        for(j = 0; j < shapeDefSize; j++)
-        {
-            if(shapeDef[i * shapeDefSize + j])
-            {
-                grid[((locationY + i) * (maxX + 1)) + locationX + j] = 1;
-            }
-        }
+        BenchFinish(TASK_GAME, TASK_AUDIO, TASK_RENDER);
     }
+#endif
 }
 
-inline void RemoveLine(int lineIndex)
+// Hands the queued game events to the subscribers a batch at a time
+void EventTask(void)
 {
-    int i, j;
-    for(i = lineIndex; i > 0; i--)
+    if(EventDrain())
     {
-        for(j = 0; j <= maxX; j++)
-        {
-            grid[i * (maxX + 1) + j] = grid[(i - 1) * (maxX + 1) + j];
-        }
+        SchedPost(TASK_EVENTS);
     }
+}
 
-    // Clear top line
-    for(j = 0; j < maxX; j++)
+void AudioTask(void)
+{
+    // Samples take over the PWM while they play
+    if(!SampleTask())
     {
-        grid[j] = 0;
+        AudioHandler(); // Play sounds
     }
 }
 
-inline int ClearLines()
+// Sends the rows of the frame that changed since the last flush. Returns
+// the bytes sent.
+unsigned long FlushFrame(void)
 {
-    int linesRemoved = 0;
-
-    int i, j;
-    for(i = maxY; i >= 0; i--)
+    unsigned long bytes = 0;
+    int y = 0;
+    while(y < FRAME_HEIGHT)
     {
-        int removeLine = 1;
-        for(j = 0; j <= maxX; j++)
+        int offset = y * FRAME_STRIDE;
+        if(!memcmp(&g_pucFrame[offset], &shownFrame[offset], FRAME_STRIDE))
         {
-            if(!grid[i * (maxX + 1) + j])
-            {
-                removeLine = 0;
-                break;
-            }
+            y++;
+            continue;
         }
 
-        if(removeLine)
+        int first = y;
+        do
         {
-            RemoveLine(i);
-            i++; // Reevaluate this line since it just changed
-            linesRemoved++;
-        }
+            y++;
+        } while(y < FRAME_HEIGHT && memcmp(&g_pucFrame[y * FRAME_STRIDE], &shownFrame[y * FRAME_STRIDE], FRAME_STRIDE));
+
+        RIT128x96x4ImageDraw(&g_pucFrame[offset], 0, first, FRAME_WIDTH, y - first);
+        memcpy(&shownFrame[offset], &g_pucFrame[offset], (y - first) * FRAME_STRIDE);
+        bytes += (y - first) * FRAME_STRIDE;
     }
 
-    return linesRemoved;
+#ifdef BENCH
+    BenchFlushed(bytes); // Ends the timing of a press it shows
+#endif
+    return bytes;
 }
 
-inline void UpdateScore(int numLines)
+// Redraws only the boards that changed, the two together cost twice one
+void DrawSplit()
 {
-    if(numLines == 0)
+    if(splitDirty & SPLIT_PLAYER)
     {
-        score += 10;
-        return;
+        RenderBoard(g_pucFrame, &game, &splitViews[0]);
     }
-    if(numLines == 4)
+    if(splitDirty & SPLIT_RIVAL)
     {
-        if(tetris)
-        {
-            score += 1200;
-        }
-        else
-        {
-            tetris = 1;
-            score += 800;
-        }
-        return;
+        RenderBoard(g_pucFrame, &rival, &splitViews[1]);
     }
+    splitDirty = 0;
 
-    tetris = 0;
-    score += numLines * 100;
-}
-
-void InitShape(int s, int **buffer, int *size)
-{
-    if(*buffer)
+    if(DeadlineHud())
     {
-        free(*buffer);
+        char scoreSt[7];
+        FrameStringDraw(g_pucFrame, "You", SPLIT_LEFT_X, 4, 15);
+        FrameStringDraw(g_pucFrame, "CPU", SPLIT_RIGHT_X, 4, 15);
+        IntToString(game.score, scoreSt);
+        FrameStringDraw(g_pucFrame, scoreSt, SPLIT_MIDDLE_X, 72, 15);
+        IntToString(rival.score, scoreSt);
+        FrameStringDraw(g_pucFrame, scoreSt, SPLIT_MIDDLE_X, 84, 15);
     }
 
-    if(s == S_O)
+    if(rival.gameover)
     {
-        *size = 2;
-        *buffer = Copy(&SD_O[0], *size * *size);
+        FrameStringDraw(g_pucFrame, "    YOU WIN    ", 20, 48, 15);
     }
-    else if(s == S_I)
+    else if(game.gameover)
     {
-        *size = 4;
-        *buffer = Copy(&SD_I[0], *size * *size);
+        FrameStringDraw(g_pucFrame, "   CPU WINS    ", 20, 48, 15);
     }
-    else
+
+    int animating = AnimActive();
+    unsigned long bytes = FlushFrame();
+    if(animating)
     {
-        *size = 3;
-        if(s == S_S)
-        {
-            *buffer = Copy(&SD_S[0], *size * *size);
-        }
-        else if(s == S_Z)
-        {
-            *buffer = Copy(&SD_Z[0], *size * *size);
-        }
-        else if(s == S_L)
-        {
-            *buffer = Copy(&SD_L[0], *size * *size);
-        }
-        else if (s == S_J)
-        {
-            *buffer = Copy(&SD_J[0], *size * *size);
-        }
-        else
-        {
-            *buffer = Copy(&SD_T[0], *size * *size);
-        }
+        AnimFrame(bytes);
+    }
+    if(game.shape >= 0)
+    {
+        BootMark(BOOT_PLAYABLE);
     }
 }
 
-void GetNextShape()
+inline void DrawGame()
 {
-    int r = rand();
+    tGame *g = versus ? NetLocalGame() : selfPlay ? SelfPlayGame() : &game;
 
-    if(!nextShapeDef)
+    RenderGame(g_pucFrame, g);
+
+    if(DeadlineHud())
     {
-        nextShape = (r % 7) - 1;
+        RenderScore(g_pucFrame, g);
+        if(versus)
+        {
+            char themSt[7];
+            IntToString(NetRemoteGame()->score, themSt);
+            FrameStringDraw(g_pucFrame, "Them:", 0, 40, 15);
+            FrameStringDraw(g_pucFrame, themSt, 0, 50, 15);
+        }
     }
 
-    shape = nextShape;
-    nextShape = (r % 7) - 1;
-
-    InitShape(shape, &shapeDef, &shapeDefSize);
-    InitShape(nextShape, &nextShapeDef, &nextShapeDefSize);
-
-    locationX = 4;
-    locationY = 0;
-    orientation = O_000;
-
-    if(!TryMove(locationX, locationY))
+    if(versus && NetState() == NET_WAITING)
     {
-        gameover = 1;
+        FrameStringDraw(g_pucFrame, "    WAITING    ", 20, 48, 15);
     }
-}
-
-void Timer0IntHandler(void)
-{
-    TimerIntClear(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
 
-    if(gameover)
+    if(g->gameover)
     {
-        return;
+        FrameStringDraw(g_pucFrame, "   GAME OVER   ", 20, 48, 15);
     }
 
-    if(!shapeDef)
+    int animating = AnimActive();
+    unsigned long bytes = FlushFrame();
+    if(animating)
     {
-        GetNextShape();
-        tick = 1;
+        AnimFrame(bytes);
     }
-
-    //AudioHandler(); // Play sounds
-
-    // Get button states
-    unsigned long buttons;
-    buttons = (GPIOPinRead(GPIO_PORTE_BASE, (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)) |
-              (GPIOPinRead(GPIO_PORTF_BASE,  GPIO_PIN_1) << 3));
-
-    int b0_t = !(buttons & 1);
-    int b1_t = !((buttons & 2) >> 1);
-    int b2_t = !((buttons & 4) >> 2);
-    int b3_t = !((buttons & 8) >> 3);
-    int b4_t = !((buttons & 16) >> 4);
-    if(ValidButtonCombo(b0_t, b1_t, b2_t, b3_t, b4_t))
+    if(g->shape >= 0)
     {
-        if(ButtonUp(b4_t, b4))
-        {
-            if(TryChangeOrientation())
-            {
-                tick = 1;
-                srand(dropCounter);
-            }
-        }
-        if(ButtonDown(b2_t, b2) || b2_t && dropCounter % 10 == 0) // Throttle to 1/10th seconds
-        {
-            if(TryMove(locationX - 1, locationY))
-            {
-                tick = 1;
-                srand(dropCounter);
-            }
-        }
-        if(ButtonDown(b3_t, b3) || b3_t && dropCounter % 10 == 0)
-        {
-            if(TryMove(locationX + 1, locationY))
-            {
-                tick = 1;
-                srand(dropCounter);
-            }
-        }
-        if(b1_t) // Continuous press
-        {
-            if(TryMove(locationX, locationY + 1))
-            {
-                tick = 1;
-            }
-        }
+        BootMark(BOOT_PLAYABLE);
     }
+}
 
-    // Store button states
-    b0 = b0_t;
-    b1 = b1_t;
-    b2 = b2_t;
-    b3 = b3_t;
-    b4 = b4_t;
-
-    dropCounter++;
-    if(dropCounter == timerDivisor)
+// Places one self-play piece and queues itself again, so games run in
+// whatever time the other tasks leave
+void SelfPlayTask(void)
+{
+    if(SelfPlayRun())
     {
-        if(!TryMove(locationX, locationY + 1))
-        {
-            // Hit bottom or another piece
-            StoreShape();
-            int numLines = ClearLines();
-            UpdateScore(numLines);
-
-            free(shapeDef);
-            shapeDef = NULL;
-        }
-
-        dropCounter = 0;
-        tick = 1;
+        SchedPost(TASK_RENDER); // Show each finished game
     }
+    SchedPost(TASK_SELFPLAY);
+}
 
-    // Trigger the event the first time so the initial screen is drawn
-    if(first)
+// Deepens the computer's search a slice at a time, queueing itself again
+// until it is done. The game tick waits at most one slice.
+void ThinkTask(void)
+{
+    if(ThinkSlice(thinkSlice))
     {
-        first = 0;
-        tick = 1; // Signal event
+        SchedPost(TASK_THINK);
     }
 }
 
-inline char * IntToString(int input)
+void MemoryTask(void)
 {
-    // Convert int to char pointer
-    // Only works with non-negative values 0 - 999999
-    int flag = 0;
-    int i = 5;
-    char str[7] = { '0', '0', '0', '0', '0', '0', '\0' };
-    while(input != 0)
+    // Telemetry waits for the next period while behind
+    if(DeadlineLevel() != DEADLINE_SHED)
     {
-        str[i--] = (input % 10) + '0';
-        input /= 10;
-        flag = 1;
+        MemSample(); // Stack high watermark
     }
+}
 
-    if(!flag) // Input == 0
+// Sends pending output and answers commands typed on the serial port
+void ConsoleTask(void)
+{
+    ConsoleFlush();
+
+    const char *command = ConsoleRead();
+    if(!command)
     {
-        return "000000";
+        return;
     }
 
-    char *result = malloc(7);
-    if(result == NULL)
+    const char *argument;
+    if(ConsoleCommand(command, "mem"))
     {
-        return NULL;
+        MemReport();
     }
-
-    { // Additional scope so we don't need to define j up top, CC Studio is C89
-        int j;
-        for(j = 0; j < 7; j++)
+    else if(ConsoleCommand(command, "boot"))
+    {
+        BootReport();
+    }
+    else if((argument = ConsoleCommand(command, "idle")) != 0)
+    {
+        // Seconds without a press after a game before the display goes off
+        long seconds = ConsoleArgument(argument);
+        if(seconds >= 0)
         {
-            result[j] = str[j];
+            powerDisplayTimeout = seconds * timerDivisor;
         }
+        ConsolePrint("idle ");
+        ConsoleNumber(powerDisplayTimeout / timerDivisor);
+        ConsolePrint(powerDisplayTimeout ? " s\r\n" : " s, display stays on\r\n");
+    }
+    else
+    {
+        ConsolePrint("commands: mem, boot, idle [seconds]\r\n");
     }
-
-    return result;
 }
 
-inline void DrawShape(int *m, int rows, int cols, int x, int y, unsigned char *bufferT, unsigned char *bufferF)
+void RenderTask(void)
 {
-    int startX = xOffset + (width * x);
-    int startY = yOffset + (height * y);
-
-    int i, j;
-    for(i = 0; i < rows; i++)
+    if(PowerDisplay())
     {
-        int yAbs = startY + (height * i);
-        for(j = 0; j < cols; j++)
+        if(DeadlineRender(inputHead - inputTail))
         {
-            int xAbs = startX + (width * j);
-
-            if(m[i * cols + j])
+            if(split)
             {
-                RIT128x96x4ImageDraw(bufferT, xAbs, yAbs, width, height);
+                DrawSplit();
             }
-            else if(bufferF)
+            else
             {
-                RIT128x96x4ImageDraw(bufferF, xAbs, yAbs, width, height);
+                DrawGame();
             }
         }
+        else
+        {
+            SchedPost(TASK_RENDER); // Again once the game task has caught up
+        }
     }
 }
 
-inline void DrawGame()
+// Timer, game log, sound, power and console. Built with BOOT_DEVICES_FIRST
+// this runs ahead of the first frame, the order before the board was shown
+// early, so both can be timed on the board with the console's boot report.
+static void DeviceInit(void)
 {
-    unsigned char *bmpBlock = (unsigned char *)&block[0];
-    unsigned char *bmpClear = (unsigned char *)&clear[0];
-
-    DrawShape(grid, 20, 10, 0, 0, bmpBlock, bmpClear);
+    // Init timer
+    TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
+    tickPeriod = g_ulSystemClock / timerDivisor;
+    TimerLoadSet(TIMER0_BASE, TIMER_A, tickPeriod);
+    IntEnable(INT_TIMER0A);
+    TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
+    TimerEnable(TIMER0_BASE, TIMER_A);
 
-    if(shapeDef)
-    {
-        DrawShape(shapeDef, shapeDefSize, shapeDefSize, locationX, locationY, bmpBlock, NULL);
-    }
-    if(nextShapeDef)
+    // Hold U at power-up to erase the game log
+    GameLogInit();
+    if(ReadButtons() & INPUT_U)
     {
-        DrawShape((int*)&SD_C[0], 4, 4, 13, -2, bmpBlock, bmpClear); // Clear previous
-        DrawShape(nextShapeDef, nextShapeDefSize, nextShapeDefSize, 13, -2, bmpBlock, NULL);
+        GameLogErase();
     }
 
-    char *scoreSt = IntToString(score);
-    RIT128x96x4StringDraw("Score:", 0, 70, 15);
-    RIT128x96x4StringDraw(scoreSt, 0, 80, 15);
-    free(scoreSt);
+    // Init sound
+    GPIOPinTypePWM(GPIO_PORTG_BASE, GPIO_PIN_1);
+    AudioOn();
+    SampleInit();
 
-    if(gameover)
-    {
-        RIT128x96x4StringDraw("   GAME OVER   ", 20, 48, 15);
-    }
+    EventSubscribe(LogEvents);
+    EventSubscribe(AnimEvents);
+    EventSubscribe(SoundEvents);
+
+    PowerInit();
+    ConsoleInit();
 }
 
 int main(void)
 {
+    MemInit();
+
     // Init clocks
     SysCtlClockSet(SYSCTL_SYSDIV_1 | SYSCTL_USE_OSC | SYSCTL_OSC_MAIN | SYSCTL_XTAL_8MHZ);
     SysCtlPWMClockSet(SYSCTL_PWMDIV_8);
 
-    // Init screen
-    RIT128x96x4Init(1000000);
-    unsigned char *bmpWall = (unsigned char *)&wall[0];
-    RIT128x96x4ImageDraw(bmpWall, xOffset - 2, 0, 2, 96);
-    RIT128x96x4ImageDraw(bmpWall, xOffset + 40, 0, 2, 96);
-
     // Get system clock
     g_ulSystemClock = SysCtlClockGet();
+    BootInit();
 
-    // Enable peripherals
+    // Enable peripherals now so they are ready, and the button pull-ups
+    // settled, by the time the display is up
     SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOG);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_PWM0);
 
-    // Init timer
-    TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
-    TimerLoadSet(TIMER0_BASE, TIMER_A, SysCtlClockGet() / timerDivisor);
-    IntEnable(INT_TIMER0A);
-    TimerIntEnable(TIMER0_BASE, TIMER_TIMA_TIMEOUT);
-    TimerEnable(TIMER0_BASE, TIMER_A);
-
     // Init buttons
     GPIOPinTypeGPIOInput(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3);
     GPIOPadConfigSet(GPIO_PORTE_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
     GPIOPinTypeGPIOInput(GPIO_PORTF_BASE, GPIO_PIN_1);
     GPIOPadConfigSet(GPIO_PORTF_BASE, GPIO_PIN_1, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
 
-    // Init sound
-    GPIOPinTypePWM(GPIO_PORTG_BASE, GPIO_PIN_1);
-    AudioOn();
-
-    //AudioPlaySound(g_pusFireEffect, sizeof(g_pusFireEffect) / 2);
+    // Init screen
+    RIT128x96x4Init(1000000);
+    BootMark(BOOT_DISPLAY);
 
-    IntMasterEnable();
-    while(1)
+    // Hold D at power-up to play versus over Ethernet, L to stream
+    // self-play samples, or R to play the computer on a split screen
+    GameInit(&game, 1);
+    if(ReadButtons() & INPUT_D)
+    {
+        NetInit();
+        versus = 1;
+    }
+    else if(ReadButtons() & INPUT_L)
+    {
+        SelfPlayInit(0, 1);
+        selfPlay = 1;
+    }
+    else if(ReadButtons() & INPUT_R)
     {
-        while(!tick); // Wait for events
+        GameInit(&rival, 1); // Same pieces for both
+        CpuInit();
+        split = 1;
+    }
 
-        IntMasterDisable();
-        tick = 0; // Reset event flag
+#ifdef BOOT_DEVICES_FIRST
+    DeviceInit();
+    BootMark(BOOT_DEVICES);
+#endif
 
+    // Show the board before the rest of the bring-up. Every row differs
+    // from the cleared display, so the flush is one burst of the whole frame.
+    if(split)
+    {
+        RenderWalls(g_pucFrame, &splitViews[0]);
+        RenderWalls(g_pucFrame, &splitViews[1]);
+        DrawSplit();
+    }
+    else
+    {
+        RenderInit(g_pucFrame);
         DrawGame();
+    }
+    BootMark(BOOT_FRAME);
 
+#ifndef BOOT_DEVICES_FIRST
+    DeviceInit();
+    BootMark(BOOT_DEVICES);
+#endif
+
+
+    // Deadlines in cycles from release, one timer tick is g_ulSystemClock / timerDivisor
+    SchedAdd(TASK_GAME, GameTask, 1, g_ulSystemClock / timerDivisor);
+    SchedAdd(TASK_EVENTS, EventTask, 0, g_ulSystemClock / timerDivisor);
+    SchedAdd(TASK_AUDIO, AudioTask, 1, g_ulSystemClock / timerDivisor);
+    SchedAdd(TASK_RENDER, RenderTask, 0, 5 * g_ulSystemClock / timerDivisor);
+    SchedAdd(TASK_MEMORY, MemoryTask, timerDivisor, g_ulSystemClock);
+    SchedAdd(TASK_CONSOLE, ConsoleTask, 1, g_ulSystemClock / timerDivisor);
+    SchedAdd(TASK_SELFPLAY, SelfPlayTask, 0, g_ulSystemClock / timerDivisor);
+    SchedAdd(TASK_THINK, ThinkTask, 0, g_ulSystemClock / timerDivisor);
+    if(selfPlay)
+    {
+        SchedPost(TASK_SELFPLAY);
+    }
+    SchedPost(TASK_RENDER); // Draw the initial screen
+
+    IntMasterEnable();
+    while(1)
+    {
+        // Sleep until an interrupt releases a task. Once the display is off
+        // after game over only a button press wakes the core.
+        IntMasterDisable();
+        while(!SchedReady())
+        {
+            PowerIdle(!versus && (game.gameover || rival.gameover));
+        }
         IntMasterEnable();
+
+#ifdef BENCH
+        BenchDecide(&game, !split); // The computer's own search runs in split screen
+#endif
+        SchedRunNext();
     }
 }
@@ -31,7 +31,7 @@
 /* modifications in your CCS project and leave this file alone.              */
 /*                                                                           */
 /* --heap_size=0                                                             */
-/* --stack_size=256                                                          */
+/* --stack_size=1024                                                         */
 /* --library=rtsv7M3_T_le_eabi.lib                                           */
 
 /* The starting address of the application.  Normally the interrupt vectors  */
@@ -44,7 +44,9 @@
 MEMORY
 {
     /* Application stored in and executes from internal flash */
-    FLASH (RX) : origin = APP_BASE, length = 0x00040000
+    FLASH (RX) : origin = APP_BASE, length = 0x00030000
+    /* Top 64 KB holds the game log, see gamelog.h */
+    LOG (R) : origin = 0x00030000, length = 0x00010000
     /* Application uses internal RAM for data */
     SRAM (RWX) : origin = 0x20000000, length = 0x00010000
 }
@@ -67,4 +69,14 @@ SECTIONS
     .stack  :   > SRAM
 }
 
-__STACK_TOP = __stack + 256;
+/* Stack sized from measured depths, Stack/stack.c on the host (x86-64      */
+/* frames, larger than Thumb-2 ones), from the task's entry down:           */
+/*   think  344   step   232   choose 264   pc 336   events/render 296      */
+/* Above the task: main, SchedRunNext and the task itself, about 96. One    */
+/* interrupt at a time on top, as all run at the same priority: the 32 byte */
+/* exception frame and the Timer0 handler's calls, about 104. That is 544,  */
+/* so 1024 keeps better than 400 bytes spare once the 32 to 63 byte MPU     */
+/* guard is taken. The benchmark build checks the depths again on the board */
+/* and "mem" on the console reports the high watermark. Keep this and       */
+/* --stack_size in the project the same.                                    */
+__STACK_TOP = __stack + 1024;